@@ -0,0 +1,107 @@
+#include "AsciiTokenizer.h"
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define TOKENIZER_SSE2 1
+#include <emmintrin.h>
+#else
+#define TOKENIZER_SSE2 0
+#endif // SSE2
+
+#if defined(__GNUC__) || defined(__clang__)
+#define lowestBit(mask) __builtin_ctz(mask)
+#else
+#include <intrin.h>
+static inline unsigned int lowestBit(unsigned int mask)
+{
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return index;
+}
+#endif // __GNUC__
+
+
+/** \brief Records the first occurrence of the token at position. Returns true once all tokens were found. */
+static inline bool addToken(AsciiTokens& result, uint8_t token, char* position, uint8_t& found)
+{
+    if (!token || result.position[token]) return false;
+    result.position[token] = position;
+    return ++found == ASCII_TOKEN_COUNT - 1;
+} // addToken
+
+
+#if TOKENIZER_SSE2
+/** 16 bytes 0xff followed by 16 zeros, loaded at 16 - k it keeps the first k bytes of a block. */
+static const uint8_t prefixMask[32] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff };
+#endif // TOKENIZER_SSE2
+
+
+void AsciiTokenizer::tokenize(char* line, AsciiTokens& result)
+{
+    uint8_t found = 0;
+    uint8_t checksum = 0;
+
+
+    for (int i = 0; i < ASCII_TOKEN_COUNT; i++)
+        result.position[i] = 0;
+
+#if TOKENIZER_SSE2
+    // Only the bytes of the line are read: full blocks directly, the rest from a zero padded copy
+    size_t          length = strlen(line);
+    char            tail[16];
+    __m128i         sum = _mm_setzero_si128();
+    const __m128i   belowE = _mm_set1_epi8('E' - 1);
+    const __m128i   aboveZ = _mm_set1_epi8('Z' + 1);
+    const __m128i   star = _mm_set1_epi8('*');
+
+
+    for (size_t offset = 0; offset < length && found < ASCII_TOKEN_COUNT - 1; offset += 16)
+    {
+        char*           block = line + offset;
+        unsigned int    valid = 0xffff;
+        __m128i         v;
+
+
+        if (length - offset >= 16) v = _mm_loadu_si128((const __m128i*)block);
+        else
+        {
+            memset(tail, 0, sizeof(tail));
+            memcpy(tail, block, length - offset);
+            v = _mm_loadu_si128((const __m128i*)tail);
+            valid = (1u << (length - offset)) - 1;
+        }
+
+        __m128i         letter = _mm_and_si128(_mm_cmpgt_epi8(v, belowE), _mm_cmplt_epi8(v, aboveZ));
+        unsigned int    candidates = (unsigned int)_mm_movemask_epi8(_mm_or_si128(letter, _mm_cmpeq_epi8(v, star))) & valid;
+        bool            summing = !result.position[ASCII_CHECKSUM];
+
+
+        for (bool done = false; candidates && !done; candidates &= candidates - 1)
+        {
+            char* position = block + lowestBit(candidates);
+            done = addToken(result, tokens[(uint8_t)*position], position, found);
+        }
+
+        // The checksum covers the characters in front of the first '*' only
+        if (!summing) continue;
+        if (result.position[ASCII_CHECKSUM])
+            v = _mm_and_si128(v, _mm_loadu_si128((const __m128i*)(prefixMask + 16 - (result.position[ASCII_CHECKSUM] - block))));
+        sum = _mm_xor_si128(sum, v);
+    }
+    sum = _mm_xor_si128(sum, _mm_srli_si128(sum, 8));
+    sum = _mm_xor_si128(sum, _mm_srli_si128(sum, 4));
+    sum = _mm_xor_si128(sum, _mm_srli_si128(sum, 2));
+    sum = _mm_xor_si128(sum, _mm_srli_si128(sum, 1));
+    checksum = (uint8_t)_mm_cvtsi128_si32(sum);
+#else
+    for (char* p = line; *p; p++)
+    {
+        if (addToken(result, tokens[(uint8_t)*p], p, found)) break;
+        if (!result.position[ASCII_CHECKSUM]) checksum ^= (uint8_t)*p;
+    }
+#endif // TOKENIZER_SSE2
+
+    result.checksum = result.position[ASCII_CHECKSUM] ? checksum : 0;
+
+} // tokenize
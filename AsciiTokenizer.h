@@ -0,0 +1,57 @@
+#pragma once
+
+#include "types.h"
+#include <array>
+
+/** \brief Characters located by AsciiTokenizer, in the order GCode::parseAscii() reads them. */
+enum AsciiToken
+{
+    ASCII_NONE = 0,
+    ASCII_N, ASCII_M, ASCII_G, ASCII_X, ASCII_Y, ASCII_Z, ASCII_E, ASCII_F,
+    ASCII_T, ASCII_S, ASCII_P, ASCII_I, ASCII_J, ASCII_R,
+    ASCII_CHECKSUM,         ///< '*'
+    ASCII_TOKEN_COUNT
+};
+
+/** \brief Result of AsciiTokenizer::tokenize(). */
+struct AsciiTokens
+{
+    char*   position[ASCII_TOKEN_COUNT];    ///< First occurrence of each character, 0 if missing.
+    uint8_t checksum;                       ///< XOR of all characters in front of the first '*'.
+};
+
+namespace AsciiTokenizerTables
+{
+    constexpr std::array<uint8_t, 256> makeTokens()
+    {
+        std::array<uint8_t, 256> table{};
+        const char letters[] = "NMGXYZEFTSPIJR*";
+        for (uint8_t i = 0; letters[i]; i++)
+            table[(uint8_t)letters[i]] = i + 1;
+        return table;
+    }
+} // namespace AsciiTokenizerTables
+
+/** \brief Single pass over an ASCII command line.
+
+One walk over the line finds the first occurrence of every parameter letter and of '*'
+and computes the XOR checksum on the way. The positions are the same ones strchr()
+returns, so the values parsed from them are unchanged, but the line is read once instead
+of once per letter plus once for the checksum. On x86 the line is scanned 16 characters
+at a time and only uppercase letters and '*' are looked up in the table. The length comes
+from strlen(), so no byte behind the terminator is read: the last partial block is copied
+into a zero padded buffer. */
+class AsciiTokenizer
+{
+public:
+    static constexpr std::array<uint8_t, 256> tokens = AsciiTokenizerTables::makeTokens();
+
+    static void tokenize(char* line, AsciiTokens& result);
+
+    /** \brief Forgets the '*' if the line was terminated at or in front of it. */
+    static inline void truncate(AsciiTokens& result, const char* end)
+    {
+        if (result.position[ASCII_CHECKSUM] && result.position[ASCII_CHECKSUM] >= end) result.position[ASCII_CHECKSUM] = 0;
+    } // truncate
+
+}; // AsciiTokenizer
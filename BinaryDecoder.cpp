@@ -0,0 +1,438 @@
+#include "BinaryDecoder.h"
+#include "MappedFile.h"
+#include "gcode.h"
+#include "DecoderContext.h"
+#include "Checksum.h"
+#include "CommandFilter.h"
+#include "CommandStore.h"
+#include "FileIndex.h"
+#include <cstring>
+
+/** Distance between two MADV_WILLNEED hints while decoding. */
+#define READ_AHEAD_SIZE (4 * 1024 * 1024)
+
+/** Number of commands whose checksums are verified in one batch. */
+#define VERIFY_BATCH 4096
+
+/** Number of commands decodeBatch() verifies at once. */
+#define DECODE_VERIFY_BATCH 256
+
+/** Number of commands decodeRange() decodes per decodeBatch() call. */
+#define DECODE_BATCH 256
+
+/** Number of error offsets kept in a VerifyReport. */
+#define VERIFY_MAX_OFFSETS 100
+
+/** Commands verified in the first batch behind a damaged command, the batch doubles up to VERIFY_BATCH. */
+#define RECOVERY_FIRST_BATCH 32
+
+/** Number of skipped ranges kept in a RecoveryReport. */
+#define RECOVERY_MAX_RANGES 100
+
+/** Number of commands which must follow a candidate before it is accepted as command start. */
+#define CONFIRM_COMMANDS 3
+
+
+/** \brief Locates the command at position and returns the number of bytes it occupies.
+    command points into the input if the header is plausible, else to paddedCommand (256 bytes),
+    which then holds the 5 header bytes followed by zeros. */
+size_t BinaryDecoder::nextCommand(uint8_t* position, size_t remaining, uint8_t*& command, uint8_t& size, uint8_t* paddedCommand)
+{
+    size = GCode::computeBinarySize((char*)position);
+    if (size <= MAX_CMD_SIZE2 && size <= remaining)
+    {
+        command = position;
+        return size > MIN_CMD_SIZE ? size : MIN_CMD_SIZE;
+    }
+
+    memset(paddedCommand, 0, 256);
+    memcpy(paddedCommand, position, MIN_CMD_SIZE);
+    command = paddedCommand;
+    return MIN_CMD_SIZE;
+
+} // nextCommand
+
+
+/** \brief Returns true if a complete binary command with a plausible header and a correct
+    checksum starts at position. */
+bool BinaryDecoder::isValidCommand(const uint8_t* position, size_t remaining, uint8_t& size)
+{
+    return isPlausibleHeader(position, remaining, size) && GCode::hasValidChecksum(position, size);
+
+} // isValidCommand
+
+
+/** \brief Returns true if a command with a plausible header starts at position and ends in front
+    of remaining. The checksum is not checked. */
+bool BinaryDecoder::isPlausibleHeader(const uint8_t* position, size_t remaining, uint8_t& size)
+{
+    if (remaining < MIN_CMD_SIZE) return false;
+
+    uint16_t bitfield = *(const uint16_t*)position;
+    if (!(bitfield & 128) || (bitfield & 8192)) return false; // binary marker missing or unknown extension
+
+    size = GCode::computeBinarySize((char*)position);
+    return size >= MIN_CMD_SIZE && size <= MAX_CMD_SIZE2 && size <= remaining;
+
+} // isPlausibleHeader
+
+
+/** \brief Searches the first offset at or behind from where a command starts.
+    A candidate must be followed by further valid commands or by the end of the data.
+    Returns length if no command start was found. */
+size_t BinaryDecoder::findCommandStart(const uint8_t* data, size_t length, size_t from)
+{
+    for (size_t offset = from; offset < length; offset++)
+    {
+        size_t  next = offset;
+        uint8_t size;
+        int     confirmed = 0;
+
+
+        while (confirmed <= CONFIRM_COMMANDS && isValidCommand(data + next, length - next, size))
+        {
+            next += size;
+            confirmed++;
+        }
+        if (confirmed > CONFIRM_COMMANDS || (confirmed && length - next <= MIN_CMD_SIZE))
+            return offset;
+    }
+    return length;
+
+} // findCommandStart
+
+
+/** \brief Decodes the records starting in the first limit bytes of input (length bytes) into
+    commands, at most capacity. Records are stepped like nextCommand() and their checksums are
+    verified DECODE_VERIFY_BATCH at a time, so the loop over the good records only decodes.
+    records receives offset, size and RecordStatus of every decoded record. A record whose status
+    is not RECORD_OK is always the only one or the first one of a batch: the decoder stops in
+    front of it and returns it alone in the next call. Messages printed for it therefore precede
+    the commands of that batch and its text (from a padded header) stays valid until the next
+    call. A command with a wrong checksum keeps the fields of the record in front of it, like
+    the GCode object reused by the original decoder. With a filter, good records it rejects are
+    skipped without being decoded and damaged ones are dropped after their messages, count may
+    then be 0 although bytes were consumed. Returns the number of bytes consumed. */
+size_t BinaryDecoder::decodeBatch(uint8_t* input, size_t length, size_t limit, GCode* commands, BatchRecord* records, size_t capacity, size_t& count,
+    DecoderContext& context, const CommandFilter* filter)
+{
+    size_t  offset = 0;
+    bool    lastDropped = false;    // the last record consumed was rejected, context.lastBinaryCommand holds it
+    size_t  offsets[DECODE_VERIFY_BATCH];
+    uint8_t sizes[DECODE_VERIFY_BATCH];
+    uint8_t valid[DECODE_VERIFY_BATCH];
+
+
+    if (filter && filter->empty()) filter = nullptr;
+    count = 0;
+    while (count < capacity && offset < limit && length - offset > MIN_CMD_SIZE)
+    {
+        size_t  chunk = 0;
+        bool    padded = false;
+        while (chunk < DECODE_VERIFY_BATCH && count + chunk < capacity && offset < limit && length - offset > MIN_CMD_SIZE)
+        {
+            uint8_t size = GCode::computeBinarySize((char*)(input + offset));
+            if (size > MAX_CMD_SIZE2 || size > length - offset)
+            {
+                padded = true;
+                break;
+            }
+            offsets[chunk] = offset;
+            sizes[chunk++] = size;
+            offset += size > MIN_CMD_SIZE ? size : MIN_CMD_SIZE;
+        }
+
+        size_t good = chunk;
+        if (Checksum::verifyCommands(input, length, offsets, sizes, chunk, valid) != chunk)
+            for (good = 0; valid[good]; good++) {}
+        if (!filter)
+        {
+            for (size_t i = 0; i < good; i++)
+            {
+                BatchRecord& record = records[count + i];
+                commands[count + i].decodeBinary(input + offsets[i], sizes[i], context);
+                record.offset = offsets[i];
+                record.size = sizes[i];
+                record.status = RECORD_OK;
+            }
+            count += good;
+        }
+        else
+        {
+            size_t kept = count;
+            for (size_t i = 0; i < good; i++)
+            {
+                if (!filter->matches(input + offsets[i])) continue;
+                BatchRecord& record = records[count];
+                commands[count++].decodeBinary(input + offsets[i], sizes[i], context);
+                record.offset = offsets[i];
+                record.size = sizes[i];
+                record.status = RECORD_OK;
+            }
+            // A damaged record behind a dropped one needs the fields of the dropped one
+            if (good && (count == kept || records[count - 1].offset != offsets[good - 1]))
+            {
+                context.lastBinaryCommand.decodeBinary(input + offsets[good - 1], sizes[good - 1], context);
+                lastDropped = true;
+            }
+            else if (good) lastDropped = false;
+        }
+        if (good == chunk && !padded) continue;
+
+        if (count) // the damaged record starts the next batch
+        {
+            if (good < chunk) offset = offsets[good];
+            break;
+        }
+
+        GCode&          command = commands[0];
+        BatchRecord&    record = records[0];
+        command = context.lastBinaryCommand;
+        if (good < chunk)
+        {
+            offset = offsets[good];
+            record.offset = offset;
+            record.size = sizes[good];
+            record.status = RECORD_BAD_CHECKSUM;
+            command.parseBinary(input + offset, record.size, false, context);
+            offset += record.size > MIN_CMD_SIZE ? record.size : MIN_CMD_SIZE;
+        }
+        else
+        {
+            uint8_t* paddedCommand;
+            record.offset = offset;
+            record.status = RECORD_BAD_HEADER;
+            offset += nextCommand(input + offset, length - offset, paddedCommand, record.size, context.paddedCommand);
+            command.parseBinary(paddedCommand, record.size, false, context);
+        }
+        count = 1;
+        lastDropped = false;
+        if (filter && !filter->matches(command))
+        {
+            context.lastBinaryCommand = command;
+            lastDropped = true;
+            count = 0;
+        }
+        break;
+    }
+    if (count && !lastDropped) context.lastBinaryCommand = commands[count - 1];
+    return offset;
+
+} // decodeBatch
+
+
+/** \brief Decodes and echoes all commands starting in [begin, end), with a filter only those
+    it accepts. Without filter every command is added to index as well. Returns the offset
+    behind the last decoded command. */
+size_t BinaryDecoder::decodeRange(MappedFile& file, size_t begin, size_t end, const CommandFilter* filter, FileIndex* index)
+{
+    uint8_t*        data = file.data();
+    size_t          fileSize = file.size();
+    size_t          offset = begin;
+    size_t          nextReadAhead = begin + READ_AHEAD_SIZE;
+    GCode           commands[DECODE_BATCH];
+    BatchRecord     records[DECODE_BATCH];
+    DecoderContext  context;
+
+
+    file.adviseWillNeed(begin, READ_AHEAD_SIZE);
+    while (offset < end && fileSize - offset > MIN_CMD_SIZE)
+    {
+        size_t count;
+        size_t base = offset;
+        offset += decodeBatch(data + base, fileSize - base, end - base, commands, records, DECODE_BATCH, count, context, filter);
+        if (index) index->add(commands, records, count, base);
+
+        if (offset >= nextReadAhead)
+        {
+            file.adviseWillNeed(nextReadAhead + READ_AHEAD_SIZE, READ_AHEAD_SIZE);
+            nextReadAhead += READ_AHEAD_SIZE;
+        }
+
+        for (size_t i = 0; i < count; i++)
+            commands[i].echoCommand();
+    }
+    return offset;
+
+} // decodeRange
+
+
+/** \brief Decodes and echoes the commands starting in the first end bytes of data (length
+    bytes) like decodeRange(). Texts are terminated in data, which the caller owns. Returns the
+    offset behind the last decoded command. */
+size_t BinaryDecoder::decodeBuffer(uint8_t* data, size_t length, size_t end, const CommandFilter* filter)
+{
+    size_t          offset = 0;
+    GCode           commands[DECODE_BATCH];
+    BatchRecord     records[DECODE_BATCH];
+    DecoderContext  context;
+
+
+    while (offset < end && length - offset > MIN_CMD_SIZE)
+    {
+        size_t count;
+        offset += decodeBatch(data + offset, length - offset, end - offset, commands, records, DECODE_BATCH, count, context, filter);
+        for (size_t i = 0; i < count; i++)
+            commands[i].echoCommand();
+    }
+    return offset;
+
+} // decodeBuffer
+
+
+/** \brief Checks the checksums of all commands starting in [begin, end) without decoding them.
+    Commands are stepped like in decodeRange() and verified in batches by Checksum::verifyCommands().
+    Returns the offset behind the last checked command. */
+size_t BinaryDecoder::verifyRange(MappedFile& file, size_t begin, size_t end, VerifyReport& report)
+{
+    const uint8_t*  data = file.data();
+    size_t          fileSize = file.size();
+    size_t          offset = begin;
+    size_t          nextReadAhead = begin;
+    size_t          offsets[VERIFY_BATCH];
+    uint8_t         sizes[VERIFY_BATCH];
+    uint8_t         valid[VERIFY_BATCH];
+
+
+    auto addError = [&report](size_t errorOffset)
+    {
+        report.errors++;
+        if (report.errorOffsets.size() < VERIFY_MAX_OFFSETS)
+            report.errorOffsets.push_back(errorOffset);
+    };
+
+    while (offset < end && fileSize - offset > MIN_CMD_SIZE)
+    {
+        size_t count = 0;
+        while (count < VERIFY_BATCH && offset < end && fileSize - offset > MIN_CMD_SIZE)
+        {
+            uint8_t size = GCode::computeBinarySize((char*)(data + offset));
+            report.commands++;
+            if (size > MAX_CMD_SIZE2 || size > fileSize - offset)
+            {
+                addError(offset);
+                offset += MIN_CMD_SIZE;
+                continue;
+            }
+            offsets[count] = offset;
+            sizes[count++] = size;
+            offset += size > MIN_CMD_SIZE ? size : MIN_CMD_SIZE;
+        }
+
+        if (offset >= nextReadAhead)
+        {
+            file.adviseWillNeed(nextReadAhead + READ_AHEAD_SIZE, READ_AHEAD_SIZE);
+            nextReadAhead += READ_AHEAD_SIZE;
+        }
+        if (Checksum::verifyCommands(data, fileSize, offsets, sizes, count, valid) == count) continue;
+        for (size_t i = 0; i < count; i++)
+            if (!valid[i]) addError(offsets[i]);
+    }
+    return offset;
+
+} // verifyRange
+
+
+/** \brief Appends the commands starting in [begin, end) to store, but at most maxCommands.
+    Commands are stepped like in decodeRange(), commands with a wrong checksum are counted in
+    store.errors. Returns the offset behind the last command, so that a large file can be
+    processed in batches of maxCommands records. */
+size_t BinaryDecoder::decodeColumns(MappedFile& file, size_t begin, size_t end, CommandStore& store, size_t maxCommands)
+{
+    const uint8_t*  data = file.data();
+    size_t          fileSize = file.size();
+    size_t          offset = begin;
+    size_t          nextReadAhead = begin + READ_AHEAD_SIZE;
+    size_t          count = 0;
+    uint8_t         paddedCommand[256];
+
+
+    file.adviseWillNeed(begin, READ_AHEAD_SIZE);
+    while (count < maxCommands && offset < end && fileSize - offset > MIN_CMD_SIZE)
+    {
+        uint8_t* command;
+        uint8_t  size;
+        size_t   start = offset;
+        offset += nextCommand((uint8_t*)data + offset, fileSize - offset, command, size, paddedCommand);
+
+        if (offset >= nextReadAhead)
+        {
+            file.adviseWillNeed(nextReadAhead + READ_AHEAD_SIZE, READ_AHEAD_SIZE);
+            nextReadAhead += READ_AHEAD_SIZE;
+        }
+
+        store.appendBinary(command, size, start);
+        count++;
+    }
+    return offset;
+
+} // decodeColumns
+
+
+/** \brief Decodes and echoes the commands starting in [begin, end) like decodeRange(), but never
+    trusts a damaged command. Runs of commands with plausible headers are verified in batches by
+    Checksum::verifyCommands(), which start small behind damage and grow while the data is clean.
+    The valid ones are decoded without checking them again. At the
+    first implausible header or wrong checksum the bytes up to the next confirmed command start
+    (findCommandStart()) are skipped and reported, a truncated command at the end of the file
+    is reported as well. With decode false the commands are only verified. Returns the offset
+    behind the last command or skipped range. */
+size_t BinaryDecoder::recoverRange(MappedFile& file, size_t begin, size_t end, RecoveryReport& report, bool decode)
+{
+    uint8_t*        data = file.data();
+    size_t          fileSize = file.size();
+    size_t          offset = begin;
+    size_t          nextReadAhead = begin + READ_AHEAD_SIZE;
+    size_t          batch = RECOVERY_FIRST_BATCH;
+    size_t          offsets[VERIFY_BATCH];
+    uint8_t         sizes[VERIFY_BATCH];
+    uint8_t         valid[VERIFY_BATCH];
+    DecoderContext  context;
+
+
+    file.adviseWillNeed(begin, READ_AHEAD_SIZE);
+    while (offset < end)
+    {
+        size_t count = 0;
+        size_t scan = offset;
+        while (count < batch && scan < end && isPlausibleHeader(data + scan, fileSize - scan, sizes[count]))
+        {
+            offsets[count] = scan;
+            scan += sizes[count++];
+        }
+        if (scan >= nextReadAhead)
+        {
+            file.adviseWillNeed(nextReadAhead + READ_AHEAD_SIZE, READ_AHEAD_SIZE);
+            nextReadAhead += READ_AHEAD_SIZE;
+        }
+
+        size_t good = count;
+        if (Checksum::verifyCommands(data, fileSize, offsets, sizes, count, valid) != count)
+            for (good = 0; valid[good]; good++) {}
+        for (size_t i = 0; i < good; i++)
+        {
+            if (!decode) continue;
+            GCode gcode;
+            gcode.decodeBinary(data + offsets[i], sizes[i], context);
+            gcode.echoCommand();
+        }
+        report.commands += good;
+        offset = good ? offsets[good - 1] + sizes[good - 1] : offset;
+        if (good == count && (count == batch || offset >= end))
+        {
+            batch = std::min(2 * batch, (size_t)VERIFY_BATCH);
+            continue;
+        }
+
+        // Damaged command at offset, the commands behind it are verified again after the resync
+        batch = RECOVERY_FIRST_BATCH;
+        size_t next = findCommandStart(data, fileSize, offset + 1);
+        if (report.skipped.size() < RECOVERY_MAX_RANGES)
+            report.skipped.push_back({ offset, next });
+        report.ranges++;
+        report.skippedBytes += next - offset;
+        offset = next;
+    }
+    return offset;
+
+} // recoverRange
@@ -0,0 +1,115 @@
+#pragma once
+
+#include "types.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class MappedFile;
+class CommandFilter;
+class CommandStore;
+class DecoderContext;
+class FileIndex;
+class GCode;
+
+const unsigned int MIN_CMD_SIZE = 5;
+const unsigned int MAX_CMD_SIZE2 = 128;
+
+/** \brief Outcome of one record of BinaryDecoder::decodeBatch(). */
+enum RecordStatus : uint8_t
+{
+    RECORD_OK = 0,          ///< Checksum correct, the command is decoded.
+    RECORD_BAD_CHECKSUM,    ///< Wrong checksum, the command keeps the fields of the record in front of it.
+    RECORD_BAD_HEADER       ///< Implausible size, only the 5 header bytes were consumed.
+};
+
+/** \brief Position and status of one record decoded by BinaryDecoder::decodeBatch(). */
+struct BatchRecord
+{
+    size_t      offset;     ///< Offset of the record in the input.
+    uint8_t     size;       ///< Size from the header.
+    uint8_t     status;     ///< RecordStatus.
+};
+
+/** \brief Input of BinaryDecoder::decodeBatch(): size bytes at data. */
+struct ByteSpan
+{
+    uint8_t*    data;
+    size_t      size;
+};
+
+/** \brief Output of BinaryDecoder::decodeBatch(): capacity commands and their records. */
+struct CommandSpan
+{
+    GCode*          commands;
+    BatchRecord*    records;
+    size_t          capacity;
+};
+
+/** \brief Result of BinaryDecoder::decodeBatch(): bytes consumed and commands decoded. */
+struct BatchResult
+{
+    size_t  consumed;
+    size_t  count;
+};
+
+/** \brief Result of BinaryDecoder::verifyRange(). */
+struct VerifyReport
+{
+    size_t              commands = 0;       ///< Number of commands checked.
+    size_t              errors = 0;         ///< Commands with wrong checksum or implausible size.
+    std::vector<size_t> errorOffsets;       ///< File offsets of the first errors.
+};
+
+/** \brief Bytes recoverRange() could not decode, [begin, end). */
+struct SkippedRange
+{
+    size_t  begin;
+    size_t  end;
+};
+
+/** \brief Result of BinaryDecoder::recoverRange(). */
+struct RecoveryReport
+{
+    size_t                      commands = 0;       ///< Commands with a plausible header and a correct checksum.
+    size_t                      ranges = 0;         ///< Number of skipped ranges.
+    size_t                      skippedBytes = 0;   ///< Bytes in all skipped ranges.
+    std::vector<SkippedRange>   skipped;            ///< The first skipped ranges.
+};
+
+/** \brief Walks a binary file command by command.
+
+All decode modes share nextCommand(), so that every mode steps over damaged headers
+exactly like the original reader did: a command with an implausible size consumes
+the 5 header bytes only. Each call decodes with its own DecoderContext. decodeBatch() is
+the building block of the modes which produce GCode objects: it decodes many commands
+per call and verifies their checksums together. The exception is
+recoverRange(), which skips damaged bytes up to the next confirmed command instead. */
+class BinaryDecoder
+{
+public:
+    static size_t nextCommand(uint8_t* position, size_t remaining, uint8_t*& command, uint8_t& size, uint8_t* paddedCommand);
+    static bool isPlausibleHeader(const uint8_t* position, size_t remaining, uint8_t& size);
+    static bool isValidCommand(const uint8_t* position, size_t remaining, uint8_t& size);
+    static size_t decodeBatch(uint8_t* input, size_t length, size_t limit, GCode* commands, BatchRecord* records, size_t capacity, size_t& count, DecoderContext& context,
+        const CommandFilter* filter = nullptr);
+
+    /** \brief decodeBatch() on spans: decodes the records starting in the first limit bytes of
+        input (all of them by default) into output. */
+    static inline BatchResult decodeBatch(ByteSpan input, CommandSpan output, DecoderContext& context, size_t limit = SIZE_MAX,
+        const CommandFilter* filter = nullptr)
+    {
+        BatchResult result;
+        result.consumed = decodeBatch(input.data, input.size, limit < input.size ? limit : input.size, output.commands, output.records, output.capacity,
+            result.count, context, filter);
+        return result;
+    } // decodeBatch
+
+    static size_t findCommandStart(const uint8_t* data, size_t length, size_t from);
+    static size_t decodeRange(MappedFile& file, size_t begin, size_t end, const CommandFilter* filter = nullptr, FileIndex* index = nullptr);
+    static size_t decodeBuffer(uint8_t* data, size_t length, size_t end, const CommandFilter* filter = nullptr);
+    static size_t verifyRange(MappedFile& file, size_t begin, size_t end, VerifyReport& report);
+    static size_t recoverRange(MappedFile& file, size_t begin, size_t end, RecoveryReport& report, bool decode = true);
+    static size_t decodeColumns(MappedFile& file, size_t begin, size_t end, CommandStore& store, size_t maxCommands = SIZE_MAX);
+
+}; // BinaryDecoder
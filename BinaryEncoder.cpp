@@ -0,0 +1,272 @@
+#include "BinaryEncoder.h"
+#include "BinaryDecoder.h"
+#include "BinaryLayout.h"
+#include "Communication.h"
+#include "DecoderContext.h"
+#include "MappedFile.h"
+#include "gcode.h"
+#include <condition_variable>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+/** Chunks which may be encoded ahead of the writer, per thread. */
+#define CHUNKS_AHEAD_PER_THREAD 2
+
+/** Number of error offsets kept in an EncodeReport. */
+#define ENCODE_MAX_OFFSETS 100
+
+/** Longest text of a V2 command, the length byte and the text take at most 80 bytes. */
+#define MAX_TEXT_V2 79
+
+/** Text size of a V1 command. */
+#define TEXT_SIZE_V1 16
+
+struct EncodedChunk
+{
+    std::unique_ptr<OutputSink> output;
+    EncodeReport                report;
+    bool                        done = false;
+};
+
+
+void EncodeReport::add(const EncodeReport& other)
+{
+    lines += other.lines;
+    commands += other.commands;
+    skipped += other.skipped;
+    errors += other.errors;
+    bytes += other.bytes;
+    for (size_t offset : other.errorOffsets)
+        if (errorOffsets.size() < ENCODE_MAX_OFFSETS) errorOffsets.push_back(offset);
+} // add
+
+
+/** \brief Writes gcode as binary command to command (at least MAX_CMD_SIZE2 bytes).
+    version 1 writes V1 commands where possible, version 2 always V2.
+    Returns the size of the command or 0 if it does not fit into MAX_CMD_SIZE2 bytes. */
+uint8_t BinaryEncoder::encodeCommand(GCode& gcode, uint8_t version, uint8_t* command)
+{
+    uint16_t    params = (uint16_t)((gcode.params & ~8192u) | 128);
+    uint16_t    params2 = (uint16_t)(gcode.params2 & 7);
+    size_t      textLength = 0;
+    uint8_t*    p = command;
+
+
+    if (gcode.hasString())
+    {
+        textLength = gcode.text ? strlen(gcode.text) : 0;
+        if (textLength > TEXT_SIZE_V1) params |= 4096;
+    }
+    if (version >= 2 || params2) params |= 4096;
+    bool v2 = (params & 4096) != 0;
+
+    BinaryLayout::setField<uint16_t>(p, params);
+    p += 2;
+    if (v2)
+    {
+        BinaryLayout::setField<uint16_t>(p, params2);
+        p += 2;
+        if (params & 32768)
+        {
+            if (textLength > MAX_TEXT_V2) textLength = MAX_TEXT_V2;
+            *p++ = (uint8_t)textLength;
+        }
+    }
+
+    // The size only depends on the header written so far
+    uint8_t size = BinaryLayout::size(command);
+    if (size > MAX_CMD_SIZE2) return 0;
+    memset(p, 0, size - (p - command));
+
+    const LowFieldLayout&   low = BinaryLayout::low(params);
+    const HighFieldLayout&  high = BinaryLayout::high(params);
+    const ExtFieldLayout&   ext = BinaryLayout::ext(params2);
+    uint8_t*                highFields = p + low.length;
+    uint8_t*                extFields = highFields + high.length;
+
+
+    if (params & 1) BinaryLayout::setField<uint16_t>(p + low.N, (uint16_t)gcode.N);
+    if (v2)
+    {
+        if (params & 2) BinaryLayout::setField<uint16_t>(p + low.M, (uint16_t)gcode.M);
+        if (params & 4) BinaryLayout::setField<uint16_t>(p + low.G, (uint16_t)gcode.G);
+    }
+    else
+    {
+        if (params & 2) p[low.M] = (uint8_t)gcode.M;
+        if (params & 4) p[low.G] = (uint8_t)gcode.G;
+    }
+    if (params & 8) BinaryLayout::setField<float>(p + low.X, gcode.X);
+    if (params & 16) BinaryLayout::setField<float>(p + low.Y, gcode.Y);
+    if (params & 32) BinaryLayout::setField<float>(p + low.Z, gcode.Z);
+    if (params & 64) BinaryLayout::setField<float>(p + low.E, gcode.E);
+    if (params & 256) BinaryLayout::setField<float>(highFields + high.F, gcode.F);
+    if (params & 512) highFields[high.T] = gcode.T;
+    if (params & 1024) BinaryLayout::setField<int32_t>(highFields + high.S, (int32_t)gcode.S);
+    if (params & 2048) BinaryLayout::setField<int32_t>(highFields + high.P, (int32_t)gcode.P);
+    if (params2 & 1) BinaryLayout::setField<float>(extFields + ext.I, gcode.I);
+    if (params2 & 2) BinaryLayout::setField<float>(extFields + ext.J, gcode.J);
+    if (params2 & 4) BinaryLayout::setField<float>(extFields + ext.R, gcode.R);
+    if (params & 32768)
+        memcpy(extFields + ext.length, gcode.text, v2 ? textLength : std::min(textLength, (size_t)TEXT_SIZE_V1));
+
+    unsigned int sum1, sum2;
+    GCode::computeFletcher16(command, size - 2, sum1, sum2);
+    command[size - 2] = (uint8_t)sum1;
+    command[size - 1] = (uint8_t)sum2;
+    return size;
+
+} // encodeCommand
+
+
+/** \brief Encodes the lines starting in [begin, end) of text and appends the commands to output.
+    Comments behind ';', empty lines and the line ends are dropped. Messages of parseAscii()
+    about rejected lines are discarded, the lines are counted in report. Returns the offset
+    behind the last line. */
+size_t BinaryEncoder::encodeRange(const char* text, size_t begin, size_t end, uint8_t version, OutputSink& output, EncodeReport& report)
+{
+    OutputSink      discard(OUTPUT_NONE, MAX_CMD_SIZE2 * 4);
+    OutputSink*     previousSink = Com::getThreadSink();
+    DecoderContext  context;
+    std::string     line;
+    size_t          offset = begin;
+
+
+    Com::setThreadSink(&discard);
+    while (offset < end)
+    {
+        const char* start = text + offset;
+        const char* newline = (const char*)memchr(start, '\n', end - offset);
+        const char* stop = newline ? newline : text + end;
+        size_t      lineOffset = offset;
+
+
+        offset = newline ? (size_t)(newline - text) + 1 : end;
+        report.lines++;
+
+        const char* comment = (const char*)memchr(start, ';', stop - start);
+        if (comment) stop = comment;
+        while (start < stop && (*start == ' ' || *start == '\t')) start++;
+        while (stop > start && (stop[-1] == ' ' || stop[-1] == '\t' || stop[-1] == '\r')) stop--;
+        if (start == stop)
+        {
+            report.skipped++;
+            continue;
+        }
+
+        GCode   gcode;
+        uint8_t size = 0;
+        line.assign(start, stop);
+        if (gcode.parseAscii(&line[0], false, context))
+        {
+            uint8_t* command = (uint8_t*)output.reserve(MAX_CMD_SIZE2);
+            size = encodeCommand(gcode, version, command);
+            output.commit(size);
+        }
+        if (!size)
+        {
+            report.errors++;
+            if (report.errorOffsets.size() < ENCODE_MAX_OFFSETS) report.errorOffsets.push_back(lineOffset);
+            continue;
+        }
+        report.commands++;
+        report.bytes += size;
+    }
+    Com::setThreadSink(previousSink);
+    return offset;
+
+} // encodeRange
+
+
+/** \brief Encodes the ASCII file input into the binary file output with threadCount threads.
+    The file is cut into chunks at line ends, the chunks are encoded in parallel and written
+    strictly in order, at most CHUNKS_AHEAD_PER_THREAD chunks per thread are held in memory.
+    Returns false if a file can not be opened. */
+bool BinaryEncoder::encodeFile(const char* input, const char* output, uint8_t version, unsigned int threadCount, EncodeReport& report, size_t chunkSize)
+{
+    MappedFile file;
+    OutputSink sink(OUTPUT_FILE);
+    if (!file.open(input) || !sink.openFile(output)) return false;
+
+    const char* text = (const char*)file.data();
+    size_t      fileSize = file.size();
+    if (threadCount < 2 || !chunkSize || fileSize <= chunkSize)
+    {
+        encodeRange(text, 0, fileSize, version, sink, report);
+        sink.closeFile();
+        return true;
+    }
+
+    size_t chunkCount = (fileSize + chunkSize - 1) / chunkSize;
+    std::vector<size_t> boundaries(chunkCount + 1);
+    boundaries[0] = 0;
+    for (size_t i = 1; i < chunkCount; i++)
+    {
+        // A chunk starts behind the line end at or after its nominal start
+        size_t      from = std::max(i * chunkSize, boundaries[i - 1] + 1) - 1;
+        const void* newline = memchr(text + from, '\n', fileSize - from);
+        boundaries[i] = newline ? (const char*)newline - text + 1 : fileSize;
+    }
+    boundaries[chunkCount] = fileSize;
+
+    std::vector<EncodedChunk> chunks(chunkCount);
+    std::mutex                mutex;
+    std::condition_variable   changed;
+    size_t                    nextChunk = 0;
+    size_t                    written = 0;
+    size_t                    window = (size_t)threadCount * CHUNKS_AHEAD_PER_THREAD;
+
+    auto worker = [&]()
+    {
+        for (;;)
+        {
+            size_t index;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                changed.wait(lock, [&] { return nextChunk >= chunkCount || nextChunk < written + window; });
+                if (nextChunk >= chunkCount) return;
+                index = nextChunk++;
+            }
+
+            // Binary commands are smaller than their text
+            EncodedChunk& chunk = chunks[index];
+            EncodeReport chunkReport;
+            std::unique_ptr<OutputSink> encoded(new OutputSink(OUTPUT_MEMORY, chunkSize));
+            encodeRange(text, boundaries[index], boundaries[index + 1], version, *encoded, chunkReport);
+
+            std::lock_guard<std::mutex> lock(mutex);
+            chunk.output = std::move(encoded);
+            chunk.report = std::move(chunkReport);
+            chunk.done = true;
+            changed.notify_all();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (unsigned int i = 0; i < threadCount; i++)
+        threads.emplace_back(worker);
+
+    for (size_t i = 0; i < chunkCount; i++)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        changed.wait(lock, [&] { return chunks[i].done; });
+        lock.unlock();
+
+        sink.write(chunks[i].output->data(), chunks[i].output->size());
+        report.add(chunks[i].report);
+        chunks[i].output.reset();
+
+        lock.lock();
+        written = i + 1;
+        changed.notify_all();
+    }
+
+    for (std::thread& thread : threads)
+        thread.join();
+    sink.closeFile();
+    return true;
+
+} // encodeFile
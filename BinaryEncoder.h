@@ -0,0 +1,38 @@
+#pragma once
+
+#include "types.h"
+#include <cstddef>
+#include <vector>
+
+class GCode;
+class OutputSink;
+
+#define ENCODER_CHUNK_SIZE (4 * 1024 * 1024)
+
+/** \brief Result of BinaryEncoder::encodeRange() and encodeFile(). */
+struct EncodeReport
+{
+    size_t              lines = 0;          ///< Lines read.
+    size_t              commands = 0;       ///< Binary commands written.
+    size_t              skipped = 0;        ///< Empty and comment lines.
+    size_t              errors = 0;         ///< Lines rejected by parseAscii() or too large to encode.
+    size_t              bytes = 0;          ///< Size of the binary output.
+    std::vector<size_t> errorOffsets;       ///< Input offsets of the first rejected lines.
+
+    void add(const EncodeReport& other);
+};
+
+/** \brief Converts ASCII G-code into binary commands for the Repetier protocol.
+
+Lines go through GCode::parseAscii(), so the accepted syntax is the one of the firmware.
+Every command is written as V1 unless it needs V2 (M or G above 255, I/J/R or a text of
+more than 16 characters) or version 2 is requested. Field offsets come from the same
+BinaryLayout tables the decoder uses and every command carries its Fletcher-16 checksum. */
+class BinaryEncoder
+{
+public:
+    static uint8_t encodeCommand(GCode& gcode, uint8_t version, uint8_t* command);
+    static size_t encodeRange(const char* text, size_t begin, size_t end, uint8_t version, OutputSink& output, EncodeReport& report);
+    static bool encodeFile(const char* input, const char* output, uint8_t version, unsigned int threadCount, EncodeReport& report, size_t chunkSize = ENCODER_CHUNK_SIZE);
+
+}; // BinaryEncoder
@@ -0,0 +1,160 @@
+#pragma once
+
+#include "types.h"
+#include <array>
+#include <cstring>
+
+/** \brief Field offsets of the low bitfield byte (N, M, G, X, Y, Z, E).
+    Offsets are relative to the first field behind the header. */
+struct LowFieldLayout
+{
+    uint8_t N, M, G, X, Y, Z, E, length;
+};
+
+/** \brief Field offsets of the high bitfield byte (F, T, S, P).
+    Offsets are relative to the end of the low byte fields. */
+struct HighFieldLayout
+{
+    uint8_t F, T, S, P, length;
+};
+
+/** \brief Field offsets of the V2 bitfield (I, J, R).
+    Offsets are relative to the end of the high byte fields. */
+struct ExtFieldLayout
+{
+    uint8_t I, J, R, length;
+};
+
+namespace BinaryLayoutTables
+{
+    constexpr std::array<LowFieldLayout, 512> makeLowFields()
+    {
+        std::array<LowFieldLayout, 512> table{};
+        for (unsigned int v2 = 0; v2 < 2; v2++)
+        {
+            for (unsigned int bits = 0; bits < 256; bits++)
+            {
+                LowFieldLayout& l = table[(v2 << 8) | bits];
+                uint8_t o = 0;
+                l.N = o; if (bits & 1) o += 2;
+                l.M = o; if (bits & 2) o += v2 ? 2 : 1;
+                l.G = o; if (bits & 4) o += v2 ? 2 : 1;
+                l.X = o; if (bits & 8) o += 4;
+                l.Y = o; if (bits & 16) o += 4;
+                l.Z = o; if (bits & 32) o += 4;
+                l.E = o; if (bits & 64) o += 4;
+                l.length = o;
+            }
+        }
+        return table;
+    }
+
+    constexpr std::array<HighFieldLayout, 256> makeHighFields()
+    {
+        std::array<HighFieldLayout, 256> table{};
+        for (unsigned int bits = 0; bits < 256; bits++)
+        {
+            HighFieldLayout& h = table[bits];
+            uint8_t o = 0;
+            h.F = o; if (bits & 1) o += 4;
+            h.T = o; if (bits & 2) o += 1;
+            h.S = o; if (bits & 4) o += 4;
+            h.P = o; if (bits & 8) o += 4;
+            h.length = o;
+        }
+        return table;
+    }
+
+    constexpr std::array<ExtFieldLayout, 8> makeExtFields()
+    {
+        std::array<ExtFieldLayout, 8> table{};
+        for (unsigned int bits = 0; bits < 8; bits++)
+        {
+            ExtFieldLayout& e = table[bits];
+            uint8_t o = 0;
+            e.I = o; if (bits & 1) o += 4;
+            e.J = o; if (bits & 2) o += 4;
+            e.R = o; if (bits & 4) o += 4;
+            e.length = o;
+        }
+        return table;
+    }
+} // namespace BinaryLayoutTables
+
+/** \brief Compile time lookup tables for the binary command layout.
+
+The 16 bit bitfield is split into its two bytes: lowFields is indexed by the V2 flag and
+the low byte, highFields by the high byte and extFields by the I/J/R bits of the V2
+bitfield. Three small tables (about 4 KB) replace a 64K entry table per field and stay
+in L1 cache while still giving every size and offset with one load per byte. */
+class BinaryLayout
+{
+public:
+    static constexpr std::array<LowFieldLayout, 512> lowFields = BinaryLayoutTables::makeLowFields();
+    static constexpr std::array<HighFieldLayout, 256> highFields = BinaryLayoutTables::makeHighFields();
+    static constexpr std::array<ExtFieldLayout, 8> extFields = BinaryLayoutTables::makeExtFields();
+
+    static inline uint16_t bitfield(const uint8_t* command)
+    {
+        uint16_t bits;
+        memcpy(&bits, command, 2);
+        return bits;
+    } // bitfield
+
+    static inline const LowFieldLayout& low(uint16_t bits)
+    {
+        return lowFields[((bits >> 4) & 256) | (bits & 255)];
+    } // low
+
+    static inline const HighFieldLayout& high(uint16_t bits)
+    {
+        return highFields[bits >> 8];
+    } // high
+
+    static inline const ExtFieldLayout& ext(uint16_t bits2)
+    {
+        return extFields[bits2 & 7];
+    } // ext
+
+    /** \brief Reads a field of type T from an unaligned position. */
+    template <typename T>
+    static inline T field(const uint8_t* position)
+    {
+        T value;
+        memcpy(&value, position, sizeof(T));
+        return value;
+    } // field
+
+    /** \brief Writes a field of type T to an unaligned position. */
+    template <typename T>
+    static inline void setField(uint8_t* position, T value)
+    {
+        memcpy(position, &value, sizeof(T));
+    } // setField
+
+    /** \brief Size of the fields and the header in front of them. */
+    static inline uint8_t headerSize(const uint8_t* command)
+    {
+        uint16_t bits = bitfield(command);
+        if (!(bits & 4096)) return 2;
+        return (bits & 32768) ? 5 : 4;
+    } // headerSize
+
+    /** \brief Size of the command including bitfields and checksum,
+        see GCode::computeBinarySize(). */
+    static inline uint8_t size(const uint8_t* command)
+    {
+        uint16_t     bits = bitfield(command);
+        unsigned int s = 4 + low(bits).length + high(bits).length;
+
+
+        if (bits & 4096)
+        {
+            s += 2 + ext(bitfield(command + 2)).length;
+            if (bits & 32768) s += std::min(80, command[4] + 1);
+        }
+        else if (bits & 32768) s += 16;
+        return (uint8_t)s;
+    } // size
+
+}; // BinaryLayout
@@ -0,0 +1,264 @@
+#include "Checksum.h"
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define CHECKSUM_X86 1
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif // _MSC_VER
+#else
+#define CHECKSUM_X86 0
+#endif // x86
+
+#if defined(__GNUC__) || defined(__clang__)
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define TARGET_AVX2
+#endif // __GNUC__
+
+/** Verifies the length bytes at command against the two bytes following them.
+    No byte at or behind limit is read. */
+typedef bool (*VerifyKernel)(const uint8_t* command, unsigned int length, const uint8_t* limit);
+
+
+/*
+The blocked loop of GCode::computeFletcher16() keeps both sums reduced modulo 255.
+For the at most 253 checked bytes of a command, the plain sums fit into 32 bits, so
+all kernels reduce only once at the end:
+
+  sum1 = b[0] + ... + b[n-1]
+  sum2 = n * b[0] + (n-1) * b[1] + ... + 1 * b[n-1]
+
+The vector kernels work on blocks of B bytes. For the block starting at j*B the
+weight n - i of a byte splits into the fixed weight B - k of its lane k plus
+n - (j+1)*B for the whole block, so every block needs one byte sum and one weighted
+sum with constant lane weights.
+*/
+static inline bool matches(unsigned int sum1, unsigned int sum2, const uint8_t* check)
+{
+    return (sum1 % 255) == check[0] && (sum2 % 255) == check[1];
+} // matches
+
+
+static bool verifyScalar(const uint8_t* command, unsigned int length, const uint8_t* /*limit*/)
+{
+    unsigned int sum1 = 0, sum2 = 0;
+
+
+    for (unsigned int i = 0; i < length; i++)
+    {
+        sum1 += command[i];
+        sum2 += sum1;
+    }
+    return matches(sum1, sum2, command + length);
+
+} // verifyScalar
+
+
+#if CHECKSUM_X86
+static bool verifySSE2(const uint8_t* command, unsigned int length, const uint8_t* limit)
+{
+    const __m128i   zero = _mm_setzero_si128();
+    const __m128i   weightsLow = _mm_setr_epi16(16, 15, 14, 13, 12, 11, 10, 9);
+    const __m128i   weightsHigh = _mm_setr_epi16(8, 7, 6, 5, 4, 3, 2, 1);
+    const __m128i   lane = _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    unsigned int    sum1 = 0, sum2 = 0;
+
+
+    for (unsigned int block = 0; block < length; block += 16)
+    {
+        unsigned int remaining = length - block;
+        __m128i      v;
+
+        if (command + block + 16 <= limit)
+        {
+            v = _mm_loadu_si128((const __m128i*)(command + block));
+            if (remaining < 16)
+                v = _mm_and_si128(v, _mm_cmplt_epi8(lane, _mm_set1_epi8((char)remaining)));
+        }
+        else
+        {
+            uint8_t tail[16] = { 0 };
+            memcpy(tail, command + block, remaining < 16 ? remaining : 16);
+            v = _mm_loadu_si128((const __m128i*)tail);
+        }
+
+        __m128i sad = _mm_sad_epu8(v, zero);
+        unsigned int s = (unsigned int)(_mm_cvtsi128_si32(sad) + _mm_cvtsi128_si32(_mm_srli_si128(sad, 8)));
+
+        __m128i w = _mm_add_epi32(_mm_madd_epi16(_mm_unpacklo_epi8(v, zero), weightsLow),
+                                  _mm_madd_epi16(_mm_unpackhi_epi8(v, zero), weightsHigh));
+        w = _mm_add_epi32(w, _mm_shuffle_epi32(w, _MM_SHUFFLE(1, 0, 3, 2)));
+        w = _mm_add_epi32(w, _mm_shuffle_epi32(w, _MM_SHUFFLE(2, 3, 0, 1)));
+
+        sum1 += s;
+        sum2 += (unsigned int)_mm_cvtsi128_si32(w) + (unsigned int)((int)remaining - 16) * s;
+    }
+    return matches(sum1, sum2, command + length);
+
+} // verifySSE2
+
+
+TARGET_AVX2 static bool verifyAVX2(const uint8_t* command, unsigned int length, const uint8_t* limit)
+{
+    const __m256i   zero = _mm256_setzero_si256();
+    const __m256i   ones = _mm256_set1_epi16(1);
+    const __m256i   weights = _mm256_setr_epi8(32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17,
+                                               16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1);
+    const __m256i   lane = _mm256_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+                                            16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31);
+    unsigned int    sum1 = 0, sum2 = 0;
+
+
+    for (unsigned int block = 0; block < length; block += 32)
+    {
+        unsigned int remaining = length - block;
+        __m256i      v;
+
+        if (command + block + 32 <= limit)
+        {
+            v = _mm256_loadu_si256((const __m256i*)(command + block));
+            if (remaining < 32)
+                v = _mm256_and_si256(v, _mm256_cmpgt_epi8(_mm256_set1_epi8((char)remaining), lane));
+        }
+        else
+        {
+            uint8_t tail[32] = { 0 };
+            memcpy(tail, command + block, remaining < 32 ? remaining : 32);
+            v = _mm256_loadu_si256((const __m256i*)tail);
+        }
+
+        __m256i sad = _mm256_sad_epu8(v, zero);
+        __m128i s128 = _mm_add_epi64(_mm256_castsi256_si128(sad), _mm256_extracti128_si256(sad, 1));
+        unsigned int s = (unsigned int)(_mm_cvtsi128_si32(s128) + _mm_cvtsi128_si32(_mm_srli_si128(s128, 8)));
+
+        __m256i w = _mm256_madd_epi16(_mm256_maddubs_epi16(v, weights), ones);
+        __m128i w128 = _mm_add_epi32(_mm256_castsi256_si128(w), _mm256_extracti128_si256(w, 1));
+        w128 = _mm_add_epi32(w128, _mm_shuffle_epi32(w128, _MM_SHUFFLE(1, 0, 3, 2)));
+        w128 = _mm_add_epi32(w128, _mm_shuffle_epi32(w128, _MM_SHUFFLE(2, 3, 0, 1)));
+
+        sum1 += s;
+        sum2 += (unsigned int)_mm_cvtsi128_si32(w128) + (unsigned int)((int)remaining - 32) * s;
+    }
+    return matches(sum1, sum2, command + length);
+
+} // verifyAVX2
+#endif // CHECKSUM_X86
+
+
+static const char* s_kernelName = "scalar";
+
+static VerifyKernel detectKernel()
+{
+#if CHECKSUM_X86
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+    {
+        s_kernelName = "avx2";
+        return verifyAVX2;
+    }
+    if (__builtin_cpu_supports("sse2"))
+    {
+        s_kernelName = "sse2";
+        return verifySSE2;
+    }
+#elif defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    int maxLeaf = info[0];
+    __cpuid(info, 1);
+    bool osxsave = (info[2] & (1 << 27)) != 0;
+    bool sse2 = (info[3] & (1 << 26)) != 0;
+    if (maxLeaf >= 7 && osxsave && (_xgetbv(0) & 6) == 6)
+    {
+        __cpuidex(info, 7, 0);
+        if (info[1] & (1 << 5))
+        {
+            s_kernelName = "avx2";
+            return verifyAVX2;
+        }
+    }
+    if (sse2)
+    {
+        s_kernelName = "sse2";
+        return verifySSE2;
+    }
+#endif // __GNUC__
+#endif // CHECKSUM_X86
+    return verifyScalar;
+
+} // detectKernel
+
+static VerifyKernel s_kernel = detectKernel();
+
+
+/** \brief Returns true if the checksum of the command of size bytes is correct.
+    Reads only the command itself. */
+bool Checksum::verify(const uint8_t* command, uint8_t size)
+{
+    if (size < 3) return false;
+    return s_kernel(command, size - 2u, command + size);
+} // verify
+
+
+/** \brief Verifies count commands of the data block in one call.
+    Commands may be read in full vector blocks as long as they stay in front of data + length.
+    The commands are still checked one after another, the vector kernels work within a command.
+    Packing several short commands into one vector would not pay off: the two sums of every
+    command would have to be extracted lane by lane again.
+    valid[i] receives 1 for a correct checksum, else 0. Returns the number of correct commands. */
+size_t Checksum::verifyCommands(const uint8_t* data, size_t length, const size_t* offsets, const uint8_t* sizes, size_t count, uint8_t* valid)
+{
+    const uint8_t*  limit = data + length;
+    VerifyKernel    kernel = s_kernel;
+    size_t          correct = 0;
+
+
+    for (size_t i = 0; i < count; i++)
+    {
+        bool ok = sizes[i] >= 3 && kernel(data + offsets[i], sizes[i] - 2u, limit);
+        valid[i] = ok;
+        correct += ok;
+    }
+    return correct;
+
+} // verifyCommands
+
+
+const char* Checksum::kernelName()
+{
+    return s_kernelName;
+} // kernelName
+
+
+/** \brief Forces a kernel ("scalar", "sse2" or "avx2"), e.g. to compare them in benchmarks.
+    Returns false if the kernel is unknown or not supported by this CPU. */
+bool Checksum::selectKernel(const char* name)
+{
+    if (!strcmp(name, "scalar"))
+    {
+        s_kernel = verifyScalar;
+        s_kernelName = "scalar";
+        return true;
+    }
+#if CHECKSUM_X86
+    VerifyKernel best = detectKernel();
+    if (!strcmp(name, "sse2"))
+    {
+        s_kernel = verifySSE2;
+        s_kernelName = "sse2";
+        return true;
+    }
+    if (!strcmp(name, "avx2") && best == verifyAVX2)
+    {
+        s_kernel = verifyAVX2;
+        s_kernelName = "avx2";
+        return true;
+    }
+    s_kernel = best;
+#endif // CHECKSUM_X86
+    return false;
+
+} // selectKernel
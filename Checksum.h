@@ -0,0 +1,20 @@
+#pragma once
+
+#include "types.h"
+#include <cstddef>
+
+/** \brief Fletcher-16 verification of binary commands.
+
+The checksum of a command is verified with the fastest kernel the CPU supports (AVX2,
+SSE2 or plain C++), chosen once at runtime. All kernels compute the same sums as
+GCode::computeFletcher16(). verifyCommands() saves the call overhead and the tail handling of
+the single verify(), but vectorizes within a command, not across commands. */
+class Checksum
+{
+public:
+    static bool verify(const uint8_t* command, uint8_t size);
+    static size_t verifyCommands(const uint8_t* data, size_t length, const size_t* offsets, const uint8_t* sizes, size_t count, uint8_t* valid);
+    static const char* kernelName();
+    static bool selectKernel(const char* name);
+
+}; // Checksum
@@ -0,0 +1,84 @@
+#include "CommandFilter.h"
+#include "gcode.h"
+#include <cstdlib>
+#include <cstring>
+
+
+/** \brief Reads a filter expression, see CommandFilter. Returns false on a syntax error,
+    the filter is empty then. */
+bool CommandFilter::parse(const char* expression)
+{
+    static const char       letters[] = "NMGXYZEFTSPIJR";
+    static const uint16_t   bits[] = { 1, 2, 4, 8, 16, 32, 64, 256, 512, 1024, 2048, 4096, 4096, 4096 };
+    static const uint16_t   bits2[] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 4 };
+    const char*             p = expression;
+
+
+    m_terms.clear();
+    m_anyParams = 0;
+    while (*p)
+    {
+        FilterTerm term = { 0, 0, -1, -1 };
+        for (;;)
+        {
+            if (!strncmp(p, "text", 4))
+            {
+                term.params |= 32768;
+                p += 4;
+            }
+            else
+            {
+                const char* letter = *p ? strchr(letters, *p) : nullptr;
+                if (!letter)
+                {
+                    m_terms.clear();
+                    return false;
+                }
+                term.params |= bits[letter - letters];
+                term.params2 |= bits2[letter - letters];
+                p++;
+                if ((*letter == 'M' || *letter == 'G') && *p >= '0' && *p <= '9')
+                {
+                    char* end;
+                    long  code = strtol(p, &end, 10);
+                    if (code > 65535 || (*letter == 'M' ? term.M : term.G) >= 0)
+                    {
+                        m_terms.clear();
+                        return false;
+                    }
+                    (*letter == 'M' ? term.M : term.G) = (int32_t)code;
+                    p = end;
+                }
+            }
+            if (*p != '+') break;
+            p++;
+        }
+        if (*p && *p != ',')
+        {
+            m_terms.clear();
+            return false;
+        }
+        if (*p) p++;
+        m_terms.push_back(term);
+        m_anyParams |= term.params;
+    }
+    return true;
+
+} // parse
+
+
+/** \brief Tests a decoded command, used for commands with a damaged header or checksum. */
+bool CommandFilter::matches(const GCode& command) const
+{
+    if (m_terms.empty()) return true;
+
+    for (const FilterTerm& term : m_terms)
+    {
+        if ((command.params & term.params) != term.params || (command.params2 & term.params2) != term.params2) continue;
+        if (term.M >= 0 && (int32_t)command.M != term.M) continue;
+        if (term.G >= 0 && (int32_t)command.G != term.G) continue;
+        return true;
+    }
+    return false;
+
+} // matches
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "types.h"
+#include "BinaryLayout.h"
+#include <vector>
+
+class GCode;
+
+/** \brief One alternative of a CommandFilter, all its conditions must hold. */
+struct FilterTerm
+{
+    uint16_t    params;     ///< Bits of the bitfield that must be set.
+    uint16_t    params2;    ///< Bits of the V2 bitfield that must be set.
+    int32_t     M;          ///< Required M code, -1 = any.
+    int32_t     G;          ///< Required G code, -1 = any.
+};
+
+/** \brief Selects commands by their bitfields and M and G codes before they are decoded.
+
+A filter is a comma separated list of terms, a command matches if one term matches. A term
+joins conditions with '+': a field letter (N M G X Y Z E F T S P I J R) requires the field,
+M or G followed by a number requires that code and text requires a string. "M104,M109,T"
+selects the temperature commands and tool changes, "G28,G29" homing and leveling and "G1+Z"
+moves changing Z. matches() reads only the bitfields and the M and G fields of a binary
+command, so commands that are dropped are never decoded or formatted. An empty filter
+matches every command. */
+class CommandFilter
+{
+public:
+    bool parse(const char* expression);
+    bool matches(const GCode& command) const;
+
+    inline bool empty() const
+    {
+        return m_terms.empty();
+    } // empty
+
+    /** \brief Tests a binary command with a correct checksum. */
+    inline bool matches(const uint8_t* command) const
+    {
+        if (m_terms.empty()) return true;
+
+        uint16_t bits = BinaryLayout::bitfield(command);
+        if (!(bits & m_anyParams)) return false;
+
+        bool            v2 = (bits & 4096) != 0;
+        uint16_t        bits2 = v2 ? BinaryLayout::bitfield(command + 2) : 0;
+        const uint8_t*  fields = command + (v2 ? ((bits & 32768) ? 5 : 4) : 2);
+        for (const FilterTerm& term : m_terms)
+        {
+            if ((bits & term.params) != term.params || (bits2 & term.params2) != term.params2) continue;
+            const LowFieldLayout& low = BinaryLayout::low(bits);
+            if (term.M >= 0 && (int32_t)(v2 ? BinaryLayout::field<uint16_t>(fields + low.M) : fields[low.M]) != term.M) continue;
+            if (term.G >= 0 && (int32_t)(v2 ? BinaryLayout::field<uint16_t>(fields + low.G) : fields[low.G]) != term.G) continue;
+            return true;
+        }
+        return false;
+    } // matches
+
+private:
+    std::vector<FilterTerm> m_terms;
+    uint16_t                m_anyParams = 0;    ///< Union of the required bits, a command without any of them fails every term.
+
+}; // CommandFilter
@@ -0,0 +1,200 @@
+#include "CommandStore.h"
+#include "BinaryLayout.h"
+#include "Checksum.h"
+#include <cfloat>
+#include <cstring>
+
+/** Number of independent accumulators used by the column scans. */
+#define SCAN_LANES 8
+
+
+CommandStore::CommandStore()
+    : errors(0)
+{
+    textArena.push_back(0);
+} // CommandStore
+
+
+void CommandStore::reserve(size_t count)
+{
+    params.reserve(count);
+    params2.reserve(count);
+    N.reserve(count);
+    M.reserve(count);
+    G.reserve(count);
+    X.reserve(count);
+    Y.reserve(count);
+    Z.reserve(count);
+    E.reserve(count);
+    F.reserve(count);
+    T.reserve(count);
+    S.reserve(count);
+    P.reserve(count);
+    I.reserve(count);
+    J.reserve(count);
+    R.reserve(count);
+    textOffset.reserve(count);
+    offset.reserve(count);
+} // reserve
+
+
+/** \brief Removes all records, the capacity of the columns is kept for the next batch. */
+void CommandStore::clear()
+{
+    params.clear();
+    params2.clear();
+    N.clear();
+    M.clear();
+    G.clear();
+    X.clear();
+    Y.clear();
+    Z.clear();
+    E.clear();
+    F.clear();
+    T.clear();
+    S.clear();
+    P.clear();
+    I.clear();
+    J.clear();
+    R.clear();
+    textOffset.clear();
+    offset.clear();
+    textArena.resize(1);
+    errors = 0;
+} // clear
+
+
+/** \brief Decodes one binary command into a new record, see GCode::parseBinary().
+    The command is not modified. Returns false and counts an error if the checksum is wrong. */
+bool CommandStore::appendBinary(const uint8_t* command, uint8_t size, size_t sourceOffset)
+{
+    if (!Checksum::verify(command, size))
+    {
+        errors++;
+        return false;
+    }
+
+    const uint8_t*  p = command;
+    uint16_t        bits = BinaryLayout::bitfield(p);
+    uint16_t        bits2 = 0;
+    uint8_t         textlen = 16;
+    bool            v2 = (bits & 4096) != 0;
+
+
+    p += 2;
+    if (v2)
+    {
+        bits2 = BinaryLayout::bitfield(p);
+        p += 2;
+        if (bits & 32768)
+            textlen = *p++;
+    }
+
+    const LowFieldLayout&   low = BinaryLayout::low(bits);
+    const HighFieldLayout&  high = BinaryLayout::high(bits);
+    const ExtFieldLayout&   ext = BinaryLayout::ext(bits2);
+    const uint8_t*          highFields = p + low.length;
+    const uint8_t*          extFields = highFields + high.length;
+
+
+    params.push_back(bits);
+    params2.push_back(bits2);
+    N.push_back((bits & 1) ? BinaryLayout::field<uint16_t>(p + low.N) : 0);
+    if (v2)
+    {
+        M.push_back((bits & 2) ? BinaryLayout::field<uint16_t>(p + low.M) : 0);
+        G.push_back((bits & 4) ? BinaryLayout::field<uint16_t>(p + low.G) : 0);
+    }
+    else
+    {
+        M.push_back((bits & 2) ? p[low.M] : 0);
+        G.push_back((bits & 4) ? p[low.G] : 0);
+    }
+    X.push_back((bits & 8) ? BinaryLayout::field<float>(p + low.X) : 0);
+    Y.push_back((bits & 16) ? BinaryLayout::field<float>(p + low.Y) : 0);
+    Z.push_back((bits & 32) ? BinaryLayout::field<float>(p + low.Z) : 0);
+    E.push_back((bits & 64) ? BinaryLayout::field<float>(p + low.E) : 0);
+    F.push_back((bits & 256) ? BinaryLayout::field<float>(highFields + high.F) : 0);
+    T.push_back((bits & 512) ? highFields[high.T] : 0);
+    S.push_back((bits & 1024) ? BinaryLayout::field<int32_t>(highFields + high.S) : 0);
+    P.push_back((bits & 2048) ? BinaryLayout::field<int32_t>(highFields + high.P) : 0);
+    I.push_back((bits2 & 1) ? BinaryLayout::field<float>(extFields + ext.I) : 0);
+    J.push_back((bits2 & 2) ? BinaryLayout::field<float>(extFields + ext.J) : 0);
+    R.push_back((bits2 & 4) ? BinaryLayout::field<float>(extFields + ext.R) : 0);
+    offset.push_back(sourceOffset);
+
+    if (bits & 32768)
+    {
+        // Same bounds as the terminator written by parseBinary()
+        const char* text = (const char*)(extFields + ext.length);
+        int         available = (int)size - 2 - (int)((const uint8_t*)text - command);
+        size_t      length = textlen > available ? (available > 0 ? (size_t)available : 0) : textlen;
+
+
+        length = strnlen(text, length);
+        textOffset.push_back((uint32_t)textArena.size());
+        textArena.insert(textArena.end(), text, text + length);
+        textArena.push_back(0);
+    }
+    else textOffset.push_back(0);
+    return true;
+
+} // appendBinary
+
+
+/** \brief Sum of the E column. Absent values are 0, so no bitfield test is needed. */
+double CommandStore::sumE() const
+{
+    const float*    e = E.data();
+    size_t          count = E.size();
+    size_t          i = 0;
+    double          lanes[SCAN_LANES] = {};
+    double          sum = 0;
+
+
+    for (; i + SCAN_LANES <= count; i += SCAN_LANES)
+        for (int lane = 0; lane < SCAN_LANES; lane++)
+            lanes[lane] += e[i + lane];
+    for (; i < count; i++)
+        sum += e[i];
+    for (int lane = 0; lane < SCAN_LANES; lane++)
+        sum += lanes[lane];
+    return sum;
+
+} // sumE
+
+
+/** \brief Smallest and largest X, Y and Z of all G0/G1 moves which have the axis. Other
+    commands with these letters (M201 limits, G92, G28) are not positions of the head. */
+CommandBounds CommandStore::boundingBox() const
+{
+    const std::vector<float>*   axes[3] = { &X, &Y, &Z };
+    const uint16_t*             bits = params.data();
+    const uint16_t*             g = G.data();
+    size_t                      count = params.size();
+    CommandBounds               bounds;
+
+
+    for (int axis = 0; axis < 3; axis++)
+    {
+        const float*    v = axes[axis]->data();
+        uint16_t        mask = (uint16_t)(8 << axis);
+        float           lo = FLT_MAX;
+        float           hi = -FLT_MAX;
+
+
+        for (size_t i = 0; i < count; i++)
+        {
+            bool  move = (bits[i] & (mask | 6)) == (mask | 4) && g[i] <= 1;
+            float low = move ? v[i] : FLT_MAX;
+            float high = move ? v[i] : -FLT_MAX;
+            lo = low < lo ? low : lo;
+            hi = high > hi ? high : hi;
+        }
+        bounds.min[axis] = lo;
+        bounds.max[axis] = hi;
+        bounds.valid[axis] = lo <= hi;
+    }
+    return bounds;
+
+} // boundingBox
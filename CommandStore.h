@@ -0,0 +1,70 @@
+#pragma once
+
+#include "types.h"
+#include <cstddef>
+#include <vector>
+
+/** \brief Result of CommandStore::boundingBox(). */
+struct CommandBounds
+{
+    float   min[3];         ///< Smallest X, Y and Z of the G0/G1 moves which have the axis.
+    float   max[3];         ///< Largest X, Y and Z of the G0/G1 moves which have the axis.
+    bool    valid[3];       ///< false if no move has the axis.
+};
+
+/** \brief Decoded commands stored column by column.
+
+Every field of GCode has its own contiguous array, record i of the store is element i of
+all columns. params and params2 are the bitfields of the binary command and tell which
+fields are present, absent fields are stored as 0 so that sums can run over a column
+without looking at the bitfields. Texts are kept in one arena, textOffset points to the
+zero terminated text of a record and is 0 (an empty text) for records without one. */
+class CommandStore
+{
+public:
+    std::vector<uint16_t>   params;
+    std::vector<uint16_t>   params2;
+    std::vector<uint16_t>   N;
+    std::vector<uint16_t>   M;
+    std::vector<uint16_t>   G;
+    std::vector<float>      X;
+    std::vector<float>      Y;
+    std::vector<float>      Z;
+    std::vector<float>      E;
+    std::vector<float>      F;
+    std::vector<uint8_t>    T;
+    std::vector<int32_t>    S;
+    std::vector<int32_t>    P;
+    std::vector<float>      I;
+    std::vector<float>      J;
+    std::vector<float>      R;
+    std::vector<uint32_t>   textOffset;
+    std::vector<size_t>     offset;         ///< Offset of the command in the decoded data.
+    std::vector<char>       textArena;
+    size_t                  errors;         ///< Commands rejected by appendBinary() since the last clear().
+
+    CommandStore();
+
+    void reserve(size_t count);
+    void clear();
+    bool appendBinary(const uint8_t* command, uint8_t size, size_t sourceOffset);
+
+    double sumE() const;
+    CommandBounds boundingBox() const;
+
+    inline size_t size() const
+    {
+        return params.size();
+    } // size
+
+    inline bool has(size_t index, uint16_t bit) const
+    {
+        return (params[index] & bit) != 0;
+    } // has
+
+    inline const char* text(size_t index) const
+    {
+        return &textArena[textOffset[index]];
+    } // text
+
+}; // CommandStore
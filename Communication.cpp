@@ -19,6 +19,8 @@
 #include "types.h"
 #include "Communication.h"
 #include <iostream>
+#include <cstring>
+#include <cmath>
 
 //FSTRINGVALUE(Com::tFirmware, "FIRMWARE_NAME:Repetier_" REPETIER_VERSION " FIRMWARE_URL:https://github.com/RF1000/Repetier-Firmware/ PROTOCOL_VERSION:1.0 MACHINE_TYPE:Mendel EXTRUDER_COUNT:" XSTR(NUM_EXTRUDER) " REPETIER_PROTOCOL:2")
 
@@ -380,8 +382,7 @@ void Com::printFLN(FSTRINGPARAM(text), const char* msg)
 
 void Com::printF(FSTRINGPARAM(ptr))
 {
-    std::cout << ptr;
-    writeToFile(ptr);
+    out().write(ptr.data(), ptr.size());
     //char c;
     //while ((c = HAL::readFlashByte(ptr++)) != 0)
     //    HAL::serialWriteByte(c);
@@ -453,11 +454,18 @@ void Com::printF(FSTRINGPARAM(text), float value, uint8_t digits)
     printFloat(value, digits);
 } // printF
 
-std::ofstream Com::m_fstream;
+OutputSink Com::m_sink;
+thread_local OutputSink* Com::m_threadSink = nullptr;
 void Com::print(const char* text)
 {
-    std::cout << text;
-    writeToFile(text);
+    out().write(text, strlen(text));
+} // print
+
+
+void Com::print(int value)
+{
+    char buf[12];
+    out().write(buf, formatInt(buf, value) - buf);
 } // print
 
 
@@ -474,19 +482,8 @@ void Com::print(long value)
 
 void Com::printNumber(uint32_t n)
 {
-    char buf[11]; // Assumes 8-bit chars plus zero byte.
-    char* str = &buf[10];
-
-
-    *str = '\0';
-    do
-    {
-        unsigned long m = n;
-        n /= 10;
-        *--str = '0' + (m - 10 * n);
-    } while (n);
-
-    print(str);
+    char buf[10];
+    out().write(buf, formatNumber(buf, n) - buf);
 } // printNumber
 
 
@@ -510,48 +507,117 @@ void Com::printArrayFLN(FSTRINGPARAM(text), long* arr, uint8_t n)
 
 void Com::printFloat(float number, uint8_t digits)
 {
-    if (isnan(number))
+    char* start = out().reserve(FORMAT_FLOAT_SIZE(digits));
+    out().commit(formatFloat(start, number, digits) - start);
+} // printFloat
+
+
+/** \brief Writes the decimal digits of n to dst and returns the position behind them. */
+char* Com::formatNumber(char* dst, uint32_t n)
+{
+    uint32_t length = 1;
+    for (uint32_t rest = n; rest >= 10; rest /= 10)
+        length++;
+
+    char* end = dst + length;
+    char* str = end;
+    do
     {
-        printF(tNAN);
-        return;
+        uint32_t m = n;
+        n /= 10;
+        *--str = '0' + (char)(m - 10 * n);
+    } while (n);
+
+    return end;
+} // formatNumber
+
+
+char* Com::formatInt(char* dst, int value)
+{
+    if (value < 0)
+    {
+        *dst++ = '-';
+        return formatNumber(dst, 0u - (unsigned int)value);
+    }
+    return formatNumber(dst, (unsigned int)value);
+} // formatInt
+
+
+/** \brief Rounding offsets for up to 8 digits, computed exactly like formatFloat() did per call. */
+static const struct FloatRounding
+{
+    float value[9];
+
+    FloatRounding()
+    {
+        for (uint8_t digits = 0; digits < 9; digits++)
+        {
+            float rounding = 0.5;
+            for (uint8_t i = 0; i < digits; ++i)
+                rounding /= 10.0;
+            value[digits] = rounding;
+        }
     }
-    if (isinf(number))
+} floatRounding;
+
+
+/** \brief Formats number with the given number of digits behind the decimal point into dst and
+    returns the position behind the last character, at most FORMAT_FLOAT_SIZE(digits) characters.
+    The float arithmetic is the one of the former per digit printFloat(), so the text is the same. */
+char* Com::formatFloat(char* dst, float number, uint8_t digits)
+{
+    if (std::isnan(number))
+    {
+        memcpy(dst, tNAN.data(), tNAN.size());
+        return dst + tNAN.size();
+    }
+    if (std::isinf(number))
     {
-        printF(tINF);
-        return;
+        memcpy(dst, tINF.data(), tINF.size());
+        return dst + tINF.size();
     }
 
     // Handle negative numbers
     if (number < 0.0)
     {
-        print('-');
+        *dst++ = '-';
         number = -number;
     }
 
     // Round correctly so that print(1.999, 2) prints as "2.00"
-    float rounding = 0.5;
-    for (uint8_t i = 0; i < digits; ++i)
-        rounding /= 10.0;
+    float rounding;
+    if (digits < 9)
+    {
+        rounding = floatRounding.value[digits];
+    }
+    else
+    {
+        rounding = 0.5;
+        for (uint8_t i = 0; i < digits; ++i)
+            rounding /= 10.0;
+    }
 
     number += rounding;
 
-    // Extract the integer part of the number and print it
+    // Extract the integer part of the number
     unsigned long	int_part = (unsigned long)number;
     float			remainder = number - (float)int_part;
 
 
-    printNumber(int_part);
+    dst = formatNumber(dst, (uint32_t)int_part);
 
-    // Print the decimal point, but only if there are digits beyond
+    // The decimal point, but only if there are digits beyond
     if (digits > 0)
-        print('.');
+        *dst++ = '.';
 
     // Extract digits from the remainder one at a time
     while (digits-- > 0)
     {
         remainder *= 10.0;
-        int toPrint = int(remainder);
-        print(toPrint);
-        remainder -= toPrint;
+        int toDigit = int(remainder);
+        if (toDigit >= 0 && toDigit < 10) *dst++ = '0' + (char)toDigit;
+        else dst = formatInt(dst, toDigit);
+        remainder -= toDigit;
     }
-} // printFloat
+    return dst;
+} // formatFloat
@@ -20,10 +20,15 @@
 #define COMMUNICATION_H
 
 #include "types.h"
+#include "OutputSink.h"
 #include <iostream>
 #include <fstream>
 #include <string>
 
+/** Maximum number of characters written by Com::formatFloat() for the given number of digits.
+    A fractional digit takes one character unless the number is out of the range of unsigned long. */
+#define FORMAT_FLOAT_SIZE(digits) (12 + 11 * (digits))
+
 class Com
 {
 public:
@@ -324,21 +329,23 @@ FSTRINGVAR(tFindZOrigin)
 FSTRINGVAR(tTestStrainGauge)
 #endif // FEATURE_TEST_STRAIN_GAUGE
 
-static std::ofstream m_fstream;
+static OutputSink m_sink;							///< Output of the decoder, see initialize().
+static thread_local OutputSink* m_threadSink;		///< Replaces m_sink for the calling thread, if set.
 
-static void initialize()
+/** \brief Sets the targets of the output, returns false if the file at path can not be created. */
+static bool initialize(const char* path = "data_decoded.gcode", uint8_t targets = OUTPUT_BOTH)
 {
-	m_fstream.open("data_decoded.gcode", std::ios::out);
+	m_sink.setTargets(targets);
+	return !(targets & OUTPUT_FILE) || m_sink.openFile(path);
 }
 
-static void writeToFile(const std::string& text)
-{
-	//m_fstream << text;
-	if (m_fstream.is_open())
-	{
-		m_fstream.write(text.c_str(), text.length());
-	}
-}
+static inline OutputSink& out() { return m_threadSink ? *m_threadSink : m_sink; }
+static inline void setThreadSink(OutputSink* sink) { m_threadSink = sink; }
+static inline OutputSink* getThreadSink() { return m_threadSink; }
+static inline void write(const char* text, size_t length) { out().write(text, length); }
+static void flush() { m_sink.flush(); }
+static void finish() { m_sink.closeFile(); m_sink.flush(); }
+
     static void printNumber(uint32_t n);
 	static void printWarningF(FSTRINGPARAM(text));
 	static void printInfoF(FSTRINGPARAM(text));
@@ -362,11 +369,15 @@ static void writeToFile(const std::string& text)
 	static void printArrayFLN(FSTRINGPARAM(text), long* arr, uint8_t n = 4);
 	static void print(long value);
 	static inline void print(uint32_t value) { printNumber(value); }
-	static inline void print(int value) { std::cout << std::to_string(value); writeToFile(std::to_string(value)); }
+	static void print(int value);
 	static void print(const char* text);
-	static inline void print(char c) { std::cout << c; std::string s; s.push_back(c); writeToFile(s); }
+	static inline void print(char c) { out().put(c); }
 	static void printFloat(float number, uint8_t digits);
-	static inline void println() { std::cout << std::endl; writeToFile("\n"); }
+	static inline void println() { out().put('\n'); }
+
+	static char* formatNumber(char* dst, uint32_t n);
+	static char* formatInt(char* dst, int value);
+	static char* formatFloat(char* dst, float number, uint8_t digits);
 
 }; // Com
 
@@ -0,0 +1,353 @@
+#include "CorpusDeduplicator.h"
+#include "BinaryDecoder.h"
+#include "Communication.h"
+#include "DecoderContext.h"
+#include "MappedFile.h"
+#include "OutputSink.h"
+#include "gcode.h"
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+/** Base of the polynomial hashes over line hashes. */
+#define DEDUP_HASH_BASE 0x100000001b3ull
+
+/** Commands decoded per decodeBatch() call for the end sequence. */
+#define DEDUP_BATCH 256
+
+
+/** \brief Spreads the bits of a hash, so that the smallest values of a sketch are a fair sample. */
+static inline uint64_t mixHash(uint64_t value)
+{
+    value ^= value >> 30;
+    value *= 0xbf58476d1ce4e5b9ull;
+    value ^= value >> 27;
+    value *= 0x94d049bb133111ebull;
+    value ^= value >> 31;
+    return value;
+} // mixHash
+
+
+SequenceTable::SequenceTable(size_t capacity)
+    : m_capacity(capacity ? capacity : 1)
+{
+} // SequenceTable
+
+
+/** \brief FNV-1a hash of one canonical line. */
+uint64_t SequenceTable::hashLine(const char* text, size_t length)
+{
+    uint64_t hash = 0xcbf29ce484222325ull;
+
+
+    for (size_t i = 0; i < length; i++)
+    {
+        hash ^= (uint8_t)text[i];
+        hash *= 0x100000001b3ull;
+    }
+    return mixHash(hash);
+
+} // hashLine
+
+
+uint64_t SequenceTable::hashSequence(const std::vector<uint64_t>& hashes)
+{
+    uint64_t hash = hashes.size();
+
+
+    for (uint64_t line : hashes)
+        hash = hash * DEDUP_HASH_BASE + line;
+    return mixHash(hash);
+
+} // hashSequence
+
+
+/** \brief The DEDUP_SKETCH_SIZE smallest hashes of all lines and all windows of DEDUP_SHINGLE
+    lines, sorted. The windows matter for the order, the lines keep a single changed command
+    from changing every shingle that covers it. */
+std::vector<uint64_t> SequenceTable::sketch(const std::vector<uint64_t>& hashes)
+{
+    std::vector<uint64_t>   shingles;
+    uint64_t                power = 1;      // DEDUP_HASH_BASE ^ (DEDUP_SHINGLE - 1)
+    uint64_t                rolling = 0;
+    size_t                  window = std::min<size_t>(DEDUP_SHINGLE, hashes.size());
+
+
+    if (hashes.empty()) return shingles;
+    for (size_t i = 1; i < window; i++)
+        power *= DEDUP_HASH_BASE;
+    shingles.reserve(2 * hashes.size());
+    for (size_t i = 0; i < hashes.size(); i++)
+    {
+        shingles.push_back(mixHash(hashes[i] ^ 0x5555555555555555ull));
+        if (i >= window) rolling -= hashes[i - window] * power;
+        rolling = rolling * DEDUP_HASH_BASE + hashes[i];
+        if (i + 1 >= window) shingles.push_back(mixHash(rolling));
+    }
+
+    std::sort(shingles.begin(), shingles.end());
+    shingles.erase(std::unique(shingles.begin(), shingles.end()), shingles.end());
+    if (shingles.size() > DEDUP_SKETCH_SIZE) shingles.resize(DEDUP_SKETCH_SIZE);
+    return shingles;
+
+} // sketch
+
+
+/** \brief Estimates the share of common shingles of two sketches in percent: of the smallest
+    DEDUP_SKETCH_SIZE hashes of both, the ones found in both. An empty sketch matches nothing. */
+unsigned int SequenceTable::similarity(const std::vector<uint64_t>& a, const std::vector<uint64_t>& b)
+{
+    size_t  i = 0, j = 0;
+    size_t  considered = 0, common = 0;
+
+
+    if (a.empty() || b.empty()) return 0;
+    while (considered < DEDUP_SKETCH_SIZE && (i < a.size() || j < b.size()))
+    {
+        if (j == b.size() || (i < a.size() && a[i] < b[j])) i++;
+        else if (i == a.size() || b[j] < a[i]) j++;
+        else
+        {
+            common++;
+            i++;
+            j++;
+        }
+        considered++;
+    }
+    return (unsigned int)(100 * common / considered);
+
+} // similarity
+
+
+/** \brief Returns the index of an empty cluster, evicting the one with the fewest files if the
+    table is full. */
+size_t SequenceTable::newCluster()
+{
+    if (m_clusters.size() < m_capacity)
+    {
+        m_clusters.emplace_back();
+        return m_clusters.size() - 1;
+    }
+
+    size_t victim = 0;
+    for (size_t i = 1; i < m_clusters.size(); i++)
+        if (m_clusters[i].files < m_clusters[victim].files) victim = i;
+    for (uint64_t hash : m_clusters[victim].variants)
+        m_exact.erase(hash);
+    m_evictedClusters++;
+    m_evictedFiles += m_clusters[victim].files;
+    m_clusters[victim] = SequenceCluster();
+    return victim;
+
+} // newCluster
+
+
+void SequenceTable::add(const CommandSequence& sequence)
+{
+    uint64_t hash = hashSequence(sequence.hashes);
+
+
+    m_files++;
+    auto exact = m_exact.find(hash);
+    if (exact != m_exact.end())
+    {
+        m_clusters[exact->second].files++;
+        return;
+    }
+
+    std::vector<uint64_t>   shingles = sketch(sequence.hashes);
+    size_t                  best = SIZE_MAX;
+    unsigned int            bestSimilarity = 0;
+    for (size_t i = 0; i < m_clusters.size(); i++)
+    {
+        unsigned int value = similarity(shingles, m_clusters[i].sketch);
+        if (value >= DEDUP_SIMILARITY && value > bestSimilarity)
+        {
+            best = i;
+            bestSimilarity = value;
+        }
+    }
+    if (best != SIZE_MAX)
+    {
+        SequenceCluster& cluster = m_clusters[best];
+        cluster.files++;
+        cluster.distinct++;
+        if (cluster.variants.size() < DEDUP_MAX_VARIANTS)
+        {
+            cluster.variants.push_back(hash);
+            m_exact[hash] = best;
+        }
+        return;
+    }
+
+    size_t           index = newCluster();
+    SequenceCluster& cluster = m_clusters[index];
+    cluster.lines = sequence.lines;
+    cluster.sketch = std::move(shingles);
+    cluster.variants.push_back(hash);
+    cluster.files = 1;
+    cluster.distinct = 1;
+    m_exact[hash] = index;
+
+} // add
+
+
+/** \brief The clusters with the most files first. */
+std::vector<const SequenceCluster*> SequenceTable::sorted() const
+{
+    std::vector<const SequenceCluster*> result;
+
+
+    for (const SequenceCluster& cluster : m_clusters)
+        result.push_back(&cluster);
+    std::stable_sort(result.begin(), result.end(), [](const SequenceCluster* a, const SequenceCluster* b) { return a->files > b->files; });
+    return result;
+
+} // sorted
+
+
+/** \brief Decodes the canonical startup and end sequence of the file at path.
+    Uses the thread sink of Com for formatting and resets it. Returns false if the file can
+    not be mapped. */
+bool CorpusDeduplicator::analyzeFile(const char* path, const StartupOptions& options, CommandSequence& startup, CommandSequence& end)
+{
+    OutputSink      scratch(OUTPUT_MEMORY, 4096);
+    StartupState    modes;      // positioning modes at the end of the startup sequence
+
+
+    auto append = [&scratch](GCode& command, uint8_t status, CommandSequence& sequence)
+    {
+        scratch.clear(); // also drops the messages of damaged commands
+        if (status != RECORD_OK || sequence.lines.size() >= DEDUP_MAX_COMMANDS) return;
+
+        command.params &= ~1u; // without line number
+        command.printCommand();
+        const char* text = scratch.data();
+        size_t      length = scratch.size();
+        while (length && (text[length - 1] == '\n' || text[length - 1] == '\r' || text[length - 1] == ' ')) length--;
+        sequence.lines.emplace_back(text, length);
+        sequence.hashes.push_back(SequenceTable::hashLine(text, length));
+    };
+
+    startup = CommandSequence();
+    end = CommandSequence();
+    Com::setThreadSink(&scratch);
+
+    // parseBinary() terminates texts in the mapping, so each part gets a fresh one
+    {
+        MappedFile file;
+        if (!file.open(path, MAPPED_PARTIAL))
+        {
+            Com::setThreadSink(nullptr);
+            return false;
+        }
+
+        StartupOptions  limited = options;
+        StartupReport   report;
+        limited.maxCommands = std::min<size_t>(options.maxCommands, DEDUP_MAX_COMMANDS);
+        StartupExtractor::extractFile(file, limited, report, [&](GCode& command, uint8_t status)
+        {
+            if (status == RECORD_OK) modes.apply(command);
+            append(command, status, startup);
+        });
+    }
+    {
+        MappedFile file;
+        if (!file.open(path, MAPPED_PARTIAL))
+        {
+            Com::setThreadSink(nullptr);
+            return false;
+        }
+
+        uint8_t*        data = file.data();
+        size_t          fileSize = file.size();
+        size_t          suffix = fileSize > DEDUP_SUFFIX_SIZE ? fileSize - DEDUP_SUFFIX_SIZE : 0;
+        size_t          offset = 0;
+        GCode           commands[DEDUP_BATCH];
+        BatchRecord     records[DEDUP_BATCH];
+        DecoderContext  context;
+        StartupState    state;
+
+
+        // Only the window is read, the pages in front of it are never touched
+        file.adviseWillNeed(suffix, DEDUP_SUFFIX_SIZE);
+        if (suffix) offset = BinaryDecoder::findCommandStart(data, fileSize, suffix);
+
+        // In the middle of the file the E position in front of the window is not known
+        if (offset)
+        {
+            state.relative = modes.relative;
+            state.relativeE = modes.relativeE;
+            state.eKnown = false;
+        }
+        while (offset < fileSize && fileSize - offset > MIN_CMD_SIZE)
+        {
+            BatchResult batch = BinaryDecoder::decodeBatch({ data + offset, fileSize - offset }, { commands, records, DEDUP_BATCH }, context);
+
+            offset += batch.consumed;
+            for (size_t i = 0; i < batch.count; i++)
+            {
+                if (records[i].status == RECORD_OK && state.apply(commands[i]))
+                {
+                    end.lines.clear();
+                    end.hashes.clear();
+                    continue;
+                }
+                append(commands[i], records[i].status, end);
+            }
+        }
+    }
+    Com::setThreadSink(nullptr);
+    return true;
+
+} // analyzeFile
+
+
+/** \brief Clusters the startup and end sequences of every .gco file below directory. */
+void CorpusDeduplicator::analyzeDirectory(const char* directory, const StartupOptions& options, unsigned int threadCount, DedupReport& report)
+{
+    std::vector<std::string> files;
+    if (!StartupExtractor::findFiles(directory, files))
+    {
+        report.failed++;
+        report.failures.push_back(directory);
+    }
+    if (!threadCount) threadCount = 1;
+
+    for (size_t first = 0; first < files.size(); first += DEDUP_BLOCK_FILES)
+    {
+        size_t                          count = std::min<size_t>(DEDUP_BLOCK_FILES, files.size() - first);
+        std::vector<CommandSequence>    startups(count), ends(count);
+        std::vector<uint8_t>            mapped(count);
+        std::atomic<size_t>             nextFile(0);
+
+        auto worker = [&]()
+        {
+            for (size_t index = nextFile++; index < count; index = nextFile++)
+                mapped[index] = analyzeFile(files[first + index].c_str(), options, startups[index], ends[index]);
+        };
+
+        std::vector<std::thread> threads;
+        for (unsigned int i = 1; i < std::min<size_t>(threadCount, count); i++)
+            threads.emplace_back(worker);
+        worker();
+        for (std::thread& thread : threads)
+            thread.join();
+
+        for (size_t index = 0; index < count; index++)
+        {
+            report.files++;
+            if (!mapped[index])
+            {
+                report.failed++;
+                if (report.failures.size() < STARTUP_MAX_FAILURES) report.failures.push_back(files[first + index]);
+                continue;
+            }
+            if (startups[index].lines.empty()) report.withoutStartup++;
+            else report.startup.add(startups[index]);
+            if (ends[index].lines.empty()) report.withoutEnd++;
+            else report.end.add(ends[index]);
+        }
+    }
+
+} // analyzeDirectory
@@ -0,0 +1,132 @@
+#pragma once
+
+#include "types.h"
+#include "StartupExtractor.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/** Clusters a SequenceTable keeps, the one with the fewest files is evicted when a new one needs room. */
+#define DEDUP_MAX_CLUSTERS 1024
+
+/** Commands kept of one startup or end sequence. */
+#define DEDUP_MAX_COMMANDS 512
+
+/** Exact variants remembered per cluster, further variants are matched by their sketch. */
+#define DEDUP_MAX_VARIANTS 64
+
+/** Commands hashed together into one shingle of the rolling hash, single commands are shingles as well. */
+#define DEDUP_SHINGLE 2
+
+/** Smallest shingle hashes kept as sketch of a sequence. */
+#define DEDUP_SKETCH_SIZE 32
+
+/** Estimated share of common shingles from which two sequences are near-identical, in percent.
+    One changed command of 16 leaves about 80 percent. */
+#define DEDUP_SIMILARITY 70
+
+/** Bytes at the end of a file searched for the end sequence. */
+#define DEDUP_SUFFIX_SIZE (64 * 1024)
+
+/** Files decoded in parallel before their sequences are added to the tables in file order. */
+#define DEDUP_BLOCK_FILES 256
+
+/** \brief A canonical command sequence: one line per command, printed without line number. */
+struct CommandSequence
+{
+    std::vector<std::string>    lines;
+    std::vector<uint64_t>       hashes;     ///< Hash of every line.
+};
+
+/** \brief Identical or near-identical sequences, represented by the first one seen. */
+struct SequenceCluster
+{
+    std::vector<std::string>    lines;          ///< The first sequence of the cluster.
+    std::vector<uint64_t>       sketch;         ///< Smallest shingle hashes of lines, sorted.
+    std::vector<uint64_t>       variants;       ///< Hashes of the distinct sequences seen, at most DEDUP_MAX_VARIANTS.
+    size_t                      files = 0;
+    size_t                      distinct = 0;   ///< Distinct sequences in the cluster.
+};
+
+/** \brief Clusters command sequences in bounded memory.
+
+Every sequence is hashed as a whole with a polynomial hash over its line hashes, an identical
+sequence is found by that hash alone. A new sequence gets a bottom-k sketch of its line hashes
+and of the rolling hashes of all windows of DEDUP_SHINGLE commands and joins the cluster whose
+sketch shares at least DEDUP_SIMILARITY percent, so a changed temperature or an inserted
+command does not open a new cluster. The table holds at most capacity clusters with one sequence each; when it is
+full the cluster with the fewest files is dropped and counted in evictedFiles. */
+class SequenceTable
+{
+public:
+    explicit SequenceTable(size_t capacity = DEDUP_MAX_CLUSTERS);
+
+    void add(const CommandSequence& sequence);
+    std::vector<const SequenceCluster*> sorted() const;
+
+    inline size_t files() const
+    {
+        return m_files;
+    } // files
+
+    inline size_t evictedClusters() const
+    {
+        return m_evictedClusters;
+    } // evictedClusters
+
+    inline size_t evictedFiles() const
+    {
+        return m_evictedFiles;
+    } // evictedFiles
+
+    static uint64_t hashLine(const char* text, size_t length);
+
+private:
+    static uint64_t hashSequence(const std::vector<uint64_t>& hashes);
+    static std::vector<uint64_t> sketch(const std::vector<uint64_t>& hashes);
+    static unsigned int similarity(const std::vector<uint64_t>& a, const std::vector<uint64_t>& b);
+    size_t newCluster();
+
+    size_t                                  m_capacity;
+    std::vector<SequenceCluster>            m_clusters;
+    std::unordered_map<uint64_t, size_t>    m_exact;            ///< Hash of a sequence to its cluster.
+    size_t                                  m_files = 0;
+    size_t                                  m_evictedClusters = 0;
+    size_t                                  m_evictedFiles = 0;
+
+}; // SequenceTable
+
+/** \brief Result of CorpusDeduplicator::analyzeDirectory(). */
+struct DedupReport
+{
+    size_t                      files = 0;
+    size_t                      failed = 0;
+    std::vector<std::string>    failures;       ///< The first files that could not be mapped.
+    size_t                      withoutStartup = 0; ///< Files without a command in front of the terminator.
+    size_t                      withoutEnd = 0;     ///< Files without a command behind the last extruding move.
+    SequenceTable               startup;
+    SequenceTable               end;
+};
+
+/** \brief Finds the distinct startup and end sequences of all binary files below a directory.
+
+The startup sequence is decoded with StartupExtractor up to its terminator, the end sequence
+from a command start found in the last DEDUP_SUFFIX_SIZE bytes: it is everything behind the
+last extruding move. The state in front of that window is not decoded. The window starts in the
+positioning modes the startup sequence ended with, so a G90/G91 or M82/M83 between the two is
+missed unless it is repeated in the window. In absolute E mode a move only counts as extruding
+once a G92 E or an absolute E move in the window gave the E position; earlier G92 E resets do
+not matter. Commands are made canonical by dropping the line number and printing
+them with printCommand(), damaged commands are left out. An empty sequence is not added to
+the table but counted in withoutStartup or withoutEnd. Files are decoded on threadCount
+threads in blocks of DEDUP_BLOCK_FILES and added to the tables in file order, so the result
+does not depend on the number of threads. */
+class CorpusDeduplicator
+{
+public:
+    static void analyzeDirectory(const char* directory, const StartupOptions& options, unsigned int threadCount, DedupReport& report);
+    static bool analyzeFile(const char* path, const StartupOptions& options, CommandSequence& startup, CommandSequence& end);
+
+}; // CorpusDeduplicator
@@ -0,0 +1,463 @@
+#include "DecoderContext.h"
+#include "BinaryLayout.h"
+#include "Communication.h"
+#include <cstring>
+
+
+DecoderContext::DecoderContext(size_t queueCapacity)
+    : commandsBuffered(queueCapacity), commandsReceivingWritePosition(0), sendAsBinary(0),
+      wasLastCommandReceivedAsBinary(0), commentDetected(false), binaryCommandSize(0),
+      waitUntilAllCommandsAreParsed(false), lastLineNumber(0), actLineNumber(0),
+      timeOfLastDataPacket(0), formatErrors(0), lastBusySignal(0), waitingForResend(-1)
+{
+    memset(commandReceiving, 0, sizeof(commandReceiving));
+    memset(&lastBinaryCommand, 0, sizeof(lastBinaryCommand));
+} // DecoderContext
+
+
+void DecoderContext::requestResend()
+{
+} // requestResend
+
+
+/** \brief Check if result is plausible. Returns true if the command has to be executed.
+    If not, a resend and ok is send. */
+bool DecoderContext::checkCommand(GCode* act)
+{
+    if (act->hasM())
+    {
+        if (act->M == 110)   // Reset line number
+        {
+            lastLineNumber = actLineNumber;
+            Com::printFLN(Com::tOk);
+            waitingForResend = -1;
+            return false;
+        }
+        if (act->M == 112)   // Emergency kill - freeze printer
+        {
+            //Commands::emergencyStop();
+        }
+#ifdef DEBUG_COM_ERRORS
+        if (act->M == 666)
+        {
+            lastLineNumber++;
+            return false;
+        }
+#endif // DEBUG_COM_ERRORS
+    }
+    if (act->hasN())
+    {
+        if (((lastLineNumber + 1) & 0xffff) != (actLineNumber & 0xffff))
+        {
+            if (waitingForResend < 0)   // after a resend, we have to skip the garbage in buffers, no message for this
+            {
+                    Com::printF(Com::tExpectedLine, lastLineNumber + 1);
+                    Com::printFLN(Com::tGot, actLineNumber);
+                requestResend(); // Line missing, force resend
+            }
+            else
+            {
+                --waitingForResend;
+                commandsReceivingWritePosition = 0;
+                Com::printFLN(Com::tSkip, actLineNumber);
+                Com::printFLN(Com::tOk);
+            }
+            return false;
+        }
+        lastLineNumber = actLineNumber;
+    }
+    return true;
+
+} // checkCommand
+
+
+/** \brief Check if result is plausible. If it is, an ok is send and the command is stored in queue.
+    If not, a resend and ok is send. */
+void DecoderContext::checkAndPushCommand(GCode* act)
+{
+    if (checkCommand(act)) pushCommand();
+} // checkAndPushCommand
+
+
+void DecoderContext::pushCommand()
+{
+    commandsBuffered.push();
+} // pushCommand
+
+
+/** \brief Get the next buffered command. Returns 0 if no more commands are buffered. For each
+    returned command, the popCurrentCommand() function must be called. */
+GCode* DecoderContext::peekCurrentCommand()
+{
+    return commandsBuffered.front(); // NULL if no more data
+
+} // peekCurrentCommand
+
+
+/** \brief Removes the last returned command from cache. */
+void DecoderContext::popCurrentCommand()
+{
+#if DEBUG_COMMAND_PEEK
+    Com::printFLN(PSTR("popCurrentCommand(): pop"));
+#endif // DEBUG_COMMAND_PEEK
+
+    GCode* act = commandsBuffered.front();
+    if (!act) return; // Should not happen, but safety first
+
+#ifdef ECHO_ON_EXECUTE
+    act->echoCommand();
+#endif // ECHO_ON_EXECUTE
+
+    commandsBuffered.pop();
+
+} // popCurrentCommand
+
+
+/** \brief Read from serial console
+    This function is the main function to read the commands from serial console.
+    It must be called frequently to empty the incoming buffer. */
+void DecoderContext::readFromSerial()
+{
+    GCode* act = commandsBuffered.back();
+    if (!act || (waitUntilAllCommandsAreParsed && !commandsBuffered.empty()))
+    {
+        // all buffers full
+        return;
+    }
+
+    waitUntilAllCommandsAreParsed = false;
+    while (commandsReceivingWritePosition < MAX_CMD_SIZE)    // consume data until no data or buffer full
+    {
+        uint8_t         byte = 0;//TODO get byte
+        ReceiveResult   result = receiveByte(byte, *act);
+
+        if (result == RECEIVE_COMMAND) pushCommand();
+        if (result != RECEIVE_MORE) return;
+    }
+    readFromSD();
+
+} // readFromSerial
+
+
+/** \brief Consumes length bytes received from a serial line, socket or pipe and calls handler
+    with every command completed on the way. A command which is not complete at the end of data
+    is kept in commandReceiving and completed by the next call, so data may be cut anywhere. */
+void DecoderContext::feed(const uint8_t* data, size_t length, const CommandHandler& handler)
+{
+    GCode act;
+    feedBytes(data, length, act, [&handler](GCode& command)
+    {
+        handler(command);
+        return true;
+    });
+} // feed
+
+
+/** \brief Like feed() with a handler, but stores the completed commands in commands. Stops when
+    capacity commands are stored or in front of the next command once a command refers to text in
+    the receive buffer, which the next command reuses. Returns the number of bytes consumed, the
+    rest has to be fed again. */
+size_t DecoderContext::feed(const uint8_t* data, size_t length, GCode* commands, size_t capacity, size_t& count)
+{
+    count = 0;
+    if (!capacity) return 0;
+
+    const char* receiving = (const char*)commandReceiving;
+    GCode       act;
+    return feedBytes(data, length, act, [&](GCode& command)
+    {
+        commands[count++] = command;
+        bool textInBuffer = command.hasString() && command.text >= receiving && command.text < receiving + MAX_CMD_SIZE;
+        return count < capacity && !textInBuffer;
+    });
+} // feed
+
+
+/** \brief Common part of both feed() functions. Complete binary commands are parsed where they are
+    in data, only a command cut by the end of data, ASCII lines and commands with text go through
+    commandReceiving. deliver gets every accepted command in act and returns false to stop.
+    Returns the number of bytes consumed. */
+template <typename Deliver>
+size_t DecoderContext::feedBytes(const uint8_t* data, size_t length, GCode& act, Deliver deliver)
+{
+    size_t offset = 0;
+
+
+    while (offset < length)
+    {
+        const uint8_t* record = data + offset;
+        size_t         remaining = length - offset;
+
+        if (!commandsReceivingWritePosition && remaining >= 5 && (record[0] & 128) && !(waitingForResend >= 0 && wasLastCommandReceivedAsBinary))
+        {
+            uint8_t size = BinaryLayout::size(record);
+            if (size <= MAX_CMD_SIZE && size <= remaining)
+            {
+                // parseBinary() writes to the buffer only to terminate a text
+                uint8_t* command = (uint8_t*)record;
+                if (BinaryLayout::field<uint16_t>(record) & 32768)
+                {
+                    memcpy(commandReceiving, record, size);
+                    command = commandReceiving;
+                }
+                offset += size;
+                if (completeCommand(act, act.parseBinary(command, size, true, *this), false) == RECEIVE_COMMAND && !deliver(act))
+                    return offset;
+                continue;
+            }
+        }
+
+        offset++;
+        if (receiveByte(*record, act) == RECEIVE_COMMAND && !deliver(act))
+            return offset;
+    }
+    return offset;
+
+} // feedBytes
+
+
+/** \brief Serial state machine, adds byte to the command in commandReceiving. Detects ASCII and
+    binary commands, skips zeros to get in sync after a resend and parses the command into act
+    when it is complete. */
+DecoderContext::ReceiveResult DecoderContext::receiveByte(uint8_t byte, GCode& act)
+{
+    if (!commandsReceivingWritePosition)
+    {
+        memset(commandReceiving, 0, sizeof(commandReceiving));
+    }
+    commandReceiving[commandsReceivingWritePosition++] = byte;
+
+    // first lets detect, if we got an old type ascii command
+    if (commandsReceivingWritePosition == 1)
+    {
+        if (waitingForResend >= 0 && wasLastCommandReceivedAsBinary)
+        {
+            if (!commandReceiving[0])
+                waitingForResend--;   // Skip 30 zeros to get in sync
+            else
+                waitingForResend = 30;
+            commandsReceivingWritePosition = 0;
+            return RECEIVE_MORE;
+        }
+        if (!commandReceiving[0]) // Ignore zeros
+        {
+            commandsReceivingWritePosition = 0;
+            return RECEIVE_MORE;
+        }
+        sendAsBinary = (commandReceiving[0] & 128) != 0;
+    }
+    if (sendAsBinary)
+    {
+        if (commandsReceivingWritePosition < 2) return RECEIVE_MORE;
+        if (commandsReceivingWritePosition == 5 || commandsReceivingWritePosition == 4)
+            binaryCommandSize = GCode::computeBinarySize((char*)commandReceiving);
+        if (commandsReceivingWritePosition == binaryCommandSize)
+        {
+            ReceiveResult result = completeCommand(act, act.parseBinary(commandReceiving, binaryCommandSize, true, *this), false);
+            commandsReceivingWritePosition = 0;
+            return result;
+        }
+    }
+    else     // Ascii command
+    {
+        char ch = commandReceiving[commandsReceivingWritePosition - 1];
+        if (ch == 0 || ch == '\n' || ch == '\r' || (!commentDetected && ch == ':'))  // complete line read
+        {
+            commandReceiving[commandsReceivingWritePosition - 1] = 0;
+            commentDetected = false;
+            if (commandsReceivingWritePosition == 1)   // empty line ignore
+            {
+                commandsReceivingWritePosition = 0;
+                return RECEIVE_MORE;
+            }
+            ReceiveResult result = completeCommand(act, act.parseAscii((char*)commandReceiving, true, *this), true);
+            commandsReceivingWritePosition = 0;
+            return result;
+        }
+        else
+        {
+            if (ch == ';') commentDetected = true; // ignore new data until lineend
+            if (commentDetected) commandsReceivingWritePosition--;
+        }
+    }
+    if (commandsReceivingWritePosition == MAX_CMD_SIZE)
+    {
+        // Line too long, drop it and start over with the resend
+        requestResend();
+        commandsReceivingWritePosition = 0;
+        commentDetected = false;
+        return RECEIVE_DONE;
+    }
+    return RECEIVE_MORE;
+
+} // receiveByte
+
+
+/** \brief Checks a command parsed from serial. Returns RECEIVE_COMMAND if it has to be executed,
+    a command with a format error requests a resend up to three times and is skipped then. */
+DecoderContext::ReceiveResult DecoderContext::completeCommand(GCode& act, bool parsed, bool ascii)
+{
+    if (parsed)
+        return checkCommand(&act) ? RECEIVE_COMMAND : RECEIVE_DONE;
+
+    if (formatErrors < 3)
+    {
+        requestResend();
+    }
+    else
+    {
+        // we have to give up
+#ifdef ACK_WITH_LINENUMBER
+        Com::printFLN(Com::tOkSpace, actLineNumber);
+#else
+        Com::printFLN(Com::tOk);
+#endif // ACK_WITH_LINENUMBER
+
+        waitingForResend = -1; // everything is (quasi) ok
+        lastLineNumber++;
+        if (ascii) formatErrors = 0;
+    }
+    return RECEIVE_DONE;
+
+} // completeCommand
+
+
+/** \brief Read from sdcard.
+This function is the main function to read the commands from sdcard. */
+void DecoderContext::readFromSD()
+{
+#if SDSUPPORT
+    if (!sd.sdmode || commandsReceivingWritePosition != 0)		// not reading or incoming serial command
+        return;
+
+    if (g_uBlockSDCommands)									// no further commands from the SD card shall be processed
+        return;
+
+    if (!PrintLine::checkForXFreeLines(2))
+    {
+        // we do not read G-Codes from the SD card until the cache is full -
+        // when we leave a small space within the cache the PC is able to exchange commands faster (this effect is relevant only in case of G-Codes whose processing takes a noticeable amount of time, e.g. long and/or slow lines)
+        return;
+    }
+
+    while (sd.filesize > sd.sdpos&& commandsReceivingWritePosition < MAX_CMD_SIZE)    // consume data until no data or buffer full
+    {
+        timeOfLastDataPacket = HAL::timeInMilliseconds();
+        int n = sd.file.read();
+
+        if (n == -1)
+        {
+            if (Printer::debugErrors())
+            {
+                Com::printFLN(Com::tSDReadError);
+            }
+            UI_ERROR("SD Read Error");
+
+            // Second try in case of recoverable errors
+            sd.file.seekSet(sd.sdpos);
+            n = sd.file.read();
+
+            if (n == -1)
+            {
+                if (Printer::debugErrors())
+                {
+                    Com::printErrorFLN(PSTR("SD error did not recover!"));
+                }
+                sd.sdmode = false;
+                break;
+            }
+            UI_ERROR("SD error fixed");
+        }
+        sd.sdpos++; // = file.curPosition();
+        commandReceiving[commandsReceivingWritePosition++] = (uint8_t)n;
+
+        // first lets detect, if we got an old type ascii command
+        if (commandsReceivingWritePosition == 1 && !commentDetected)
+        {
+            sendAsBinary = (commandReceiving[0] & 128) != 0;
+        }
+        if (sendAsBinary)
+        {
+            if (commandsReceivingWritePosition < 2) continue;
+            if (commandsReceivingWritePosition == 4 || commandsReceivingWritePosition == 5)
+                binaryCommandSize = GCode::computeBinarySize((char*)commandReceiving);
+            if (commandsReceivingWritePosition == binaryCommandSize)
+            {
+                GCode* act = commandsBuffered.back();
+                if (act->parseBinary(commandReceiving, binaryCommandSize, false, *this))
+                {
+                    // Success, silently ignore illegal commands
+                    pushCommand();
+                    //                  Com::printF(PSTR("Current binary from SD: "));
+                    //                  act->printCommand();
+                }
+                commandsReceivingWritePosition = 0;
+                return;
+            }
+        }
+        else
+        {
+            char ch = commandReceiving[commandsReceivingWritePosition - 1];
+            bool returnChar = ch == '\n' || ch == '\r';
+            if (returnChar || sd.filesize == sd.sdpos || (!commentDetected && ch == ':') || commandsReceivingWritePosition >= (MAX_CMD_SIZE - 1))  // complete line read
+            {
+                //Com::printF(PSTR("Parse SD ascii 1 >>>"));
+                //Com::print((char*)commandReceiving);
+                //Com::printFLN(PSTR("<<<"));
+
+                if (returnChar || ch == ':')
+                    commandReceiving[commandsReceivingWritePosition - 1] = 0;
+                else
+                    commandReceiving[commandsReceivingWritePosition] = 0;
+                commentDetected = false;
+                if (commandsReceivingWritePosition == 1)   // empty line ignore
+                {
+                    commandsReceivingWritePosition = 0;
+                    memset(commandReceiving, 0, sizeof(commandReceiving));
+                    continue;
+                }
+
+                //Com::printF(PSTR("Parse SD ascii 2 >>>"));
+                //Com::print((char*)commandReceiving);
+                //Com::printFLN(PSTR("<<<"));
+
+                GCode* act = commandsBuffered.back();
+                if (act->parseAscii((char*)commandReceiving, false, *this))
+                {
+                    // Success
+                    pushCommand();
+                    //Com::printF(PSTR("Current ASCII from SD: "));
+                    //act->printCommand();
+                }
+                commandsReceivingWritePosition = 0;
+                //memset( commandReceiving, 0, sizeof( commandReceiving ) );
+
+                //Com::printF(PSTR("Verify: "));
+                //act->printCommand();
+                return;
+            }
+            else
+            {
+                /*				Com::printF(PSTR("Parse SD ascii 3 >>>"));
+                                Com::print((char*)commandReceiving);
+                                Com::printFLN(PSTR("<<<"));
+                */
+                if (ch == ';') commentDetected = true; // ignore new data until lineend
+                if (commentDetected) commandsReceivingWritePosition--;
+            }
+        }
+    }
+    sd.sdmode = false;
+
+    if (Printer::debugInfo())
+    {
+        Com::printFLN(Com::tDonePrinting);
+    }
+    commandsReceivingWritePosition = 0;
+    commentDetected = false;
+    Printer::setMenuMode(MENU_MODE_SD_PRINTING, false);
+
+    BEEP_STOP_PRINTING
+#endif // SDSUPPORT
+
+} // readFromSD
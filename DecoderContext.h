@@ -0,0 +1,92 @@
+#pragma once
+
+#include "types.h"
+#include "gcode.h"
+#include "SpscQueue.h"
+#include <cstddef>
+#include <functional>
+
+/** \brief Receives the commands completed by DecoderContext::feed(). */
+typedef std::function<void(GCode&)> CommandHandler;
+
+/** \brief Complete state of one command decoder.
+
+Everything the firmware kept in static members of GCode lives here: the command ring,
+the receive buffer of the serial state machine and the line number / resend
+bookkeeping. Every decoder owns its context, so any number of decoders can run on
+different threads without sharing mutable state. The command ring is a SpscQueue, so one
+thread may read and parse with readFromSerial() while another one takes the commands with
+peekCurrentCommand() and popCurrentCommand(). */
+class DecoderContext
+{
+public:
+    explicit DecoderContext(size_t queueCapacity = GCODE_BUFFER_SIZE);
+
+    void readFromSerial();
+    void feed(const uint8_t* data, size_t length, const CommandHandler& handler);
+    size_t feed(const uint8_t* data, size_t length, GCode* commands, size_t capacity, size_t& count);
+    void readFromSD();
+    void pushCommand();
+    GCode* peekCurrentCommand();
+    void popCurrentCommand();
+
+    inline SpscQueue<GCode>& getCommandQueue()
+    {
+        return commandsBuffered;
+    } // getCommandQueue
+
+    inline uint32_t getLastLineNumber() const
+    {
+        return lastLineNumber;
+    } // getLastLineNumber
+
+    inline uint8_t getFormatErrors() const
+    {
+        return formatErrors;
+    } // getFormatErrors
+
+    /** \brief Number of bytes of an incomplete command kept from the previous feed(). */
+    inline uint8_t getPendingBytes() const
+    {
+        return commandsReceivingWritePosition;
+    } // getPendingBytes
+
+private:
+    friend class GCode;
+    friend class BinaryDecoder;
+
+    /** \brief Result of receiveByte(). */
+    enum ReceiveResult
+    {
+        RECEIVE_MORE,       ///< The command is not complete yet.
+        RECEIVE_DONE,       ///< A line or command was consumed, but there is nothing to execute.
+        RECEIVE_COMMAND     ///< The command is complete and accepted.
+    };
+
+    template <typename Deliver> size_t feedBytes(const uint8_t* data, size_t length, GCode& act, Deliver deliver);
+    ReceiveResult receiveByte(uint8_t byte, GCode& act);
+    ReceiveResult completeCommand(GCode& act, bool parsed, bool ascii);
+    bool checkCommand(GCode* act);
+    void checkAndPushCommand(GCode* act);
+    void requestResend();
+
+    SpscQueue<GCode>    commandsBuffered;                       ///< Buffer for received commands.
+    uint8_t             commandReceiving[MAX_CMD_SIZE];         ///< Current received command.
+    uint8_t             commandsReceivingWritePosition;         ///< Writing position in gcode_transbuffer.
+    uint8_t             sendAsBinary;                           ///< Flags the command as binary input.
+    uint8_t             wasLastCommandReceivedAsBinary;         ///< Was the last successful command in binary mode?
+    uint8_t             commentDetected;                        ///< Flags true if we are reading the comment part of a command.
+    uint8_t             binaryCommandSize;                      ///< Expected size of the incoming binary command.
+    bool                waitUntilAllCommandsAreParsed;          ///< Don't read until all commands are parsed. Needed if gcode_buffer is misused as storage for strings.
+    uint32_t            lastLineNumber;                         ///< Last line number received.
+    uint32_t            actLineNumber;                          ///< Line number of current command.
+    millis_t            timeOfLastDataPacket;                   ///< Time, when we got the last data packet. Used to detect missing bytes.
+    uint8_t             formatErrors;                           ///< Number of sequential format errors
+    millis_t            lastBusySignal;                         ///< When was the last busy signal
+    GCode               lastBinaryCommand;                      ///< Last command of the previous decodeBatch().
+    uint8_t             paddedCommand[256];                     ///< Header of a binary command with implausible size, zero padded.
+
+public:
+    int8_t              waitingForResend;                       ///< Waiting for line to be resend. -1 = no wait.
+
+}; // DecoderContext
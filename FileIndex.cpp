@@ -0,0 +1,320 @@
+#include "FileIndex.h"
+#include "BinaryDecoder.h"
+#include "Communication.h"
+#include "DecoderContext.h"
+#include "MappedFile.h"
+#include "OutputSink.h"
+#include "gcode.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+
+/** Commands decoded per decodeBatch() call while building or querying an index. */
+#define INDEX_BATCH 256
+
+
+FileIndex::FileIndex()
+    : m_layerZ(0), m_zMoveOffset(UINT64_MAX), m_zMoveRecord(UINT64_MAX)
+{
+    memset(&m_header, 0, sizeof(m_header));
+    memset(&m_current, 0, sizeof(m_current));
+} // FileIndex
+
+
+std::string FileIndex::sidecarPath(const char* path)
+{
+    return std::string(path) + ".idx";
+
+} // sidecarPath
+
+
+/** \brief Fills size, modification time and hash of the file into header. Must be called
+    before the mapping is decoded, parseBinary() terminates texts in place. */
+bool FileIndex::identify(const char* path, const MappedFile& file, IndexHeader& header)
+{
+    std::error_code error;
+    auto            modified = std::filesystem::last_write_time(path, error);
+    const uint8_t*  data = file.data();
+    size_t          size = file.size();
+    size_t          head = std::min<size_t>(size, INDEX_HASH_SIZE);
+    size_t          tail = std::max<size_t>(head, size > INDEX_HASH_SIZE ? size - INDEX_HASH_SIZE : 0);
+    uint64_t        hash = 0xcbf29ce484222325ull;
+
+
+    if (error) return false;
+    auto mix = [&hash, data](size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; i++)
+        {
+            hash ^= data[i];
+            hash *= 0x100000001b3ull;
+        }
+    };
+    mix(0, head);
+    mix(tail, size);
+
+    memcpy(header.magic, "RDIX", 4);
+    header.version = INDEX_VERSION;
+    header.fileSize = size;
+    header.modified = (int64_t)modified.time_since_epoch().count();
+    header.hash = hash;
+    header.interval = INDEX_INTERVAL;
+    return true;
+
+} // identify
+
+
+/** \brief Starts a new index of file, which must not be decoded yet. */
+void FileIndex::start(const char* path, const MappedFile& file)
+{
+    memset(&m_header, 0, sizeof(m_header));
+    identify(path, file, m_header);
+    m_checkpoints.clear();
+    m_layers.clear();
+    memset(&m_current, 0, sizeof(m_current));
+    m_layerZ = 0;
+    m_zMoveOffset = m_zMoveRecord = UINT64_MAX;
+
+} // start
+
+
+/** \brief Adds the next count commands decoded by BinaryDecoder::decodeBatch() from the file
+    offset base. Damaged commands are counted but do not change the state. */
+void FileIndex::add(GCode* commands, const BatchRecord* records, size_t count, size_t base)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        uint64_t record = m_header.records++;
+        uint64_t offset = base + records[i].offset;
+
+        if (records[i].status != RECORD_OK) continue;
+        if (m_checkpoints.empty() || record / INDEX_INTERVAL > m_checkpoints.back().record / INDEX_INTERVAL)
+        {
+            IndexCheckpoint checkpoint = m_current;
+            checkpoint.offset = offset;
+            checkpoint.record = record;
+            m_checkpoints.push_back(checkpoint);
+        }
+
+        MachineState& state = m_current.state;
+        float         zBefore = state.position[2];
+        bool          extruding = state.apply(commands[i]);
+        if (state.position[2] != zBefore)
+        {
+            m_zMoveOffset = offset;
+            m_zMoveRecord = record;
+        }
+        if (extruding && (m_layers.empty() || state.position[2] > m_layerZ))
+        {
+            LayerStart layer = { offset, record, state.position[2], 0 };
+            if (m_zMoveRecord != UINT64_MAX && (m_layers.empty() || m_zMoveRecord > m_layers.back().record))
+            {
+                layer.offset = m_zMoveOffset;
+                layer.record = m_zMoveRecord;
+            }
+            m_layers.push_back(layer);
+            m_layerZ = state.position[2];
+            m_current.layer++;
+        }
+    }
+
+} // add
+
+
+void FileIndex::finish()
+{
+    m_header.checkpoints = m_checkpoints.size();
+    m_header.layers = m_layers.size();
+
+} // finish
+
+
+/** \brief Builds the index of path in a decode without output. The mapping is modified. */
+bool FileIndex::build(const char* path, MappedFile& file)
+{
+    uint8_t*        data = file.data();
+    size_t          fileSize = file.size();
+    size_t          offset = 0;
+    GCode           commands[INDEX_BATCH];
+    BatchRecord     records[INDEX_BATCH];
+    DecoderContext  context;
+    OutputSink      discard(OUTPUT_NONE);
+
+
+    start(path, file);
+    Com::setThreadSink(&discard);
+    while (offset < fileSize && fileSize - offset > MIN_CMD_SIZE)
+    {
+        BatchResult batch = BinaryDecoder::decodeBatch({ data + offset, fileSize - offset }, { commands, records, INDEX_BATCH }, context);
+        add(commands, records, batch.count, offset);
+        offset += batch.consumed;
+    }
+    Com::setThreadSink(nullptr);
+    finish();
+    return true;
+
+} // build
+
+
+bool FileIndex::save(const char* path) const
+{
+    std::string sidecar = sidecarPath(path);
+    FILE*       out = fopen(sidecar.c_str(), "wb");
+    if (!out) return false;
+
+    bool ok = fwrite(&m_header, sizeof(m_header), 1, out) == 1
+        && fwrite(m_checkpoints.data(), sizeof(IndexCheckpoint), m_checkpoints.size(), out) == m_checkpoints.size()
+        && fwrite(m_layers.data(), sizeof(LayerStart), m_layers.size(), out) == m_layers.size();
+    ok = fclose(out) == 0 && ok;
+    if (!ok) remove(sidecar.c_str());
+    return ok;
+
+} // save
+
+
+/** \brief Reads the sidecar of path. Returns false if there is none, it is damaged or it
+    belongs to another version of the file. file must not be decoded yet. */
+bool FileIndex::load(const char* path, const MappedFile& file)
+{
+    std::string sidecar = sidecarPath(path);
+    FILE*       in = fopen(sidecar.c_str(), "rb");
+    IndexHeader current;
+    if (!in) return false;
+
+    memset(&current, 0, sizeof(current));
+    bool ok = fread(&m_header, sizeof(m_header), 1, in) == 1
+        && !memcmp(m_header.magic, "RDIX", 4) && m_header.version == INDEX_VERSION && m_header.interval == INDEX_INTERVAL
+        && identify(path, file, current)
+        && m_header.fileSize == current.fileSize && m_header.modified == current.modified && m_header.hash == current.hash
+        && m_header.checkpoints <= (m_header.records + INDEX_INTERVAL - 1) / INDEX_INTERVAL && m_header.layers <= m_header.records;
+    if (ok)
+    {
+        m_checkpoints.resize(m_header.checkpoints);
+        m_layers.resize(m_header.layers);
+        ok = fread(m_checkpoints.data(), sizeof(IndexCheckpoint), m_checkpoints.size(), in) == m_checkpoints.size()
+            && fread(m_layers.data(), sizeof(LayerStart), m_layers.size(), in) == m_layers.size();
+    }
+    fclose(in);
+    if (!ok)
+    {
+        memset(&m_header, 0, sizeof(m_header));
+        m_checkpoints.clear();
+        m_layers.clear();
+    }
+    return ok;
+
+} // load
+
+
+/** \brief Decodes from checkpoint and echoes the commands first to last (inclusive) that start
+    in front of endOffset. state receives the modal state in front of the first one. Messages
+    of damaged commands in front of first are not written. Returns the number of commands
+    written. */
+size_t FileIndex::decodeFrom(MappedFile& file, const IndexCheckpoint& checkpoint, size_t first, size_t last, size_t endOffset, IndexCheckpoint& state) const
+{
+    uint8_t*        data = file.data();
+    size_t          fileSize = file.size();
+    size_t          offset = (size_t)checkpoint.offset;
+    size_t          record = (size_t)checkpoint.record;
+    size_t          written = 0;
+    GCode           commands[INDEX_BATCH];
+    BatchRecord     records[INDEX_BATCH];
+    DecoderContext  context;
+    IndexCheckpoint current = checkpoint;
+    OutputSink      discard(OUTPUT_NONE);
+
+
+    state = checkpoint;
+    while (record <= last && offset < endOffset && offset < fileSize && fileSize - offset > MIN_CMD_SIZE)
+    {
+        // Batches end at first, so that no message of the commands in front of it is written
+        size_t capacity = std::min<size_t>(INDEX_BATCH, record < first ? first - record : last - record + 1);
+        size_t base = offset;
+
+        Com::setThreadSink(record < first ? &discard : nullptr);
+        BatchResult batch = BinaryDecoder::decodeBatch({ data + base, fileSize - base }, { commands, records, capacity }, context);
+        Com::setThreadSink(nullptr);
+        offset += batch.consumed;
+        for (size_t i = 0; i < batch.count; i++, record++)
+        {
+            size_t commandOffset = base + records[i].offset;
+            if (record >= first && commandOffset < endOffset)
+            {
+                if (!written)
+                {
+                    state = current;
+                    state.offset = commandOffset;
+                    state.record = record;
+                }
+                commands[i].echoCommand();
+                written++;
+            }
+            if (records[i].status == RECORD_OK) current.state.apply(commands[i]);
+        }
+    }
+    return written;
+
+} // decodeFrom
+
+
+/** \brief Decodes and echoes the commands first to last (counted from 0, inclusive). */
+size_t FileIndex::decodeCommands(MappedFile& file, size_t first, size_t last, IndexCheckpoint& state) const
+{
+    if (first >= m_header.records || first > last) return 0;
+
+    // Without an intact command in front of first the decode starts at the start of the file
+    IndexCheckpoint start = {};
+    auto next = std::upper_bound(m_checkpoints.begin(), m_checkpoints.end(), (uint64_t)first,
+        [](uint64_t record, const IndexCheckpoint& checkpoint) { return record < checkpoint.record; });
+    return decodeFrom(file, next == m_checkpoints.begin() ? start : *(next - 1), first, last, SIZE_MAX, state);
+
+} // decodeCommands
+
+
+/** \brief Decodes and echoes the commands starting in [begin, end). */
+size_t FileIndex::decodeOffsets(MappedFile& file, size_t begin, size_t end, IndexCheckpoint& state) const
+{
+    if (!m_header.records || begin >= end) return 0;
+
+    // Without an intact command in front of begin the decode starts at the start of the file
+    const IndexCheckpoint*  nearest = this->checkpoint(begin);
+    IndexCheckpoint         checkpoint = nearest ? *nearest : IndexCheckpoint();
+
+    // The first command at or behind begin is found by stepping, like decodeBatch() does
+    const uint8_t*  data = file.data();
+    size_t          fileSize = file.size();
+    size_t          offset = (size_t)checkpoint.offset;
+    size_t          record = (size_t)checkpoint.record;
+    while (offset < begin && offset < fileSize && fileSize - offset > MIN_CMD_SIZE)
+    {
+        uint8_t size = GCode::computeBinarySize((char*)(data + offset));
+        offset += size > MAX_CMD_SIZE2 || size > fileSize - offset ? MIN_CMD_SIZE : std::max<size_t>(size, MIN_CMD_SIZE);
+        record++;
+    }
+    return decodeFrom(file, checkpoint, record, SIZE_MAX, end, state);
+
+} // decodeOffsets
+
+
+/** \brief The last checkpoint at or in front of offset, nullptr if there is none. The decode
+    then starts at the start of the file. */
+const IndexCheckpoint* FileIndex::checkpoint(size_t offset) const
+{
+    auto next = std::upper_bound(m_checkpoints.begin(), m_checkpoints.end(), (uint64_t)offset,
+        [](uint64_t value, const IndexCheckpoint& checkpoint) { return value < checkpoint.offset; });
+    return next == m_checkpoints.begin() ? nullptr : &*(next - 1);
+
+} // checkpoint
+
+
+/** \brief Commands of layer (counted from 1): from its first Z move up to the next layer. */
+bool FileIndex::layerCommands(size_t layer, size_t& first, size_t& last) const
+{
+    if (!layer || layer > m_layers.size()) return false;
+
+    first = (size_t)m_layers[layer - 1].record;
+    last = layer < m_layers.size() ? (size_t)m_layers[layer].record - 1 : (size_t)m_header.records - 1;
+    return true;
+
+} // layerCommands
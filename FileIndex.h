@@ -0,0 +1,112 @@
+#pragma once
+
+#include "types.h"
+#include "MachineState.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class GCode;
+class MappedFile;
+struct BatchRecord;
+
+/** Commands between two checkpoints of a FileIndex. */
+#define INDEX_INTERVAL 1024
+
+/** Bytes at the start and at the end of a file hashed to detect a changed file. */
+#define INDEX_HASH_SIZE (64 * 1024)
+
+/** Version of the .idx format, an index with another version is rebuilt. */
+#define INDEX_VERSION 3
+
+/** \brief Position of command record (counted from 0), which has a correct checksum, and the
+    modal state in front of it. */
+struct IndexCheckpoint
+{
+    uint64_t        offset;
+    uint64_t        record;
+    uint32_t        layer;      ///< Layers begun in front of the command.
+    uint32_t        reserved;
+    MachineState    state;
+};
+
+/** \brief First command of a layer: the Z move in front of the first extruding move at a new height. */
+struct LayerStart
+{
+    uint64_t    offset;
+    uint64_t    record;
+    float       z;
+    uint32_t    reserved;
+};
+
+/** \brief Header of a .idx sidecar file. */
+struct IndexHeader
+{
+    char        magic[4];       ///< "RDIX"
+    uint32_t    version;
+    uint64_t    fileSize;
+    int64_t     modified;       ///< Modification time of the file in the ticks of std::filesystem.
+    uint64_t    hash;           ///< Hash of the first and last INDEX_HASH_SIZE bytes.
+    uint32_t    interval;
+    uint32_t    reserved;
+    uint64_t    records;
+    uint64_t    checkpoints;
+    uint64_t    layers;
+};
+
+/** \brief Sparse index of a binary file for decoding a part of it without decoding its start.
+
+At the first intact command of every INDEX_INTERVAL commands a checkpoint stores the offset,
+the layer and the MachineState. A damaged command copies the fields of the command in front
+of it, so a fresh DecoderContext decodes from an intact one exactly like the full decode does.
+The first command of every layer is stored as well. Commands are counted like decodeRange() steps them, so command k is
+line k + 1 of the decoded file if no messages are printed. The index is built from the
+commands of a normal decode (start(), add(), finish()) or by build(), and kept in a sidecar
+file path.idx. load() rejects an index whose file changed in size, modification time or in
+the hash of its first and last INDEX_HASH_SIZE bytes. */
+class FileIndex
+{
+public:
+    FileIndex();
+
+    void start(const char* path, const MappedFile& file);
+    void add(GCode* commands, const BatchRecord* records, size_t count, size_t base);
+    void finish();
+    bool build(const char* path, MappedFile& file);
+
+    bool save(const char* path) const;
+    bool load(const char* path, const MappedFile& file);
+
+    size_t decodeCommands(MappedFile& file, size_t first, size_t last, IndexCheckpoint& state) const;
+    size_t decodeOffsets(MappedFile& file, size_t begin, size_t end, IndexCheckpoint& state) const;
+    bool layerCommands(size_t layer, size_t& first, size_t& last) const;
+    const IndexCheckpoint* checkpoint(size_t offset) const;
+
+    inline size_t records() const
+    {
+        return m_header.records;
+    } // records
+
+    inline size_t layers() const
+    {
+        return m_layers.size();
+    } // layers
+
+    static std::string sidecarPath(const char* path);
+
+private:
+    static bool identify(const char* path, const MappedFile& file, IndexHeader& header);
+    size_t decodeFrom(MappedFile& file, const IndexCheckpoint& checkpoint, size_t first, size_t last, size_t endOffset, IndexCheckpoint& state) const;
+
+    IndexHeader                     m_header;
+    std::vector<IndexCheckpoint>    m_checkpoints;
+    std::vector<LayerStart>         m_layers;
+
+    // State while the index is built
+    IndexCheckpoint                 m_current;      ///< Modal state in front of the next command.
+    float                           m_layerZ;
+    uint64_t                        m_zMoveOffset;  ///< Last command that changed Z.
+    uint64_t                        m_zMoveRecord;
+
+}; // FileIndex
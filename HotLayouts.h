@@ -0,0 +1,67 @@
+#pragma once
+
+#include "types.h"
+#include "BinaryLayout.h"
+#include "DecoderContext.h"
+#include "gcode.h"
+
+/** \brief Compile time list of bitfields (params) with a decoder of their own. */
+template <uint16_t... Layouts>
+struct LayoutList
+{
+};
+
+/** \brief Bitfields decoded by specialized decoders, tested in this order.
+    Put the most frequent layouts first, the layout histogram of --stats shows them for a
+    file. Only V1 layouts without text can be specialized, anything else is a compile error.
+    - 0x0dc : G X Y E
+    - 0x1dc : G X Y E F
+    - 0x19c : G X Y F
+    - 0x184 : G F
+    - 0x1c4 : G E F
+    - 0x0c4 : G E
+    - 0x09c : G X Y
+    - 0x482 : M S
+    - 0x682 : M T S */
+typedef LayoutList<0x0dc, 0x1dc, 0x19c, 0x184, 0x1c4, 0x0c4, 0x09c, 0x482, 0x682> HotLayouts;
+
+
+/** \brief Decodes the fields of a command with the bitfield Bits into gcode.
+    Offsets are compile time constants from the layout tables and there is no test per field.
+    fields points behind the bitfield. */
+template <uint16_t Bits>
+inline void decodeFixedLayout(GCode& gcode, const uint8_t* fields, DecoderContext& context)
+{
+    static_assert((Bits & 128) != 0, "binary commands have bit 7 set");
+    static_assert((Bits & (4096 | 8192 | 32768)) == 0, "only V1 layouts without text can be specialized");
+
+    constexpr LowFieldLayout    low = BinaryLayout::lowFields[Bits & 255];
+    constexpr HighFieldLayout   high = BinaryLayout::highFields[Bits >> 8];
+    const uint8_t*              highFields = fields + low.length;
+
+
+    gcode.params = Bits;
+    gcode.params2 = 0;
+    if constexpr ((Bits & 1) != 0) context.actLineNumber = gcode.N = BinaryLayout::field<uint16_t>(fields + low.N);
+    if constexpr ((Bits & 2) != 0) gcode.M = fields[low.M];
+    if constexpr ((Bits & 4) != 0) gcode.G = fields[low.G];
+    if constexpr ((Bits & 8) != 0) gcode.X = BinaryLayout::field<float>(fields + low.X);
+    if constexpr ((Bits & 16) != 0) gcode.Y = BinaryLayout::field<float>(fields + low.Y);
+    if constexpr ((Bits & 32) != 0) gcode.Z = BinaryLayout::field<float>(fields + low.Z);
+    if constexpr ((Bits & 64) != 0) gcode.E = BinaryLayout::field<float>(fields + low.E);
+    if constexpr ((Bits & 256) != 0) gcode.F = BinaryLayout::field<float>(highFields + high.F);
+    if constexpr ((Bits & 512) != 0) gcode.T = highFields[high.T];
+    if constexpr ((Bits & 1024) != 0) gcode.S = BinaryLayout::field<int32_t>(highFields + high.S);
+    if constexpr ((Bits & 2048) != 0) gcode.P = BinaryLayout::field<int32_t>(highFields + high.P);
+
+} // decodeFixedLayout
+
+
+/** \brief Decodes the command with the specialized decoder for bits, if the list has one.
+    Returns false if bits is not in the list and the generic decoder must be used. */
+template <uint16_t... Layouts>
+inline bool decodeHotLayout(LayoutList<Layouts...>, GCode& gcode, uint16_t bits, const uint8_t* fields, DecoderContext& context)
+{
+    return ((bits == Layouts && (decodeFixedLayout<Layouts>(gcode, fields, context), true)) || ...);
+
+} // decodeHotLayout
@@ -0,0 +1,174 @@
+#include "MachineState.h"
+#include "BinaryDecoder.h"
+#include "CommandStore.h"
+#include "MappedFile.h"
+#include "gcode.h"
+#include <algorithm>
+
+
+/** \brief Applies one decoded command, returns true for an extruding move in X or Y. */
+bool MachineState::apply(GCode& command)
+{
+    if (command.hasN()) N = (uint16_t)command.N;
+    if (command.hasF()) f = command.F;
+    if ((command.params & 6) == 4 && command.G <= 1)
+        return move(command.params, command.X, command.Y, command.Z, command.E);
+    applyModal(command.params, command.M, command.G, command.S, command.T, command.X, command.Y, command.Z, command.E);
+    return false;
+
+} // apply
+
+
+/** \brief Applies all commands but G0/G1: positioning modes, G92, G28, tool changes,
+    temperatures and fan. Line number and feedrate are left to the caller. */
+void MachineState::applyModal(uint32_t params, uint32_t M, uint32_t G, long S, uint8_t T, float x, float y, float z, float e)
+{
+    bool hasS = (params & 1024) != 0;
+
+
+    if (params & 2)
+    {
+        switch (M)
+        {
+        case 82:
+            flags &= ~MACHINE_RELATIVE_E;
+            break;
+        case 83:
+            flags |= MACHINE_RELATIVE_E;
+            break;
+        case 104:
+        case 109:
+        {
+            unsigned int target = (params & 512) ? T : tool;
+            if (hasS && target < MACHINE_TOOLS) hotend[target] = (int16_t)S;
+            break;
+        }
+        case 140:
+        case 190:
+            if (hasS) bed = (int16_t)S;
+            break;
+        case 106:
+            fan = hasS ? (uint8_t)std::min<long>(std::max<long>(S, 0), 255) : 255;
+            break;
+        case 107:
+            fan = 0;
+            break;
+        default:
+            break;
+        }
+        return;
+    }
+    if (params & 4)
+    {
+        switch (G)
+        {
+        case 28:
+            // Homing without axes homes all of them
+            if (!(params & 56)) params |= 56;
+            if (params & 8) position[0] = 0;
+            if (params & 16) position[1] = 0;
+            if (params & 32) position[2] = 0;
+            break;
+        case 90:
+            flags &= ~(MACHINE_RELATIVE | MACHINE_RELATIVE_E);
+            break;
+        case 91:
+            flags |= MACHINE_RELATIVE | MACHINE_RELATIVE_E;
+            break;
+        case 92:
+            if (params & 8) position[0] = x;
+            if (params & 16) position[1] = y;
+            if (params & 32) position[2] = z;
+            if (params & 64) position[3] = e;
+            break;
+        default:
+            break;
+        }
+        return;
+    }
+    if (params & 512) tool = T;
+
+} // applyModal
+
+
+MachineTracker::MachineTracker(size_t interval)
+    : m_interval(interval ? interval : 1), m_untilSnapshot(0), m_commands(0), m_state()
+{
+} // MachineTracker
+
+
+/** \brief Continues behind snapshot, the next command tracked is the one at snapshot.offset.
+    The snapshots taken so far are dropped, with keepSnapshots only those from that command on. */
+void MachineTracker::start(const MachineSnapshot& snapshot, bool keepSnapshots)
+{
+    if (!keepSnapshots) m_snapshots.clear();
+    while (!m_snapshots.empty() && m_snapshots.back().command >= snapshot.command)
+        m_snapshots.pop_back();
+    m_state = snapshot.state;
+    m_commands = (size_t)snapshot.command;
+    m_untilSnapshot = (m_interval - m_commands % m_interval) % m_interval;
+
+} // start
+
+
+/** \brief Applies all commands of store in order. */
+void MachineTracker::track(const CommandStore& store)
+{
+    const uint16_t* params = store.params.data();
+    const uint16_t* N = store.N.data();
+    const uint16_t* M = store.M.data();
+    const uint16_t* G = store.G.data();
+    const float*    X = store.X.data();
+    const float*    Y = store.Y.data();
+    const float*    Z = store.Z.data();
+    const float*    E = store.E.data();
+    const float*    F = store.F.data();
+    const uint8_t*  T = store.T.data();
+    const int32_t*  S = store.S.data();
+    size_t          count = store.size();
+    MachineState    state = m_state;
+
+
+    for (size_t i = 0; i < count; i++)
+    {
+        if (!m_untilSnapshot)
+        {
+            m_snapshots.push_back({ store.offset[i], m_commands + i, state });
+            m_untilSnapshot = m_interval;
+        }
+        m_untilSnapshot--;
+
+        uint32_t bits = params[i];
+        state.N = (bits & 1) ? N[i] : state.N;
+        state.f = (bits & 256) ? F[i] : state.f;
+        if ((bits & 6) == 4 && G[i] <= 1)
+            state.move(bits, X[i], Y[i], Z[i], E[i]);
+        else if (bits & (2 | 4 | 512))
+            state.applyModal(bits, M[i], G[i], S[i], T[i], X[i], Y[i], Z[i], E[i]);
+    }
+    m_state = state;
+    m_commands += count;
+
+} // track
+
+
+/** \brief Decodes the commands starting in [begin, end) into columns and tracks them. The
+    mapping is not modified. Returns the offset behind the last command. */
+size_t MachineTracker::trackRange(MappedFile& file, size_t begin, size_t end)
+{
+    CommandStore    store;
+    size_t          offset = begin;
+
+
+    store.reserve(MACHINE_BATCH);
+    while (offset < end)
+    {
+        store.clear();
+        size_t next = BinaryDecoder::decodeColumns(file, offset, end, store, MACHINE_BATCH);
+        if (next == offset) break;
+        offset = next;
+        track(store);
+    }
+    return offset;
+
+} // trackRange
@@ -0,0 +1,109 @@
+#pragma once
+
+#include "types.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class CommandStore;
+class GCode;
+class MappedFile;
+
+/** Default number of commands between two snapshots of a MachineTracker. */
+#define MACHINE_SNAPSHOT_INTERVAL 4096
+
+/** Tools with a target temperature of their own, higher tool numbers are ignored by M104/M109. */
+#define MACHINE_TOOLS 8
+
+/** Commands decoded into the CommandStore at once by MachineTracker::trackRange(). */
+#define MACHINE_BATCH 16384
+
+/** Bits of MachineState::flags. */
+#define MACHINE_RELATIVE 1      ///< G91
+#define MACHINE_RELATIVE_E 2    ///< M83 or G91
+
+/** \brief Modal state of the printer behind a command: position, positioning modes, feedrate,
+    tool, target temperatures and fan. A plain struct, zero initialized by MachineState state = {}
+    and stored as it is in snapshots and index files. */
+struct MachineState
+{
+    float       position[4];            ///< X, Y, Z, E in the coordinates of the file (G92 applied).
+    float       f;                      ///< Last feedrate.
+    int16_t     hotend[MACHINE_TOOLS];  ///< Target temperature of every tool.
+    int16_t     bed;
+    uint16_t    N;                      ///< Last line number.
+    uint8_t     tool;
+    uint8_t     flags;                  ///< MACHINE_RELATIVE, MACHINE_RELATIVE_E.
+    uint8_t     fan;                    ///< Fan speed 0 .. 255.
+    uint8_t     reserved;
+
+    bool apply(GCode& command);
+    void applyModal(uint32_t params, uint32_t M, uint32_t G, long S, uint8_t T, float x, float y, float z, float e);
+
+    /** \brief Applies a G0/G1 with the fields in params. Returns true for an extruding move
+        in X or Y. Written with selects only, so that a stream of moves runs without branches. */
+    inline bool move(uint32_t params, float x, float y, float z, float e)
+    {
+        bool    relative = (flags & MACHINE_RELATIVE) != 0;
+        bool    relativeE = (flags & MACHINE_RELATIVE_E) != 0;
+        float   newE = (params & 64) ? (relativeE ? position[3] + e : e) : position[3];
+        bool    extruding = newE > position[3] && (params & 24) != 0;
+
+
+        position[0] = (params & 8) ? (relative ? position[0] + x : x) : position[0];
+        position[1] = (params & 16) ? (relative ? position[1] + y : y) : position[1];
+        position[2] = (params & 32) ? (relative ? position[2] + z : z) : position[2];
+        position[3] = newE;
+        return extruding;
+    } // move
+};
+
+/** \brief State in front of command number command (counted from 0, damaged commands are not
+    counted) at offset in the file. */
+struct MachineSnapshot
+{
+    uint64_t        offset;
+    uint64_t        command;
+    MachineState    state;
+};
+
+/** \brief Replays decoded commands into a MachineState and keeps a snapshot every interval
+    commands.
+
+The commands come column by column from a CommandStore: line number and feedrate are taken
+with selects, moves by MachineState::move(), only the rare M, G9x and tool change commands
+take the branching path. Damaged commands are not in the store and change nothing. A snapshot
+holds everything needed to continue from its offset, start() resumes from one. The checkpoints
+of FileIndex are such snapshots, so tracking can begin in the middle of a file. */
+class MachineTracker
+{
+public:
+    explicit MachineTracker(size_t interval = MACHINE_SNAPSHOT_INTERVAL);
+
+    void start(const MachineSnapshot& snapshot, bool keepSnapshots = false);
+    void track(const CommandStore& store);
+    size_t trackRange(MappedFile& file, size_t begin, size_t end);
+
+    inline const MachineState& state() const
+    {
+        return m_state;
+    } // state
+
+    inline size_t commands() const
+    {
+        return m_commands;
+    } // commands
+
+    inline const std::vector<MachineSnapshot>& snapshots() const
+    {
+        return m_snapshots;
+    } // snapshots
+
+private:
+    size_t                          m_interval;
+    size_t                          m_untilSnapshot;    ///< Commands left to the next snapshot.
+    size_t                          m_commands;
+    MachineState                    m_state;
+    std::vector<MachineSnapshot>    m_snapshots;
+
+}; // MachineTracker
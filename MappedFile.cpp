@@ -0,0 +1,131 @@
+#include "MappedFile.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // _WIN32
+
+/** Size of the window that is prefetched right after opening with MAPPED_SEQUENTIAL. */
+#define MAPPED_FILE_PREFETCH (4 * 1024 * 1024)
+
+
+MappedFile::MappedFile()
+    : m_data(nullptr), m_size(0), m_open(false)
+#ifdef _WIN32
+    , m_file(INVALID_HANDLE_VALUE), m_mapping(nullptr)
+#else
+    , m_fd(-1)
+#endif // _WIN32
+{
+} // MappedFile
+
+
+MappedFile::~MappedFile()
+{
+    close();
+} // ~MappedFile
+
+
+/** \brief Maps the complete file, access tells the kernel how it is read. Returns false if
+    the file can not be opened or mapped. An empty file is opened successfully but has no data. */
+bool MappedFile::open(const char* path, MappedAccess access)
+{
+    close();
+
+#ifdef _WIN32
+    // FILE_FLAG_SEQUENTIAL_SCAN is the Windows counterpart of MADV_SEQUENTIAL
+    DWORD  flags = access == MAPPED_SEQUENTIAL ? FILE_FLAG_SEQUENTIAL_SCAN : FILE_ATTRIBUTE_NORMAL;
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, flags, NULL);
+    if (file == INVALID_HANDLE_VALUE) return false;
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize))
+    {
+        CloseHandle(file);
+        return false;
+    }
+    m_file = file;
+    m_size = (size_t)fileSize.QuadPart;
+    m_open = true;
+    if (!m_size) return true;
+
+    m_mapping = CreateFileMappingA(file, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+    if (m_mapping)
+        m_data = (uint8_t*)MapViewOfFile(m_mapping, FILE_MAP_COPY, 0, 0, 0);
+#else
+    int fd = ::open(path, O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0)
+    {
+        ::close(fd);
+        return false;
+    }
+    m_fd = fd;
+    m_size = (size_t)st.st_size;
+    m_open = true;
+    if (!m_size) return true;
+
+    void* map = mmap(NULL, m_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    if (map != MAP_FAILED)
+    {
+        m_data = (uint8_t*)map;
+        if (access == MAPPED_SEQUENTIAL)
+        {
+            madvise(map, m_size, MADV_SEQUENTIAL);
+            adviseWillNeed(0, MAPPED_FILE_PREFETCH);
+        }
+    }
+#endif // _WIN32
+
+    if (!m_data)
+    {
+        close();
+        return false;
+    }
+    return true;
+
+} // open
+
+
+void MappedFile::close()
+{
+#ifdef _WIN32
+    if (m_data) UnmapViewOfFile(m_data);
+    if (m_mapping) CloseHandle(m_mapping);
+    if (m_file != INVALID_HANDLE_VALUE) CloseHandle(m_file);
+    m_mapping = nullptr;
+    m_file = INVALID_HANDLE_VALUE;
+#else
+    if (m_data) munmap(m_data, m_size);
+    if (m_fd >= 0) ::close(m_fd);
+    m_fd = -1;
+#endif // _WIN32
+
+    m_data = nullptr;
+    m_size = 0;
+    m_open = false;
+
+} // close
+
+
+/** \brief Asks the kernel to start reading the given range ahead of its use. */
+void MappedFile::adviseWillNeed(size_t offset, size_t length)
+{
+    if (!m_data || offset >= m_size) return;
+    if (length > m_size - offset) length = m_size - offset;
+
+#ifndef _WIN32
+    // madvise() wants a page aligned start address
+    size_t pageSize = (size_t)sysconf(_SC_PAGESIZE);
+    size_t aligned = offset & ~(pageSize - 1);
+    madvise(m_data + aligned, length + (offset - aligned), MADV_WILLNEED);
+#endif // _WIN32
+
+} // adviseWillNeed
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "types.h"
+#include <cstddef>
+
+/** \brief How a MappedFile is going to be read. */
+enum MappedAccess
+{
+    MAPPED_SEQUENTIAL,  ///< All of it from the front: sequential read-ahead, the start is prefetched.
+    MAPPED_PARTIAL      ///< Only some parts: the normal read-ahead, the caller prefetches with adviseWillNeed().
+};
+
+/** \brief Whole file mapped into memory for zero-copy decoding.
+
+The view is mapped copy-on-write: GCode::parseBinary() terminates strings in place
+by overwriting the first checksum byte, and those writes must never reach the
+file on disk. Only the few pages holding string commands get copied by the kernel. */
+class MappedFile
+{
+public:
+    MappedFile();
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool open(const char* path, MappedAccess access = MAPPED_SEQUENTIAL);
+    void close();
+    void adviseWillNeed(size_t offset, size_t length);
+
+    inline bool isOpen() const
+    {
+        return m_open;
+    } // isOpen
+
+    inline uint8_t* data() const
+    {
+        return m_data;
+    } // data
+
+    inline size_t size() const
+    {
+        return m_size;
+    } // size
+
+private:
+    uint8_t*    m_data;
+    size_t      m_size;
+    bool        m_open;
+
+#ifdef _WIN32
+    void*       m_file;
+    void*       m_mapping;
+#else
+    int         m_fd;
+#endif // _WIN32
+
+}; // MappedFile
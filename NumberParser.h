@@ -0,0 +1,182 @@
+#pragma once
+
+#include "types.h"
+#include <cctype>
+#include <charconv>
+#include <climits>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+/** \brief Locale independent parsing of the numbers in ASCII commands.
+
+Slicers write plain fixed point numbers like 123.456. These are converted without strtod():
+the digits are collected in a 64 bit integer and divided by a power of ten. Both are exact
+in a double as long as there are at most 15 significant and at most 22 fractional digits, so
+the one division gives the correctly rounded result, the same value strtod() returns.
+Everything else (exponents, hex numbers, inf, nan, more digits) is passed to std::from_chars(),
+which never depends on the locale, unlike strtod() and strtol() whose decimal point follows
+LC_NUMERIC. The accepted syntax, the end pointer and the values are those of strtod() and strtol()
+in the C locale, out of range numbers included. */
+class NumberParser
+{
+public:
+    static inline bool isDigit(char c)
+    {
+        return (unsigned char)(c - '0') < 10;
+    } // isDigit
+
+    /** \brief Same as strtod(text, end) in the C locale. */
+    static inline double toDouble(const char* text, char** end)
+    {
+        static const double powersOfTen[] =
+        {
+            1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+            1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+        };
+        const char* p = skipSpaceAndSign(text);
+        bool        negative = p > text && p[-1] == '-';
+        uint64_t    mantissa = 0;
+        int         significant = 0;
+        int         fraction = 0;
+        bool        digits = false;
+
+
+        if (p[0] == '0' && (p[1] | 0x20) == 'x') return fromChars(text, negative, end); // hex float
+
+        for (; isDigit(*p); p++, digits = true)
+        {
+            mantissa = mantissa * 10 + (*p - '0');
+            if (mantissa) significant++;
+            if (significant > 15) return fromChars(text, negative, end);
+        }
+        if (*p == '.')
+        {
+            for (p++; isDigit(*p); p++, digits = true, fraction++)
+            {
+                mantissa = mantissa * 10 + (*p - '0');
+                if (mantissa) significant++;
+                if (significant > 15 || fraction > 22) return fromChars(text, negative, end);
+            }
+        }
+        if (!digits || (*p | 0x20) == 'e') return fromChars(text, negative, end); // inf, nan, exponent or no number
+
+        double value = (double)mantissa / powersOfTen[fraction];
+        *end = (char*)p;
+        return negative ? -value : value;
+    } // toDouble
+
+    /** \brief Same as strtol(text, end, 10). */
+    static inline long toLong(const char* text, char** end)
+    {
+        const char* p = skipSpaceAndSign(text);
+        bool        negative = p > text && p[-1] == '-';
+        const char* first = p;
+        long        value = 0;
+
+
+        for (; isDigit(*p); p++)
+        {
+            if (p - first == 9) // might overflow a 32 bit long
+            {
+                std::from_chars_result result = std::from_chars(negative ? first - 1 : first, first + strlen(first), value);
+                if (result.ec == std::errc::result_out_of_range) value = negative ? LONG_MIN : LONG_MAX;
+                *end = (char*)result.ptr;
+                return value;
+            }
+            value = value * 10 + (*p - '0');
+        }
+        if (p == first)
+        {
+            *end = (char*)text; // no number
+            return 0;
+        }
+        *end = (char*)p;
+        return negative ? -value : value;
+    } // toLong
+
+private:
+    /** \brief Slow path of toDouble(). */
+    static double fromChars(const char* text, bool negative, char** end)
+    {
+        const char*             number = skipSpaceAndSign(text);
+        bool                    hex = number[0] == '0' && (number[1] | 0x20) == 'x';
+        double                  value = 0;
+        std::from_chars_result  result;
+
+
+        // from_chars() takes neither the 0x nor a + sign but a second -, the sign is applied here
+        if (hex) number += 2;
+        const char* last = hex ? hexEnd(number) : number + strlen(number);
+        result = std::from_chars(number, last, value, hex ? std::chars_format::hex : std::chars_format::general);
+        if (*number == '-' || result.ec == std::errc::invalid_argument)
+        {
+            if (!hex)
+            {
+                *end = (char*)text;
+                return 0;
+            }
+            *end = (char*)(number - 1); // of "0x" only the 0 is a number
+            return negative ? -0.0 : 0.0;
+        }
+        if (result.ec == std::errc::result_out_of_range)
+            value = tooSmall(number, result.ptr, hex) ? 0 : HUGE_VAL;
+        *end = (char*)result.ptr;
+        return negative ? -value : value;
+    } // fromChars
+
+    /** \brief End of the hex float behind the 0x at p. Not left to from_chars(), which also takes
+        inf, nan and a sign there. */
+    static const char* hexEnd(const char* p)
+    {
+        const char* digits = p;
+
+
+        while (isxdigit((unsigned char)*p)) p++;
+        if (*p == '.')
+            for (p++; isxdigit((unsigned char)*p); p++) {}
+        if (p == digits || (p == digits + 1 && *digits == '.')) return digits;
+        const char* exponent = p + 1 + (p[1] == '-' || p[1] == '+');
+        if ((*p | 0x20) != 'p' || !isDigit(*exponent)) return p;
+        for (p = exponent; isDigit(*p); p++) {}
+        return p;
+    } // hexEnd
+
+    /** \brief true if the out of range number [p, last) underflows rather than overflows: its
+        first significant digit is behind the point once the exponent is applied. */
+    static bool tooSmall(const char* p, const char* last, bool hex)
+    {
+        char        exponentLetter = hex ? 'p' : 'e';
+        long long   digitWeight = hex ? 4 : 1;  // a hex digit is 4 powers of the binary exponent
+        long long   magnitude = 0;
+
+
+        // Position of the first significant digit relative to the point, in powers of the base
+        while (p < last && *p == '0') p++;
+        for (; p < last && *p != '.' && (*p | 0x20) != exponentLetter; p++)
+            magnitude += digitWeight;
+        if (!magnitude && p < last && *p == '.')
+        {
+            for (p++; p < last && *p == '0'; p++)
+                magnitude -= digitWeight;
+        }
+        while (p < last && (*p | 0x20) != exponentLetter) p++;
+        if (p++ < last)
+        {
+            bool        negative = *p == '-';
+            long long   exponent = 0;
+            for (p += (*p == '-' || *p == '+') ? 1 : 0; p < last && exponent < LLONG_MAX / 100; p++)
+                exponent = exponent * 10 + (*p - '0');
+            magnitude += negative ? -exponent : exponent;
+        }
+        return magnitude <= 0;
+    } // tooSmall
+
+    static inline const char* skipSpaceAndSign(const char* p)
+    {
+        while (*p == ' ' || (*p >= '\t' && *p <= '\r')) p++;
+        if (*p == '-' || *p == '+') p++;
+        return p;
+    } // skipSpaceAndSign
+
+}; // NumberParser
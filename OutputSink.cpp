@@ -0,0 +1,86 @@
+#include "OutputSink.h"
+#include <cstdlib>
+#include <new>
+
+
+OutputSink::OutputSink(uint8_t targets, size_t capacity)
+    : m_buffer(nullptr), m_used(0), m_capacity(capacity ? capacity : 1), m_targets(targets), m_file(nullptr)
+{
+    m_buffer = (char*)malloc(m_capacity);
+    if (!m_buffer) throw std::bad_alloc();
+} // OutputSink
+
+
+OutputSink::~OutputSink()
+{
+    closeFile();
+    free(m_buffer);
+} // ~OutputSink
+
+
+/** \brief Opens the file used by OUTPUT_FILE. An already open file is flushed and closed. */
+bool OutputSink::openFile(const char* path)
+{
+    closeFile();
+    m_file = fopen(path, "wb");
+    if (!m_file) return false;
+    setvbuf(m_file, NULL, _IONBF, 0); // we do our own buffering
+    return true;
+} // openFile
+
+
+void OutputSink::closeFile()
+{
+    if (!m_file) return;
+    flush();
+    fclose(m_file);
+    m_file = nullptr;
+} // closeFile
+
+
+void OutputSink::setTargets(uint8_t targets)
+{
+    flush();
+    m_targets = targets;
+} // setTargets
+
+
+/** \brief Hands the buffered text to the targets. Has no effect in OUTPUT_MEMORY mode. */
+void OutputSink::flush()
+{
+    if (m_targets & OUTPUT_MEMORY) return;
+
+    if (m_used)
+    {
+        if ((m_targets & OUTPUT_FILE) && m_file) fwrite(m_buffer, 1, m_used, m_file);
+        if (m_targets & OUTPUT_STDOUT) fwrite(m_buffer, 1, m_used, stdout);
+        m_used = 0;
+    }
+    if (m_targets & OUTPUT_STDOUT) fflush(stdout);
+
+} // flush
+
+
+/** \brief Drops the buffered text without writing it. */
+void OutputSink::clear()
+{
+    m_used = 0;
+} // clear
+
+
+void OutputSink::makeRoom(size_t length)
+{
+    if (!(m_targets & OUTPUT_MEMORY))
+    {
+        flush();
+        if (length <= m_capacity) return;
+    }
+
+    size_t capacity = m_capacity;
+    while (capacity - m_used < length) capacity *= 2;
+    char* buffer = (char*)realloc(m_buffer, capacity);
+    if (!buffer) throw std::bad_alloc();
+    m_buffer = buffer;
+    m_capacity = capacity;
+
+} // makeRoom
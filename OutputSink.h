@@ -0,0 +1,90 @@
+#pragma once
+
+#include "types.h"
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+
+#define OUTPUT_BUFFER_SIZE (1024 * 1024)
+
+enum OutputTarget
+{
+    OUTPUT_NONE = 0,
+    OUTPUT_FILE = 1,
+    OUTPUT_STDOUT = 2,
+    OUTPUT_BOTH = OUTPUT_FILE | OUTPUT_STDOUT,
+    OUTPUT_MEMORY = 4       ///< Keep everything in the buffer, it grows instead of being flushed.
+};
+
+/** \brief Buffered writer below Com.
+
+Text is collected in one buffer that is allocated once and handed to the selected targets
+in large blocks when it runs full or flush() is called, never per line. In OUTPUT_MEMORY
+mode the buffer keeps growing and holds the complete output, which is how worker threads
+collect their part of the decoded file. */
+class OutputSink
+{
+public:
+    explicit OutputSink(uint8_t targets = OUTPUT_NONE, size_t capacity = OUTPUT_BUFFER_SIZE);
+    ~OutputSink();
+
+    OutputSink(const OutputSink&) = delete;
+    OutputSink& operator=(const OutputSink&) = delete;
+
+    bool openFile(const char* path);
+    void closeFile();
+    void setTargets(uint8_t targets);
+    void flush();
+    void clear();
+
+    inline void write(const char* text, size_t length)
+    {
+        if (length > m_capacity - m_used) makeRoom(length);
+        memcpy(m_buffer + m_used, text, length);
+        m_used += length;
+    } // write
+
+    inline void put(char c)
+    {
+        if (m_used == m_capacity) makeRoom(1);
+        m_buffer[m_used++] = c;
+    } // put
+
+    /** \brief Reserves length bytes at the end of the buffer for direct formatting.
+        The caller must commit() the number of bytes really written. */
+    inline char* reserve(size_t length)
+    {
+        if (length > m_capacity - m_used) makeRoom(length);
+        return m_buffer + m_used;
+    } // reserve
+
+    inline void commit(size_t length)
+    {
+        m_used += length;
+    } // commit
+
+    inline const char* data() const
+    {
+        return m_buffer;
+    } // data
+
+    inline size_t size() const
+    {
+        return m_used;
+    } // size
+
+    inline uint8_t getTargets() const
+    {
+        return m_targets;
+    } // getTargets
+
+private:
+    void makeRoom(size_t length);
+
+    char*       m_buffer;
+    size_t      m_used;
+    size_t      m_capacity;
+    uint8_t     m_targets;
+    FILE*       m_file;
+
+}; // OutputSink
@@ -0,0 +1,128 @@
+#include "ParallelDecoder.h"
+#include "BinaryDecoder.h"
+#include "Communication.h"
+#include "MappedFile.h"
+#include <algorithm>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/** Chunks which may be decoded ahead of the writer, per thread. */
+#define CHUNKS_AHEAD_PER_THREAD 2
+
+struct DecodedChunk
+{
+    std::unique_ptr<OutputSink> output;
+    size_t                      end = 0;
+    bool                        done = false;
+};
+
+
+/** \brief Decodes the file at path with threadCount threads and writes the result through Com.
+    The output is identical to a sequential BinaryDecoder::decodeRange() over the whole file
+    with the same filter, for damaged files too: a chunk starts at a command with a correct
+    checksum, which a damaged command behind it copies its fields from, just like in the
+    sequential decode. Returns false if the file can not be mapped. */
+bool ParallelDecoder::decodeFile(const char* path, unsigned int threadCount, size_t chunkSize, const CommandFilter* filter)
+{
+    MappedFile file;
+    if (!file.open(path)) return false;
+
+    size_t fileSize = file.size();
+    if (threadCount < 2 || !chunkSize || fileSize <= chunkSize)
+    {
+        BinaryDecoder::decodeRange(file, 0, fileSize, filter);
+        return true;
+    }
+
+    // Workers decode copies of their chunks, because parseBinary() terminates texts in place.
+    // The mapping stays unchanged for the boundary search, for the reads of the neighbour
+    // chunks behind a false boundary and for the sequential fallback.
+    size_t chunkCount = (fileSize + chunkSize - 1) / chunkSize;
+    std::vector<size_t> boundaries(chunkCount + 1);
+    boundaries[0] = 0;
+    for (size_t i = 1; i < chunkCount; i++)
+        boundaries[i] = BinaryDecoder::findCommandStart(file.data(), fileSize, std::max(i * chunkSize, boundaries[i - 1]));
+    boundaries[chunkCount] = fileSize;
+
+    std::vector<DecodedChunk> chunks(chunkCount);
+    std::mutex                mutex;
+    std::condition_variable   changed;
+    size_t                    nextChunk = 0;
+    size_t                    written = 0;
+    bool                      abort = false;
+    size_t                    window = (size_t)threadCount * CHUNKS_AHEAD_PER_THREAD;
+
+    auto worker = [&]()
+    {
+        std::vector<uint8_t> copy;
+        for (;;)
+        {
+            size_t index;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                changed.wait(lock, [&] { return abort || nextChunk >= chunkCount || nextChunk < written + window; });
+                if (abort || nextChunk >= chunkCount) return;
+                index = nextChunk++;
+            }
+
+            // Decoded text is about 1.5 times the binary size
+            DecodedChunk& chunk = chunks[index];
+            std::unique_ptr<OutputSink> output(new OutputSink(OUTPUT_MEMORY, 2 * chunkSize));
+            // The last command may reach MAX_CMD_SIZE2 - 1 bytes behind the chunk, a copy of that
+            // length decodes exactly like the whole file
+            size_t begin = boundaries[index];
+            size_t copyEnd = std::min(fileSize, boundaries[index + 1] + MAX_CMD_SIZE2);
+            copy.assign(file.data() + begin, file.data() + copyEnd);
+            Com::setThreadSink(output.get());
+            size_t end = begin + BinaryDecoder::decodeBuffer(copy.data(), copy.size(), boundaries[index + 1] - begin, filter);
+            Com::setThreadSink(nullptr);
+
+            std::lock_guard<std::mutex> lock(mutex);
+            chunk.output = std::move(output);
+            chunk.end = end;
+            chunk.done = true;
+            changed.notify_all();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (unsigned int i = 0; i < threadCount; i++)
+        threads.emplace_back(worker);
+
+    // A chunk may only be written if it really ends at the start of the next one. Otherwise
+    // that start was a false match and the rest is decoded sequentially, from the start of
+    // this chunk: a fresh DecoderContext in the middle of it would lose the fields that a
+    // damaged command copies from the command in front of it.
+    size_t resumeAt = fileSize;
+    for (size_t i = 0; i < chunkCount; i++)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        changed.wait(lock, [&] { return chunks[i].done; });
+        if (i + 1 < chunkCount && chunks[i].end != boundaries[i + 1])
+        {
+            resumeAt = boundaries[i];
+            abort = true;
+            changed.notify_all();
+            break;
+        }
+        lock.unlock();
+
+        Com::write(chunks[i].output->data(), chunks[i].output->size());
+        chunks[i].output.reset();
+
+        lock.lock();
+        written = i + 1;
+        changed.notify_all();
+    }
+
+    for (std::thread& thread : threads)
+        thread.join();
+
+    if (resumeAt < fileSize)
+        BinaryDecoder::decodeRange(file, resumeAt, fileSize, filter);
+    return true;
+
+} // decodeFile
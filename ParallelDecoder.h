@@ -0,0 +1,22 @@
+#pragma once
+
+#include "types.h"
+#include <cstddef>
+
+class CommandFilter;
+
+#define PARALLEL_CHUNK_SIZE (4 * 1024 * 1024)
+
+/** \brief Decodes one binary file on several threads.
+
+The file is cut into chunks of chunkSize bytes. The first command of each chunk is
+found with BinaryDecoder::findCommandStart(), every chunk is decoded into its own text
+buffer and the buffers are written strictly in file order. A chunk which does not end at
+the start of the next one is decoded again sequentially together with the rest of the file,
+so the output equals the sequential one for damaged files as well. */
+class ParallelDecoder
+{
+public:
+    static bool decodeFile(const char* path, unsigned int threadCount, size_t chunkSize = PARALLEL_CHUNK_SIZE, const CommandFilter* filter = nullptr);
+
+}; // ParallelDecoder
@@ -0,0 +1,320 @@
+#include "PipelineDecoder.h"
+#include "BinaryDecoder.h"
+#include "Communication.h"
+#include "DecoderContext.h"
+#include "MappedFile.h"
+#include "SpscQueue.h"
+#include "gcode.h"
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <utility>
+
+/** Blocks the reader may be ahead of the parser. */
+#define PIPELINE_BLOCKS_AHEAD 16
+
+/** Distance between the bytes the reader touches, one per page. */
+#define PIPELINE_PAGE_SIZE 4096
+
+typedef std::chrono::steady_clock Clock;
+
+/** \brief Commands of one part of the file on their way from the parser to the writer. */
+struct PipelineBatch
+{
+    std::vector<GCode>                          commands;       ///< PIPELINE_BATCH_COMMANDS, the first count are used.
+    std::vector<BatchRecord>                    records;
+    size_t                                      count = 0;
+    std::vector<std::pair<size_t, size_t>>      messageEnds;    ///< Command index and end of the messages printed while parsing it.
+    std::vector<std::unique_ptr<char[]>>        padded;         ///< Copies of texts of padded commands.
+    OutputSink                                  messages;       ///< Messages of parseBinary().
+    OutputSink                                  text;           ///< Formatted commands.
+
+    PipelineBatch()
+        : commands(PIPELINE_BATCH_COMMANDS), records(PIPELINE_BATCH_COMMANDS), messages(OUTPUT_MEMORY, 4096), text(OUTPUT_MEMORY)
+    {
+    }
+
+    void clear()
+    {
+        count = 0;
+        messageEnds.clear();
+        padded.clear();
+        messages.clear();
+        text.clear();
+    }
+};
+
+typedef std::unique_ptr<PipelineBatch> BatchPointer;
+
+
+/** \brief Measures the time a stage spends in the wait functions of its queues. */
+struct StageTimer
+{
+    PipelineStageReport&    report;
+    Clock::time_point       start = Clock::now();
+    double                  waiting = 0;
+
+    explicit StageTimer(PipelineStageReport& stage)
+        : report(stage)
+    {
+    }
+
+    template <typename Wait>
+    auto wait(Wait body) -> decltype(body())
+    {
+        Clock::time_point before = Clock::now();
+        auto result = body();
+        waiting += std::chrono::duration<double>(Clock::now() - before).count();
+        return result;
+    }
+
+    void finish()
+    {
+        double total = std::chrono::duration<double>(Clock::now() - start).count();
+        report.busySeconds += total - waiting;
+        report.waitSeconds += waiting;
+    }
+};
+
+
+void PipelineQueueReport::add(const PipelineQueueReport& other)
+{
+    capacity += other.capacity;
+    samples += other.samples;
+    sum += other.sum;
+    if (other.maximum > maximum) maximum = other.maximum;
+} // add
+
+
+/** \brief Decodes the file at path and writes the result through Com, see PipelineDecoder.
+    Returns false if the file can not be mapped. */
+bool PipelineDecoder::decodeFile(const char* path, unsigned int formatterThreads, PipelineReport& report, const CommandFilter* filter)
+{
+    MappedFile file;
+    if (!file.open(path)) return false;
+    if (!formatterThreads) formatterThreads = 1;
+
+    Clock::time_point   start = Clock::now();
+    uint8_t*            data = file.data();
+    size_t              fileSize = file.size();
+    unsigned int        count = formatterThreads;
+
+    // Queues are owned by unique_ptr, SpscQueue can neither be copied nor moved
+    SpscQueue<size_t>                               blocks(PIPELINE_BLOCKS_AHEAD);
+    std::vector<std::unique_ptr<SpscQueue<BatchPointer>>> parsed;
+    std::vector<std::unique_ptr<SpscQueue<BatchPointer>>> formatted;
+    SpscQueue<BatchPointer>                         recycled(2 * count * PIPELINE_QUEUE_SIZE + 2);
+    for (unsigned int i = 0; i < count; i++)
+    {
+        parsed.emplace_back(new SpscQueue<BatchPointer>(PIPELINE_QUEUE_SIZE));
+        formatted.emplace_back(new SpscQueue<BatchPointer>(PIPELINE_QUEUE_SIZE));
+    }
+
+    PipelineStageReport                 readStage, parseStage, writeStage;
+    std::vector<PipelineStageReport>    formatStages(count);
+    PipelineQueueReport                 blockQueue;
+    std::vector<PipelineQueueReport>    parsedQueues(count), formattedQueues(count);
+    volatile uint8_t                    touched = 0;
+
+
+    // Reader: faults the pages in, the parser only starts on bytes that are resident
+    std::thread reader([&]()
+    {
+        StageTimer timer(readStage);
+
+        for (size_t offset = 0; offset < fileSize; offset += PIPELINE_BLOCK_SIZE)
+        {
+            size_t  end = std::min(fileSize, offset + PIPELINE_BLOCK_SIZE);
+            uint8_t sum = 0;
+
+            file.adviseWillNeed(end, PIPELINE_BLOCK_SIZE);
+            for (size_t page = offset; page < end; page += PIPELINE_PAGE_SIZE)
+                sum += data[page];
+            touched = sum;
+            readStage.bytes = end;
+
+            size_t* slot = timer.wait([&] { return blocks.waitForSpace(); });
+            *slot = end;
+            blocks.push();
+            blockQueue.sample(blocks.size());
+        }
+        blocks.close();
+        timer.finish();
+    });
+
+    // Parser: decodeBatch() with one context like decodeRange(), but into large batches
+    std::thread parser([&]()
+    {
+        StageTimer      timer(parseStage);
+        DecoderContext  context;
+        size_t          offset = 0;
+        size_t          available = 0;
+        size_t          batchIndex = 0;
+        BatchPointer    batch;
+
+
+        auto dispatch = [&]()
+        {
+            SpscQueue<BatchPointer>& queue = *parsed[batchIndex % count];
+            BatchPointer* slot = timer.wait([&] { return queue.waitForSpace(); });
+            parseStage.commands += batch->count;
+            *slot = std::move(batch);
+            queue.push();
+            parsedQueues[batchIndex % count].sample(queue.size());
+            batchIndex++;
+        };
+
+        while (offset < fileSize && fileSize - offset > MIN_CMD_SIZE)
+        {
+            // parseBinary() writes into the commands, which have to end in front of the reader
+            while (available < fileSize && available <= offset + 2 * MAX_CMD_SIZE2)
+            {
+                size_t blockCount = timer.wait([&] { return blocks.waitForData(); });
+                if (!blockCount) break;
+                available = blocks.at(blockCount - 1);
+                blocks.pop(blockCount);
+            }
+            if (!batch)
+            {
+                if (BatchPointer* reused = recycled.front())
+                {
+                    batch = std::move(*reused);
+                    recycled.pop();
+                    batch->clear();
+                }
+                else batch.reset(new PipelineBatch());
+                Com::setThreadSink(&batch->messages);
+            }
+
+            size_t first = batch->count;
+            size_t limit = (available < fileSize ? available - 2 * MAX_CMD_SIZE2 : fileSize) - offset;
+            size_t messageSize = batch->messages.size();
+            size_t decoded;
+            size_t step = BinaryDecoder::decodeBatch(data + offset, fileSize - offset, limit, &batch->commands[first], &batch->records[first],
+                PIPELINE_BATCH_COMMANDS - first, decoded, context, filter);
+            offset += step;
+            parseStage.bytes += step;
+            batch->count += decoded;
+
+            // Messages are printed for the first record of a batch only
+            if (batch->messages.size() != messageSize)
+                batch->messageEnds.push_back(std::make_pair(first, batch->messages.size()));
+            GCode& command = batch->commands[first];
+            if (decoded && batch->records[first].status == RECORD_BAD_HEADER && command.hasString() && command.text)
+            {
+                // The text points into the context, which the next call reuses
+                size_t length = strlen(command.text) + 1;
+                batch->padded.emplace_back(new char[length]);
+                command.text = (char*)memcpy(batch->padded.back().get(), command.text, length);
+            }
+
+            if (batch->count == PIPELINE_BATCH_COMMANDS) dispatch();
+        }
+        if (batch) dispatch();
+        Com::setThreadSink(nullptr);
+        for (auto& queue : parsed)
+            queue->close();
+        timer.finish();
+    });
+
+    // Formatters: messages and commands into the text of the batch, in parse order
+    std::vector<std::thread> formatters;
+    for (unsigned int i = 0; i < count; i++)
+    {
+        formatters.emplace_back([&, i]()
+        {
+            PipelineStageReport&    stage = formatStages[i];
+            StageTimer              timer(stage);
+            SpscQueue<BatchPointer>& input = *parsed[i];
+            SpscQueue<BatchPointer>& output = *formatted[i];
+
+            while (timer.wait([&] { return input.waitForData(); }))
+            {
+                BatchPointer batch = std::move(input.at(0));
+                input.pop();
+
+                size_t messageStart = 0;
+                size_t mark = 0;
+                Com::setThreadSink(&batch->text);
+                for (size_t index = 0; index < batch->count; index++)
+                {
+                    while (mark < batch->messageEnds.size() && batch->messageEnds[mark].first == index)
+                    {
+                        size_t messageEnd = batch->messageEnds[mark++].second;
+                        batch->text.write(batch->messages.data() + messageStart, messageEnd - messageStart);
+                        messageStart = messageEnd;
+                    }
+                    batch->commands[index].echoCommand();
+                }
+                if (messageStart < batch->messages.size()) // of commands dropped by the filter at the end
+                    batch->text.write(batch->messages.data() + messageStart, batch->messages.size() - messageStart);
+                Com::setThreadSink(nullptr);
+                stage.bytes += batch->text.size();
+                stage.commands += batch->count;
+
+                BatchPointer* slot = timer.wait([&] { return output.waitForSpace(); });
+                *slot = std::move(batch);
+                output.push();
+                formattedQueues[i].sample(output.size());
+            }
+            output.close();
+            timer.finish();
+        });
+    }
+
+    // Writer: batches in the order they were parsed
+    {
+        StageTimer timer(writeStage);
+        for (size_t index = 0;; index++)
+        {
+            SpscQueue<BatchPointer>& queue = *formatted[index % count];
+            if (!timer.wait([&] { return queue.waitForData(); })) break;
+
+            BatchPointer batch = std::move(queue.at(0));
+            queue.pop();
+            Com::write(batch->text.data(), batch->text.size());
+            writeStage.bytes += batch->text.size();
+            writeStage.commands += batch->count;
+            recycled.tryPush(std::move(batch));
+        }
+        timer.finish();
+    }
+
+    reader.join();
+    parser.join();
+    for (std::thread& formatter : formatters)
+        formatter.join();
+    report.seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    readStage.name = "read";
+    parseStage.name = "parse";
+    writeStage.name = "write";
+    PipelineStageReport formatStage;
+    formatStage.name = "format";
+    formatStage.threads = count;
+    for (const PipelineStageReport& stage : formatStages)
+    {
+        formatStage.bytes += stage.bytes;
+        formatStage.commands += stage.commands;
+        formatStage.busySeconds += stage.busySeconds;
+        formatStage.waitSeconds += stage.waitSeconds;
+    }
+    report.stages = { readStage, parseStage, formatStage, writeStage };
+
+    blockQueue.name = "blocks";
+    blockQueue.capacity = blocks.capacity();
+    PipelineQueueReport parsedQueue, formattedQueue;
+    parsedQueue.name = "parsed";
+    formattedQueue.name = "formatted";
+    for (unsigned int i = 0; i < count; i++)
+    {
+        parsedQueues[i].capacity = parsed[i]->capacity();
+        formattedQueues[i].capacity = formatted[i]->capacity();
+        parsedQueue.add(parsedQueues[i]);
+        formattedQueue.add(formattedQueues[i]);
+    }
+    report.queues = { blockQueue, parsedQueue, formattedQueue };
+    return true;
+
+} // decodeFile
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "types.h"
+#include <cstddef>
+#include <vector>
+
+/** Bytes the reader stage maps in before it hands them to the parser. */
+#define PIPELINE_BLOCK_SIZE (1024 * 1024)
+
+/** Commands parsed into one batch. */
+#define PIPELINE_BATCH_COMMANDS 16384
+
+/** Batches each queue between parser, formatters and writer holds. */
+#define PIPELINE_QUEUE_SIZE 4
+
+/** \brief Work and waiting time of one stage of PipelineDecoder. */
+struct PipelineStageReport
+{
+    const char*     name = "";
+    unsigned int    threads = 1;
+    size_t          bytes = 0;          ///< Bytes read, parsed, formatted or written.
+    size_t          commands = 0;       ///< Commands handled.
+    double          busySeconds = 0;    ///< Time spent working, summed over the threads.
+    double          waitSeconds = 0;    ///< Time spent waiting for input or for room in the next queue.
+};
+
+/** \brief Occupancy of the queues between two stages, sampled whenever an element is pushed. */
+struct PipelineQueueReport
+{
+    const char*     name = "";
+    size_t          capacity = 0;       ///< Elements all queues of the stage hold together.
+    size_t          samples = 0;
+    size_t          sum = 0;
+    size_t          maximum = 0;
+
+    inline void sample(size_t occupancy)
+    {
+        samples++;
+        sum += occupancy;
+        if (occupancy > maximum) maximum = occupancy;
+    } // sample
+
+    inline double average() const
+    {
+        return samples ? (double)sum / samples : 0;
+    } // average
+
+    void add(const PipelineQueueReport& other);
+};
+
+class CommandFilter;
+
+/** \brief Result of PipelineDecoder::decodeFile(). */
+struct PipelineReport
+{
+    double                              seconds = 0;
+    std::vector<PipelineStageReport>    stages;     ///< read, parse, format, write
+    std::vector<PipelineQueueReport>    queues;     ///< blocks, parsed, formatted
+};
+
+/** \brief Decodes one binary file in four stages on their own threads.
+
+The reader maps the file and touches it block by block, the parser walks the commands like
+BinaryDecoder::decodeRange() and collects them in batches, formatterThreads formatters turn
+batches into text and the calling thread writes the texts through Com in file order. The
+stages are connected by SpscQueue rings: batch k goes to formatter k % formatterThreads and
+the writer takes it from the same formatter, so the order is kept without locks. Batches
+are handed back to the parser for reuse. The output is identical to decodeRange() over the
+whole file with the same filter, the report shows which stage limits the throughput. */
+class PipelineDecoder
+{
+public:
+    static bool decodeFile(const char* path, unsigned int formatterThreads, PipelineReport& report, const CommandFilter* filter = nullptr);
+
+}; // PipelineDecoder
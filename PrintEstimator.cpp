@@ -0,0 +1,251 @@
+#include "PrintEstimator.h"
+#include "BinaryDecoder.h"
+#include "CommandStore.h"
+#include "MappedFile.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+/** Moves shorter than this (mm) are dropped. */
+#define ESTIMATOR_MIN_LENGTH 1e-6f
+
+
+/** \brief Parses comma separated key=value pairs: accel, retract-accel, jerk (X and Y),
+    z-jerk, e-jerk, feedrate (X and Y), z-feedrate, e-feedrate and diameter. */
+bool EstimatorOptions::parse(const char* text)
+{
+    while (*text)
+    {
+        const char* end = strchr(text, ',');
+        const char* equals = strchr(text, '=');
+        size_t      length = end ? (size_t)(end - text) : strlen(text);
+        if (!equals || (end && equals > end)) return false;
+
+        char* last;
+        float value = strtof(equals + 1, &last);
+        std::string key(text, equals - text);
+        if (last != (end ? end : text + length) || value < 0) return false;
+        if (value == 0 && key.find("jerk") == std::string::npos) return false;  // a jerk of 0 stops at every corner
+        if (key == "accel") acceleration = value;
+        else if (key == "retract-accel") retractAcceleration = value;
+        else if (key == "jerk") jerk[0] = jerk[1] = value;
+        else if (key == "z-jerk") jerk[2] = value;
+        else if (key == "e-jerk") jerk[3] = value;
+        else if (key == "feedrate") maxFeedrate[0] = maxFeedrate[1] = value;
+        else if (key == "z-feedrate") maxFeedrate[2] = value;
+        else if (key == "e-feedrate") maxFeedrate[3] = value;
+        else if (key == "diameter") filamentDiameter = value;
+        else return false;
+        text += length + (end ? 1 : 0);
+    }
+    return true;
+
+} // parse
+
+
+PrintEstimator::PrintEstimator(const EstimatorOptions& options)
+    : m_options(options), m_state(), m_previous(), m_moving(false), m_firstFixed(false), m_layerZ(0)
+{
+    m_report.layers.resize(1);
+    m_report.layerZ.push_back(0);
+    m_blocks.reserve(PLANNER_BATCH);
+
+} // PrintEstimator
+
+
+/** \brief Adds a move by delta (X, Y, Z, E) at the feedrate and with the tool of m_state. */
+void PrintEstimator::addMove(const float* delta)
+{
+    float           xyz = std::sqrt(delta[0] * delta[0] + delta[1] * delta[1] + delta[2] * delta[2]);
+    float           length = xyz > ESTIMATOR_MIN_LENGTH ? xyz : std::fabs(delta[3]);
+    PlannerBlock    block;
+
+
+    if (length <= ESTIMATOR_MIN_LENGTH) return;
+    block.length = length;
+    block.acceleration = xyz > ESTIMATOR_MIN_LENGTH ? m_options.acceleration : m_options.retractAcceleration;
+    block.nominal = m_state.f > 0 ? m_state.f * (1.0f / 60) : m_options.maxFeedrate[0];
+    float inverse = 1 / length;
+    for (int axis = 0; axis < 4; axis++)
+    {
+        block.unit[axis] = delta[axis] * inverse;
+        float component = std::fabs(block.unit[axis]);
+        if (component * block.nominal > m_options.maxFeedrate[axis]) block.nominal = m_options.maxFeedrate[axis] / component;
+    }
+
+    // Jerk: the speed of no axis may jump by more than its jerk, from rest or from the previous move
+    block.maxEntry = m_moving ? std::min(block.nominal, m_previous.nominal) : block.nominal;
+    for (int axis = 0; axis < 4; axis++)
+    {
+        float change = std::fabs(block.unit[axis] - (m_moving ? m_previous.unit[axis] : 0));
+        if (change * block.maxEntry > m_options.jerk[axis]) block.maxEntry = m_options.jerk[axis] / change;
+    }
+    block.entry = block.maxEntry;
+    block.extrusion = delta[3];
+    block.layer = (uint32_t)(m_report.layers.size() - 1);
+    block.tool = m_state.tool < MACHINE_TOOLS ? m_state.tool : 0;
+
+    m_blocks.push_back(block);
+    m_previous = block;
+    m_moving = true;
+    m_report.moves++;
+    if (m_blocks.size() >= PLANNER_BATCH) plan(false);
+
+} // addMove
+
+
+/** \brief The machine stops: all moves are final and the next one starts from rest. */
+void PrintEstimator::stop()
+{
+    plan(true);
+    m_moving = false;
+
+} // stop
+
+
+/** \brief Sets the entry speeds of the buffered moves and accounts all but the newest
+    PLANNER_LOOKAHEAD, with final all of them, the last one ending at rest. */
+void PrintEstimator::plan(bool final)
+{
+    size_t count = m_blocks.size();
+    if (!count || (!final && count <= PLANNER_LOOKAHEAD)) return;
+
+    // Backward: every move must be able to stop at the end of the buffer
+    float exit = 0;
+    for (size_t i = count; i-- > (m_firstFixed ? 1u : 0u);)
+    {
+        PlannerBlock& block = m_blocks[i];
+        block.entry = std::min(block.maxEntry, std::sqrt(exit * exit + 2 * block.acceleration * block.length));
+        exit = block.entry;
+    }
+
+    // Forward: no move can start faster than the one in front of it reaches
+    for (size_t i = 0; i + 1 < count; i++)
+    {
+        const PlannerBlock& block = m_blocks[i];
+        float               reach = std::sqrt(block.entry * block.entry + 2 * block.acceleration * block.length);
+        if (m_blocks[i + 1].entry > reach) m_blocks[i + 1].entry = reach;
+    }
+
+    size_t done = final ? count : count - PLANNER_LOOKAHEAD;
+    for (size_t i = 0; i < done; i++)
+        account(m_blocks[i], i + 1 < count ? m_blocks[i + 1].entry : 0);
+    m_blocks.erase(m_blocks.begin(), m_blocks.begin() + done);
+    m_firstFixed = !m_blocks.empty();
+
+} // plan
+
+
+/** \brief Adds the time of the trapezoid from the entry to exit speed of block to the totals. */
+void PrintEstimator::account(const PlannerBlock& block, float exit)
+{
+    float   entry = block.entry;
+    float   nominal = std::max(block.nominal, std::max(entry, exit));
+    float   acceleration = block.acceleration;
+    float   accelerate = (nominal * nominal - entry * entry) / (2 * acceleration);
+    float   decelerate = (nominal * nominal - exit * exit) / (2 * acceleration);
+    double  time;
+
+
+    if (accelerate + decelerate <= block.length)
+        time = (nominal - entry) / acceleration + (nominal - exit) / acceleration + (block.length - accelerate - decelerate) / nominal;
+    else
+    {
+        // No cruise: accelerate up to the peak speed where both ramps meet
+        float peak = std::sqrt((2 * acceleration * block.length + entry * entry + exit * exit) / 2);
+        peak = std::max(peak, std::max(entry, exit));
+        time = (2 * peak - entry - exit) / acceleration;
+    }
+
+    m_report.total.time += time;
+    m_report.total.filament += block.extrusion;
+    m_report.tools[block.tool].time += time;
+    m_report.tools[block.tool].filament += block.extrusion;
+    m_report.layers[block.layer].time += time;
+    m_report.layers[block.layer].filament += block.extrusion;
+
+} // account
+
+
+/** \brief Adds the commands of store in order. */
+void PrintEstimator::add(const CommandStore& store)
+{
+    const uint16_t* params = store.params.data();
+    size_t          count = store.size();
+    MachineState&   state = m_state;
+
+
+    for (size_t i = 0; i < count; i++)
+    {
+        uint32_t bits = params[i];
+        uint32_t G = store.G[i];
+        state.f = (bits & 256) ? store.F[i] : state.f;
+        if ((bits & 6) == 4 && G <= 1)
+        {
+            float before[4] = { state.position[0], state.position[1], state.position[2], state.position[3] };
+            bool  extruding = state.move(bits, store.X[i], store.Y[i], store.Z[i], store.E[i]);
+            float delta[4] = { state.position[0] - before[0], state.position[1] - before[1], state.position[2] - before[2], state.position[3] - before[3] };
+
+            if (extruding && (m_report.layers.size() == 1 || state.position[2] > m_layerZ))
+            {
+                m_layerZ = state.position[2];
+                m_report.layers.emplace_back();
+                m_report.layerZ.push_back(m_layerZ);
+            }
+            addMove(delta);
+            continue;
+        }
+        if (!(bits & (2 | 4 | 512))) continue;
+
+        uint32_t M = store.M[i];
+        if ((bits & 4) && G == 4)
+        {
+            double dwell = (bits & 2048) ? store.P[i] / 1000.0 : (bits & 1024) ? (double)store.S[i] : 0;
+            stop();
+            m_report.dwell += dwell;
+            m_report.total.time += dwell;
+            m_report.tools[state.tool < MACHINE_TOOLS ? state.tool : 0].time += dwell;
+            m_report.layers.back().time += dwell;
+        }
+        else if ((bits & 2) && (M == 109 || M == 190))
+        {
+            stop();
+            m_report.waits++;
+        }
+        state.applyModal(bits, M, G, store.S[i], store.T[i], store.X[i], store.Y[i], store.Z[i], store.E[i]);
+    }
+    m_report.commands += count;
+
+} // add
+
+
+/** \brief Plans the remaining moves, the machine ends at rest. */
+void PrintEstimator::finish()
+{
+    stop();
+
+} // finish
+
+
+/** \brief Decodes the commands starting in [begin, end) into columns and adds them. Does not
+    call finish(). Returns the offset behind the last command. */
+size_t PrintEstimator::estimateRange(MappedFile& file, size_t begin, size_t end)
+{
+    CommandStore    store;
+    size_t          offset = begin;
+
+
+    store.reserve(ESTIMATOR_BATCH);
+    while (offset < end)
+    {
+        store.clear();
+        size_t next = BinaryDecoder::decodeColumns(file, offset, end, store, ESTIMATOR_BATCH);
+        if (next == offset) break;
+        offset = next;
+        add(store);
+    }
+    return offset;
+
+} // estimateRange
@@ -0,0 +1,106 @@
+#pragma once
+
+#include "types.h"
+#include "MachineState.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class CommandStore;
+class MappedFile;
+
+/** Moves planned at once. The last PLANNER_LOOKAHEAD of them wait for the following moves. */
+#define PLANNER_BATCH 4096
+
+/** Moves in front of the newest one whose exit speed is still open, like the block buffer
+    of a firmware. */
+#define PLANNER_LOOKAHEAD 64
+
+/** Commands decoded into the CommandStore at once by PrintEstimator::estimateRange(). */
+#define ESTIMATOR_BATCH 16384
+
+/** \brief Machine limits of the motion model, speeds in mm/s, accelerations in mm/s². */
+struct EstimatorOptions
+{
+    float   acceleration = 1000;            ///< Moves with X, Y or Z.
+    float   retractAcceleration = 1500;     ///< Moves of E alone.
+    float   jerk[4] = { 10, 10, 0.4f, 5 };  ///< Largest instant speed change of X, Y, Z, E.
+    float   maxFeedrate[4] = { 300, 300, 12, 120 };
+    float   filamentDiameter = 1.75f;       ///< mm, for the filament volume.
+
+    bool parse(const char* text);
+};
+
+/** \brief Time and filament of one tool or one layer. */
+struct EstimateTotals
+{
+    double  time = 0;       ///< Seconds.
+    double  filament = 0;   ///< mm of filament fed, retractions subtracted.
+};
+
+/** \brief Result of PrintEstimator. */
+struct EstimateReport
+{
+    EstimateTotals              total;
+    EstimateTotals              tools[MACHINE_TOOLS];
+    std::vector<EstimateTotals> layers;         ///< Index 0 holds the moves in front of the first layer.
+    std::vector<float>          layerZ;         ///< Height of every layer, 0 for index 0.
+    size_t                      commands = 0;
+    size_t                      moves = 0;
+    size_t                      waits = 0;      ///< M109/M190, their heating time is not known.
+    double                      dwell = 0;      ///< Seconds of G4, part of total.time.
+};
+
+/** \brief A move of the planner, speeds in mm/s. */
+struct PlannerBlock
+{
+    float       unit[4];        ///< Direction of X, Y, Z, E per mm of length.
+    float       length;         ///< Length in XYZ, in E for moves of E alone.
+    float       nominal;        ///< Feedrate, limited per axis.
+    float       acceleration;
+    float       maxEntry;       ///< Speed allowed by the jerk limits at the junction to the previous move.
+    float       entry;
+    float       extrusion;      ///< E of the move.
+    uint32_t    layer;
+    uint8_t     tool;
+};
+
+/** \brief Estimates the print time and the filament of binary files from the decoded columns.
+
+Positions and modes are tracked by MachineState. Every move becomes a PlannerBlock with a
+trapezoid speed profile: its entry speed is limited by the jerk at the junction to the previous
+move, by decelerating to a stop at the end of the buffered moves (backward pass) and by what the
+previous move can reach (forward pass). Moves are planned in batches of PLANNER_BATCH. All but
+the newest PLANNER_LOOKAHEAD are then final and are added to the totals per tool and layer, so the
+cost is linear and the memory bounded. A layer starts with the first extruding move above the
+last layer. G4 adds its dwell time and, like M109 and M190, stops the machine. */
+class PrintEstimator
+{
+public:
+    explicit PrintEstimator(const EstimatorOptions& options = EstimatorOptions());
+
+    void add(const CommandStore& store);
+    void finish();
+    size_t estimateRange(MappedFile& file, size_t begin, size_t end);
+
+    inline const EstimateReport& report() const
+    {
+        return m_report;
+    } // report
+
+private:
+    void addMove(const float* delta);
+    void stop();
+    void plan(bool final);
+    void account(const PlannerBlock& block, float exit);
+
+    EstimatorOptions            m_options;
+    EstimateReport              m_report;
+    MachineState                m_state;
+    std::vector<PlannerBlock>   m_blocks;
+    PlannerBlock                m_previous;     ///< Last move added, for the junction to the next one.
+    bool                        m_moving;       ///< false at the start and behind a stop.
+    bool                        m_firstFixed;   ///< The entry of m_blocks[0] was used by the move in front of it.
+    float                       m_layerZ;
+
+}; // PrintEstimator
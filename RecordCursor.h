@@ -0,0 +1,203 @@
+#pragma once
+
+#include "types.h"
+#include "BinaryDecoder.h"
+#include "BinaryLayout.h"
+#include "Checksum.h"
+#include "gcode.h"
+#include <cstddef>
+#include <cstring>
+
+/** \brief Fields a RecordCursor materializes. The values are the bits of the first bitfield,
+    the bits of the V2 bitfield (I, J, R) are shifted by 16. */
+enum CommandField : uint32_t
+{
+    FIELD_N = 1,
+    FIELD_M = 2,
+    FIELD_G = 4,
+    FIELD_X = 8,
+    FIELD_Y = 16,
+    FIELD_Z = 32,
+    FIELD_E = 64,
+    FIELD_F = 256,
+    FIELD_T = 512,
+    FIELD_S = 1024,
+    FIELD_P = 2048,
+    FIELD_TEXT = 32768,
+    FIELD_I = 1 << 16,
+    FIELD_J = 2 << 16,
+    FIELD_R = 4 << 16,
+    FIELD_ALL = 0x78f7f                 ///< Every field above.
+};
+
+/** \brief Walks the commands of a binary file and decodes only the fields asked for.
+
+Commands are stepped like BinaryDecoder::nextCommand() using nothing but the header and
+BinaryLayout::size(); a command with an implausible size is counted as error and skipped
+with its 5 header bytes. Of the current command only the requested fields are read, the
+others are neither loaded nor converted, so a job that needs M codes, temperatures or tool
+changes pays for the headers and a few bytes per command. The checksums are only verified
+if asked for. The data is never written to, a text is copied into the cursor. */
+class RecordCursor
+{
+public:
+    RecordCursor(const uint8_t* data, size_t length, uint32_t fields, bool verify = false)
+        : m_data(data), m_length(length), m_next(0), m_offset(0), m_errors(0), m_fields(fields),
+          m_verify(verify), m_size(0)
+    {
+        memset(&m_command, 0, sizeof(m_command));
+        m_text[0] = 0;
+    } // RecordCursor
+
+    /** \brief Moves to the next command, returns false behind the last one. */
+    inline bool next()
+    {
+        while (m_next < m_length && m_length - m_next > MIN_CMD_SIZE)
+        {
+            const uint8_t*  record = m_data + m_next;
+            uint8_t         size = BinaryLayout::size(record);
+
+            m_offset = m_next;
+            if (size > MAX_CMD_SIZE2 || size > m_length - m_next)
+            {
+                m_next += MIN_CMD_SIZE;
+                m_errors++;
+                continue;
+            }
+            m_next += size > MIN_CMD_SIZE ? size : MIN_CMD_SIZE;
+            if (m_verify && !Checksum::verify(record, size))
+            {
+                m_errors++;
+                continue;
+            }
+            m_size = size;
+            materialize(record, size);
+            return true;
+        }
+        return false;
+    } // next
+
+    /** \brief The current command with the requested fields which are present in it. */
+    inline GCode& command()
+    {
+        return m_command;
+    } // command
+
+    /** \brief True if the current command has none of the requested fields. */
+    inline bool empty() const
+    {
+        return !(m_command.params & m_fields & 0xffff) && !(m_command.params2 & (m_fields >> 16));
+    } // empty
+
+    inline size_t offset() const
+    {
+        return m_offset;
+    } // offset
+
+    inline uint8_t size() const
+    {
+        return m_size;
+    } // size
+
+    /** \brief Commands with an implausible size or a wrong checksum skipped so far. */
+    inline size_t errors() const
+    {
+        return m_errors;
+    } // errors
+
+    /** \brief Converts a list of field letters like "MST" or "M,S,T,text" into CommandField bits.
+        Returns 0 for an unknown field. */
+    static inline uint32_t parseFields(const char* list)
+    {
+        static const char       letters[] = "NMGXYZEFTSPIJR";
+        static const uint32_t   bits[] = { FIELD_N, FIELD_M, FIELD_G, FIELD_X, FIELD_Y, FIELD_Z, FIELD_E,
+                                           FIELD_F, FIELD_T, FIELD_S, FIELD_P, FIELD_I, FIELD_J, FIELD_R };
+        uint32_t fields = 0;
+
+
+        for (const char* p = list; *p; p++)
+        {
+            if (*p == ',') continue;
+            if (!strncmp(p, "text", 4))
+            {
+                fields |= FIELD_TEXT;
+                p += 3;
+                continue;
+            }
+            const char* letter = strchr(letters, *p);
+            if (!letter) return 0;
+            fields |= bits[letter - letters];
+        }
+        return fields;
+    } // parseFields
+
+private:
+    inline void materialize(const uint8_t* record, uint8_t size)
+    {
+        uint16_t        bits = BinaryLayout::bitfield(record);
+        uint16_t        bits2 = 0;
+        uint16_t        wanted = (uint16_t)m_fields;
+        const uint8_t*  p = record + 2;
+        bool            v2 = (bits & 4096) != 0;
+        uint8_t         textlen = 16;
+
+
+        if (v2)
+        {
+            bits2 = BinaryLayout::bitfield(p);
+            p += 2;
+            if (bits & 32768) textlen = *p++;
+        }
+
+        GCode& c = m_command;
+        c.params = (bits & wanted) | (bits & (128 | 4096));
+        c.params2 = bits2 & (m_fields >> 16);
+        if (!(c.params & wanted) && !c.params2) return; // nothing requested in this command
+
+        const LowFieldLayout&   low = BinaryLayout::low(bits);
+        const HighFieldLayout&  high = BinaryLayout::high(bits);
+        const uint8_t*          highFields = p + low.length;
+
+        if (c.params & 1) c.N = BinaryLayout::field<uint16_t>(p + low.N);
+        if (c.params & 2) c.M = v2 ? BinaryLayout::field<uint16_t>(p + low.M) : p[low.M];
+        if (c.params & 4) c.G = v2 ? BinaryLayout::field<uint16_t>(p + low.G) : p[low.G];
+        if (c.params & 8) c.X = BinaryLayout::field<float>(p + low.X);
+        if (c.params & 16) c.Y = BinaryLayout::field<float>(p + low.Y);
+        if (c.params & 32) c.Z = BinaryLayout::field<float>(p + low.Z);
+        if (c.params & 64) c.E = BinaryLayout::field<float>(p + low.E);
+        if (c.params & 256) c.F = BinaryLayout::field<float>(highFields + high.F);
+        if (c.params & 512) c.T = highFields[high.T];
+        if (c.params & 1024) c.S = BinaryLayout::field<int32_t>(highFields + high.S);
+        if (c.params & 2048) c.P = BinaryLayout::field<int32_t>(highFields + high.P);
+        if (!c.params2 && !(c.params & 32768)) return;
+
+        const ExtFieldLayout&   ext = BinaryLayout::ext(bits2);
+        const uint8_t*          extFields = highFields + high.length;
+        if (c.params2 & 1) c.I = BinaryLayout::field<float>(extFields + ext.I);
+        if (c.params2 & 2) c.J = BinaryLayout::field<float>(extFields + ext.J);
+        if (c.params2 & 4) c.R = BinaryLayout::field<float>(extFields + ext.R);
+        if (c.params & 32768)
+        {
+            // Same bounds as the terminator written by parseBinary()
+            const char* text = (const char*)(extFields + ext.length);
+            int         available = (int)size - 2 - (int)((const uint8_t*)text - record);
+            size_t      length = textlen > available ? (available > 0 ? (size_t)available : 0) : textlen;
+
+            memcpy(m_text, text, length);
+            m_text[length] = 0;
+            c.text = m_text;
+        }
+    } // materialize
+
+    const uint8_t*  m_data;
+    size_t          m_length;
+    size_t          m_next;         ///< Offset of the next command.
+    size_t          m_offset;       ///< Offset of the current command.
+    size_t          m_errors;
+    uint32_t        m_fields;
+    bool            m_verify;
+    uint8_t         m_size;
+    GCode           m_command;
+    char            m_text[MAX_CMD_SIZE2];
+
+}; // RecordCursor
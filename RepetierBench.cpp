@@ -0,0 +1,782 @@
+// RepetierBench.cpp : Micro benchmarks and end to end throughput of the decoder.
+//
+// Every benchmark runs --repeat times, the fastest run is reported with MB/s, commands/s
+// and the heap allocations per command. Results go to stdout or --output as text, json or csv.
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cerrno>
+#include <chrono>
+#include <climits>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <new>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "BinaryDecoder.h"
+#include "BinaryEncoder.h"
+#include "Checksum.h"
+#include "CommandFilter.h"
+#include "CommandStore.h"
+#include "Communication.h"
+#include "DecoderContext.h"
+#include "gcode.h"
+#include "MachineState.h"
+#include "MappedFile.h"
+#include "OutputSink.h"
+#include "ParallelDecoder.h"
+#include "PipelineDecoder.h"
+#include "PrintEstimator.h"
+#include "RecordCursor.h"
+
+/** Default size of the synthetic corpus in MB. */
+#define BENCH_SYNTHETIC_SIZE 64
+
+/** Number of commands prepared for the micro benchmarks of one input. */
+#define BENCH_MICRO_COMMANDS (1024 * 1024)
+
+/** Size of the pieces fed to DecoderContext::feed(), about one read() from a pipe. */
+#define BENCH_FEED_SIZE 4096
+
+/** Number of commands decoded per BinaryDecoder::decodeBatch() call. */
+#define BENCH_DECODE_BATCH 1024
+
+/** Filter of the decodeFiltered benchmark: temperatures, tool changes and homing. */
+#define BENCH_FILTER "M104,M109,M140,M190,T,G28"
+
+/** Number of records decoded into the CommandStore at once. */
+#define BENCH_STORE_BATCH (1024 * 1024)
+
+
+static std::atomic<size_t> allocations(0);
+
+void* operator new(size_t size)
+{
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    void* p = malloc(size ? size : 1);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+void operator delete(void* p) noexcept
+{
+    free(p);
+}
+
+void operator delete(void* p, size_t) noexcept
+{
+    free(p);
+}
+
+
+struct BenchOptions
+{
+    std::vector<std::string>    inputs;
+    unsigned int                repeat = 5;
+    size_t                      syntheticSize = BENCH_SYNTHETIC_SIZE;
+    unsigned int                seed = 1;
+    unsigned int                threads = 0;
+    std::string                 format = "text";
+    std::string                 output;
+    std::string                 filter;
+};
+
+struct BenchResult
+{
+    std::string     name;
+    std::string     input;
+    size_t          bytes;
+    size_t          commands;
+    double          seconds;
+    size_t          allocations;
+};
+
+/** \brief An input file with the commands prepared for the micro benchmarks. */
+struct Corpus
+{
+    std::string             name;
+    std::string             path;
+    size_t                  size = 0;
+    size_t                  commands = 0;           ///< Commands of the whole file.
+    std::vector<uint8_t>    binary;                 ///< Copy of the first commands.
+    std::vector<size_t>     offsets;                ///< Offsets of the commands in binary.
+    std::vector<uint8_t>    sizes;
+    std::vector<char>       ascii;                  ///< The same commands decoded, one zero terminated line each.
+    std::vector<size_t>     lines;                  ///< Offsets of the lines in ascii.
+    std::vector<GCode>      gcodes;                 ///< The same commands parsed.
+};
+
+
+static void printUsage()
+{
+    std::cerr << "Usage: RepetierBench [options] [file.gco ...]" << std::endl;
+    std::cerr << "  --repeat=N          runs per benchmark, the fastest counts (5)" << std::endl;
+    std::cerr << "  --synthetic-size=MB size of the generated corpus, 0 = none (" << BENCH_SYNTHETIC_SIZE << ")" << std::endl;
+    std::cerr << "  --seed=N            seed of the generated corpus (1)" << std::endl;
+    std::cerr << "  --threads=N         threads of the parallel decode, 0 = one per core" << std::endl;
+    std::cerr << "  --filter=TEXT       run only benchmarks whose name contains TEXT" << std::endl;
+    std::cerr << "  --format=FORMAT     text (default), json or csv" << std::endl;
+    std::cerr << "  --output=FILE       write the results to FILE instead of stdout" << std::endl;
+    std::cerr << "Without files data.gco is used if it exists." << std::endl;
+}
+
+/** \brief Parses a decimal number without sign into value. Returns false for an empty text,
+    any other character or a number above max. */
+static bool parseNumber(const char* text, size_t& value, size_t max = SIZE_MAX)
+{
+    char* end;
+    if (!isdigit((unsigned char)*text)) return false;
+    errno = 0;
+    unsigned long long parsed = strtoull(text, &end, 10);
+    if (*end || errno == ERANGE || parsed > max) return false;
+    value = (size_t)parsed;
+    return true;
+}
+
+static bool parseOptions(int argc, char** argv, BenchOptions& options)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        const char* arg = argv[i];
+        size_t      value;
+        if (!strncmp(arg, "--repeat=", 9))
+        {
+            if (!parseNumber(arg + 9, value, UINT_MAX)) return false;
+            options.repeat = std::max(1u, (unsigned int)value);
+        }
+        else if (!strncmp(arg, "--synthetic-size=", 17))
+        {
+            if (!parseNumber(arg + 17, options.syntheticSize)) return false;
+        }
+        else if (!strncmp(arg, "--seed=", 7))
+        {
+            if (!parseNumber(arg + 7, value, UINT_MAX)) return false;
+            options.seed = (unsigned int)value;
+        }
+        else if (!strncmp(arg, "--threads=", 10))
+        {
+            if (!parseNumber(arg + 10, value, UINT_MAX)) return false;
+            options.threads = (unsigned int)value;
+        }
+        else if (!strncmp(arg, "--filter=", 9))
+            options.filter = arg + 9;
+        else if (!strncmp(arg, "--format=", 9))
+        {
+            options.format = arg + 9;
+            if (options.format != "text" && options.format != "json" && options.format != "csv") return false;
+        }
+        else if (!strncmp(arg, "--output=", 9))
+            options.output = arg + 9;
+        else if (arg[0] == '-')
+            return false;
+        else
+            options.inputs.push_back(arg);
+    }
+    if (options.inputs.empty() && std::filesystem::exists("data.gco"))
+        options.inputs.push_back("data.gco");
+    if (!options.threads)
+        options.threads = std::max(1u, std::thread::hardware_concurrency());
+    return true;
+}
+
+
+/** \brief Appends one binary command with the fields given by params to out, see GCode::parseBinary(). */
+static void appendCommand(std::vector<uint8_t>& out, uint16_t params, const GCode& values, const char* text)
+{
+    size_t start = out.size();
+    bool   v2 = (params & 4096) != 0;
+
+    auto put = [&out](const void* value, size_t length)
+    {
+        const uint8_t* bytes = (const uint8_t*)value;
+        out.insert(out.end(), bytes, bytes + length);
+    };
+    auto putFloat = [&put](float value) { put(&value, 4); };
+    auto putShort = [&put](uint16_t value) { put(&value, 2); };
+
+    putShort(params);
+    size_t textLength = text ? std::min<size_t>(strlen(text), 79) : 0;
+    if (v2)
+    {
+        putShort((uint16_t)values.params2);
+        if (params & 32768) out.push_back((uint8_t)textLength);
+    }
+    if (params & 1) putShort((uint16_t)values.N);
+    if (params & 2) { if (v2) putShort((uint16_t)values.M); else out.push_back((uint8_t)values.M); }
+    if (params & 4) { if (v2) putShort((uint16_t)values.G); else out.push_back((uint8_t)values.G); }
+    if (params & 8) putFloat(values.X);
+    if (params & 16) putFloat(values.Y);
+    if (params & 32) putFloat(values.Z);
+    if (params & 64) putFloat(values.E);
+    if (params & 256) putFloat(values.F);
+    if (params & 512) out.push_back(values.T);
+    if (params & 1024) { int32_t s = (int32_t)values.S; put(&s, 4); }
+    if (params & 2048) { int32_t p = (int32_t)values.P; put(&p, 4); }
+    if (v2 && (values.params2 & 1)) putFloat(values.I);
+    if (v2 && (values.params2 & 2)) putFloat(values.J);
+    if (v2 && (values.params2 & 4)) putFloat(values.R);
+    if (params & 32768)
+    {
+        size_t length = v2 ? textLength : 16;
+        for (size_t i = 0; i < length; i++)
+            out.push_back(i < textLength ? (uint8_t)text[i] : 0);
+    }
+
+    unsigned int sum1, sum2;
+    GCode::computeFletcher16(&out[start], (uint8_t)(out.size() - start), sum1, sum2);
+    out.push_back((uint8_t)sum1);
+    out.push_back((uint8_t)sum2);
+}
+
+/** \brief Writes a corpus of about size bytes with the layout mix of sliced files:
+    mostly G1 X Y E, travel moves, feed rate and retract commands, some M commands,
+    layer changes and a few V2 commands with arcs and text. */
+static bool writeSyntheticCorpus(const std::string& path, size_t size, unsigned int seed)
+{
+    std::mt19937                            generator(seed);
+    std::uniform_real_distribution<float>   position(0, 200);
+    std::uniform_real_distribution<float>   extrusion(0, 2);
+    std::vector<uint8_t>                    buffer;
+    std::ofstream                           file(path, std::ios::binary);
+    GCode                                   values;
+    float                                   z = 0.2f;
+    size_t                                  written = 0;
+
+
+    if (!file) return false;
+    memset(&values, 0, sizeof(values));
+    while (written < size)
+    {
+        buffer.clear();
+        while (buffer.size() < 1024 * 1024)
+        {
+            unsigned int kind = generator() % 1000;
+            values.G = 1;
+            values.X = position(generator);
+            values.Y = position(generator);
+            values.E = extrusion(generator);
+            if (kind < 870) appendCommand(buffer, 0x0dc, values, nullptr);             // G1 X Y E
+            else if (kind < 910) appendCommand(buffer, 0x19c, values, nullptr);        // G0 X Y F
+            else if (kind < 950) appendCommand(buffer, 0x184, values, nullptr);        // G1 F
+            else if (kind < 970) appendCommand(buffer, 0x1c4, values, nullptr);        // G1 E F retract
+            else if (kind < 980) appendCommand(buffer, 0x0c4, values, nullptr);        // G1 E
+            else if (kind < 985)                                                        // G1 Z F layer change
+            {
+                z += 0.2f;
+                values.Z = z;
+                appendCommand(buffer, 0x1a4, values, nullptr);
+            }
+            else if (kind < 990)                                                        // M104 S / M106 T S
+            {
+                values.M = kind & 1 ? 104 : 106;
+                values.S = 200 + kind % 20;
+                values.T = 0;
+                appendCommand(buffer, kind & 1 ? 0x482 : 0x682, values, nullptr);
+            }
+            else if (kind < 998)                                                        // G2 X Y I J E
+            {
+                values.G = 2;
+                values.params2 = 3;
+                values.I = extrusion(generator);
+                values.J = extrusion(generator);
+                appendCommand(buffer, 0x10dc, values, nullptr);
+            }
+            else                                                                        // M117 text
+            {
+                char text[32];
+                values.M = 117;
+                values.params2 = 0;
+                snprintf(text, sizeof(text), "Layer %u", (unsigned int)(z * 5));
+                appendCommand(buffer, 0x9082, values, text);
+            }
+        }
+        file.write((const char*)buffer.data(), buffer.size());
+        written += buffer.size();
+    }
+    return (bool)file;
+}
+
+
+/** \brief Maps the file and prepares the first BENCH_MICRO_COMMANDS commands as binary,
+    as ASCII lines and as parsed GCode objects. */
+static bool prepareCorpus(Corpus& corpus)
+{
+    MappedFile      file;
+    DecoderContext  context;
+    OutputSink      text(OUTPUT_MEMORY);
+    uint8_t         paddedCommand[256];
+    size_t          offset = 0;
+
+
+    if (!file.open(corpus.path.c_str())) return false;
+    corpus.size = file.size();
+    while (file.size() - offset > MIN_CMD_SIZE)
+    {
+        uint8_t* command;
+        uint8_t  size;
+        offset += BinaryDecoder::nextCommand(file.data() + offset, file.size() - offset, command, size, paddedCommand);
+        corpus.commands++;
+        if (corpus.offsets.size() >= BENCH_MICRO_COMMANDS || command == paddedCommand) continue;
+
+        corpus.offsets.push_back(corpus.binary.size());
+        corpus.sizes.push_back(size);
+        corpus.binary.insert(corpus.binary.end(), command, command + size);
+    }
+
+    // Decoding the copy fills the text of the ASCII benchmark and the objects of printCommand
+    std::vector<uint8_t> binary(corpus.binary);
+    Com::setThreadSink(&text);
+    for (size_t i = 0; i < corpus.offsets.size(); i++)
+    {
+        GCode gcode;
+        if (!gcode.parseBinary(&binary[corpus.offsets[i]], corpus.sizes[i], false, context)) continue;
+        size_t start = text.size();
+        gcode.printCommand();
+        corpus.lines.push_back(start);
+    }
+    Com::setThreadSink(nullptr);
+
+    corpus.ascii.assign(text.data(), text.data() + text.size());
+    for (char& c : corpus.ascii)
+        if (c == '\n') c = 0;
+
+    // The text of the parsed objects must point into memory that outlives the decode
+    corpus.gcodes.reserve(corpus.offsets.size());
+    for (size_t i = 0; i < corpus.offsets.size(); i++)
+    {
+        GCode gcode;
+        if (gcode.parseBinary(&corpus.binary[corpus.offsets[i]], corpus.sizes[i], false, context))
+            corpus.gcodes.push_back(gcode);
+    }
+    return true;
+}
+
+
+/** \brief Runs body options.repeat times and keeps the fastest run. */
+static BenchResult measure(const std::string& name, const Corpus& corpus, size_t bytes, size_t commands,
+    const BenchOptions& options, const std::function<void()>& body)
+{
+    BenchResult result = { name, corpus.name, bytes, commands, 0, 0 };
+
+
+    for (unsigned int run = 0; run < options.repeat; run++)
+    {
+        size_t allocationsBefore = allocations.load();
+        auto   start = std::chrono::steady_clock::now();
+        body();
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        size_t allocationsRun = allocations.load() - allocationsBefore;
+
+        if (!run || seconds < result.seconds)
+        {
+            result.seconds = seconds;
+            result.allocations = allocationsRun;
+        }
+    }
+    std::cerr << "  " << name << " " << corpus.name << ": " << result.seconds * 1000 << " ms" << std::endl;
+    return result;
+}
+
+
+static void runBenchmarks(Corpus& corpus, const BenchOptions& options, std::vector<BenchResult>& results)
+{
+    OutputSink          discard(OUTPUT_NONE);
+    DecoderContext      context;
+    std::vector<uint8_t> binary(corpus.binary);
+    size_t              microBytes = corpus.binary.size();
+    size_t              microCommands = corpus.offsets.size();
+    volatile size_t     sink = 0;
+
+    auto enabled = [&options](const char* name)
+    {
+        return options.filter.empty() || strstr(name, options.filter.c_str()) != nullptr;
+    };
+
+
+    Com::setThreadSink(&discard);
+
+    if (enabled("computeBinarySize"))
+        results.push_back(measure("computeBinarySize", corpus, microBytes, microCommands, options, [&]()
+        {
+            size_t total = 0;
+            for (size_t offset : corpus.offsets)
+                total += GCode::computeBinarySize((char*)&binary[offset]);
+            sink = total;
+        }));
+
+    if (enabled("parseBinary"))
+        results.push_back(measure("parseBinary", corpus, microBytes, microCommands, options, [&]()
+        {
+            size_t parsed = 0;
+            for (size_t i = 0; i < corpus.offsets.size(); i++)
+            {
+                GCode gcode;
+                parsed += gcode.parseBinary(&binary[corpus.offsets[i]], corpus.sizes[i], false, context);
+            }
+            sink = parsed;
+        }));
+
+    if (enabled("parseAscii"))
+    {
+        std::vector<char> ascii(corpus.ascii);
+        results.push_back(measure("parseAscii", corpus, ascii.size(), corpus.lines.size(), options, [&]()
+        {
+            size_t parsed = 0;
+            for (size_t line : corpus.lines)
+            {
+                GCode gcode;
+                parsed += gcode.parseAscii(&ascii[line], false, context);
+            }
+            sink = parsed;
+        }));
+    }
+
+    if (enabled("printCommand"))
+        results.push_back(measure("printCommand", corpus, corpus.ascii.size(), corpus.gcodes.size(), options, [&]()
+        {
+            for (GCode& gcode : corpus.gcodes)
+                gcode.printCommand();
+            discard.flush();
+        }));
+
+    if (enabled("encode"))
+    {
+        std::vector<char> text(corpus.ascii);
+        OutputSink        encoded(OUTPUT_NONE);
+        std::replace(text.begin(), text.end(), '\0', '\n');
+        results.push_back(measure("encode", corpus, text.size(), corpus.lines.size(), options, [&]()
+        {
+            EncodeReport report;
+            BinaryEncoder::encodeRange(text.data(), 0, text.size(), 1, encoded, report);
+            encoded.flush();
+        }));
+    }
+
+    if (enabled("feed"))
+        results.push_back(measure("feed", corpus, microBytes, microCommands, options, [&]()
+        {
+            DecoderContext stream;
+            size_t         fed = 0;
+            for (size_t offset = 0; offset < binary.size(); offset += BENCH_FEED_SIZE)
+                stream.feed(&binary[offset], std::min((size_t)BENCH_FEED_SIZE, binary.size() - offset), [&fed](GCode&) { fed++; });
+            sink = fed;
+        }));
+
+    if (enabled("decode"))
+        results.push_back(measure("decode", corpus, corpus.size, corpus.commands, options, [&]()
+        {
+            MappedFile file;
+            if (file.open(corpus.path.c_str()))
+                BinaryDecoder::decodeRange(file, 0, file.size());
+            discard.flush();
+        }));
+
+    if (enabled("decodeToFile"))
+    {
+        std::string path = (std::filesystem::temp_directory_path() / "RepetierBench.gcode").string();
+        results.push_back(measure("decodeToFile", corpus, corpus.size, corpus.commands, options, [&]()
+        {
+            OutputSink output(OUTPUT_FILE);
+            MappedFile file;
+            output.openFile(path.c_str());
+            Com::setThreadSink(&output);
+            if (file.open(corpus.path.c_str()))
+                BinaryDecoder::decodeRange(file, 0, file.size());
+            output.closeFile();
+            Com::setThreadSink(&discard);
+        }));
+        std::filesystem::remove(path);
+    }
+
+    if (enabled("decodeParallel") && options.threads > 1)
+        results.push_back(measure("decodeParallel", corpus, corpus.size, corpus.commands, options, [&]()
+        {
+            ParallelDecoder::decodeFile(corpus.path.c_str(), options.threads);
+            discard.flush();
+        }));
+
+    if (enabled("decodePipeline") && options.threads > 1)
+        results.push_back(measure("decodePipeline", corpus, corpus.size, corpus.commands, options, [&]()
+        {
+            PipelineReport report;
+            PipelineDecoder::decodeFile(corpus.path.c_str(), options.threads - 1, report);
+            discard.flush();
+        }));
+
+    if (enabled("verify"))
+        results.push_back(measure("verify", corpus, corpus.size, corpus.commands, options, [&]()
+        {
+            MappedFile   file;
+            VerifyReport report;
+            if (file.open(corpus.path.c_str()))
+                BinaryDecoder::verifyRange(file, 0, file.size(), report);
+            sink = report.errors;
+        }));
+
+    if (enabled("decodeBatch"))
+    {
+        std::vector<GCode>       commands(BENCH_DECODE_BATCH);
+        std::vector<BatchRecord> records(BENCH_DECODE_BATCH);
+        results.push_back(measure("decodeBatch", corpus, corpus.size, corpus.commands, options, [&]()
+        {
+            MappedFile     file;
+            DecoderContext batchContext;
+            size_t         offset = 0;
+            size_t         decoded = 0;
+            if (!file.open(corpus.path.c_str())) return;
+            while (offset < file.size())
+            {
+                size_t count;
+                size_t step = BinaryDecoder::decodeBatch(file.data() + offset, file.size() - offset, file.size() - offset,
+                    commands.data(), records.data(), commands.size(), count, batchContext);
+                if (!step) break;
+                offset += step;
+                decoded += count;
+            }
+            sink = decoded;
+        }));
+    }
+
+    if (enabled("decodeFiltered"))
+    {
+        std::vector<GCode>       commands(BENCH_DECODE_BATCH);
+        std::vector<BatchRecord> records(BENCH_DECODE_BATCH);
+        CommandFilter            filter;
+        filter.parse(BENCH_FILTER);
+        results.push_back(measure("decodeFiltered", corpus, corpus.size, corpus.commands, options, [&]()
+        {
+            MappedFile     file;
+            DecoderContext batchContext;
+            size_t         offset = 0;
+            size_t         decoded = 0;
+            if (!file.open(corpus.path.c_str())) return;
+            while (offset < file.size())
+            {
+                size_t count;
+                size_t step = BinaryDecoder::decodeBatch(file.data() + offset, file.size() - offset, file.size() - offset,
+                    commands.data(), records.data(), commands.size(), count, batchContext, &filter);
+                if (!step) break;
+                offset += step;
+                decoded += count;
+            }
+            sink = decoded;
+        }));
+    }
+
+    if (enabled("cursor"))
+        results.push_back(measure("cursor", corpus, corpus.size, corpus.commands, options, [&]()
+        {
+            MappedFile file;
+            size_t     found = 0;
+            if (!file.open(corpus.path.c_str())) return;
+            RecordCursor cursor(file.data(), file.size(), FIELD_M | FIELD_S | FIELD_T);
+            while (cursor.next())
+                if (!cursor.empty()) found += cursor.command().S;
+            sink = found;
+        }));
+
+    if (enabled("decodeColumns"))
+    {
+        CommandStore store;
+        store.reserve(BENCH_STORE_BATCH);
+        results.push_back(measure("decodeColumns", corpus, corpus.size, corpus.commands, options, [&]()
+        {
+            MappedFile file;
+            size_t     offset = 0;
+            if (!file.open(corpus.path.c_str())) return;
+            while (offset < file.size())
+            {
+                store.clear();
+                size_t next = BinaryDecoder::decodeColumns(file, offset, file.size(), store, BENCH_STORE_BATCH);
+                if (next == offset) break;
+                offset = next;
+            }
+        }));
+    }
+
+    if (enabled("track"))
+        results.push_back(measure("track", corpus, corpus.size, corpus.commands, options, [&]()
+        {
+            MappedFile     file;
+            MachineTracker tracker;
+            if (!file.open(corpus.path.c_str())) return;
+            tracker.trackRange(file, 0, file.size());
+            sink = tracker.snapshots().size() + (size_t)tracker.state().position[3];
+        }));
+
+    if (enabled("estimate"))
+        results.push_back(measure("estimate", corpus, corpus.size, corpus.commands, options, [&]()
+        {
+            MappedFile     file;
+            PrintEstimator estimator;
+            if (!file.open(corpus.path.c_str())) return;
+            estimator.estimateRange(file, 0, file.size());
+            estimator.finish();
+            sink = (size_t)estimator.report().total.time;
+        }));
+
+    Com::setThreadSink(nullptr);
+}
+
+
+/** \brief text as JSON string literal, quotes included. */
+static std::string jsonString(const std::string& text)
+{
+    std::string result = "\"";
+    for (char c : text)
+    {
+        if (c == '"' || c == '\\')
+        {
+            result += '\\';
+            result += c;
+        }
+        else if ((unsigned char)c < 0x20)
+        {
+            char escaped[8];
+            snprintf(escaped, sizeof(escaped), "\\u%04x", (unsigned int)c);
+            result += escaped;
+        }
+        else
+            result += c;
+    }
+    return result + "\"";
+}
+
+/** \brief text as CSV field, quoted if it contains a separator, a quote or a line break. */
+static std::string csvField(const std::string& text)
+{
+    if (text.find_first_of(",\"\r\n") == std::string::npos) return text;
+
+    std::string result = "\"";
+    for (char c : text)
+    {
+        if (c == '"') result += '"';
+        result += c;
+    }
+    return result + "\"";
+}
+
+static void writeResults(std::ostream& out, const std::vector<BenchResult>& results, const BenchOptions& options)
+{
+    char line[512];
+
+    auto rates = [](const BenchResult& r, double& mbPerSecond, double& commandsPerSecond, double& allocationsPerCommand)
+    {
+        mbPerSecond = r.seconds > 0 ? r.bytes / r.seconds / 1e6 : 0;
+        commandsPerSecond = r.seconds > 0 ? r.commands / r.seconds : 0;
+        allocationsPerCommand = r.commands ? (double)r.allocations / r.commands : 0;
+    };
+
+
+    if (options.format == "json")
+    {
+        out << "{\n  \"checksum_kernel\": \"" << Checksum::kernelName() << "\",\n  \"repeat\": " << options.repeat << ",\n  \"results\": [";
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            const BenchResult& r = results[i];
+            double mb, cmds, allocs;
+            rates(r, mb, cmds, allocs);
+            snprintf(line, sizeof(line),
+                "\"bytes\": %zu, \"commands\": %zu, \"seconds\": %.6f, "
+                "\"mb_per_s\": %.2f, \"commands_per_s\": %.0f, \"allocations\": %zu, \"allocations_per_command\": %.6f}",
+                r.bytes, r.commands, r.seconds, mb, cmds, r.allocations, allocs);
+            out << (i ? "," : "") << "\n    {\"name\": " << jsonString(r.name) << ", \"input\": " << jsonString(r.input) << ", " << line;
+        }
+        out << "\n  ]\n}" << std::endl;
+    }
+    else if (options.format == "csv")
+    {
+        out << "name,input,bytes,commands,seconds,mb_per_s,commands_per_s,allocations,allocations_per_command" << std::endl;
+        for (const BenchResult& r : results)
+        {
+            double mb, cmds, allocs;
+            rates(r, mb, cmds, allocs);
+            snprintf(line, sizeof(line), "%zu,%zu,%.6f,%.2f,%.0f,%zu,%.6f", r.bytes, r.commands, r.seconds, mb, cmds, r.allocations, allocs);
+            out << csvField(r.name) << "," << csvField(r.input) << "," << line << std::endl;
+        }
+    }
+    else
+    {
+        snprintf(line, sizeof(line), "%-18s %-16s %12s %14s %12s", "benchmark", "input", "MB/s", "commands/s", "alloc/cmd");
+        out << line << std::endl;
+        for (const BenchResult& r : results)
+        {
+            double mb, cmds, allocs;
+            rates(r, mb, cmds, allocs);
+            snprintf(line, sizeof(line), "%-18s %-16s %12.1f %14.0f %12.4f", r.name.c_str(), r.input.c_str(), mb, cmds, allocs);
+            out << line << std::endl;
+        }
+        out << "Checksum kernel: " << Checksum::kernelName() << std::endl;
+    }
+}
+
+
+int main(int argc, char** argv)
+{
+    BenchOptions options;
+    if (!parseOptions(argc, argv, options))
+    {
+        printUsage();
+        return 2;
+    }
+
+    std::vector<Corpus> corpora(options.inputs.size());
+    for (size_t i = 0; i < options.inputs.size(); i++)
+    {
+        corpora[i].path = options.inputs[i];
+        corpora[i].name = std::filesystem::path(options.inputs[i]).filename().string();
+    }
+
+    std::string syntheticPath;
+    if (options.syntheticSize)
+    {
+        syntheticPath = (std::filesystem::temp_directory_path() / "RepetierBench.gco").string();
+        std::cerr << "Writing " << options.syntheticSize << " MB synthetic corpus" << std::endl;
+        if (!writeSyntheticCorpus(syntheticPath, options.syntheticSize * 1024 * 1024, options.seed))
+        {
+            std::cerr << "Unable to write " << syntheticPath << std::endl;
+            return 1;
+        }
+        corpora.emplace_back();
+        corpora.back().path = syntheticPath;
+        corpora.back().name = "synthetic-" + std::to_string(options.syntheticSize) + "MB";
+    }
+
+    std::vector<BenchResult> results;
+    for (Corpus& corpus : corpora)
+    {
+        std::cerr << "Benchmarking " << corpus.path << std::endl;
+        if (!prepareCorpus(corpus))
+        {
+            std::cerr << "Unable to map " << corpus.path << std::endl;
+            return 1;
+        }
+        runBenchmarks(corpus, options, results);
+        corpus = Corpus();
+    }
+    if (!syntheticPath.empty())
+        std::filesystem::remove(syntheticPath);
+
+    if (options.output.empty())
+        writeResults(std::cout, results, options);
+    else
+    {
+        std::ofstream out(options.output);
+        writeResults(out, results, options);
+        if (!out)
+        {
+            std::cerr << "Unable to write " << options.output << std::endl;
+            return 1;
+        }
+    }
+    return 0;
+}
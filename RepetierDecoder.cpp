@@ -6,41 +6,874 @@
 #include <filesystem>
 #include <vector>
 #include <cstdint>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <algorithm>
+#include <cstdio>
+#include <cctype>
+#include <cerrno>
+#include <climits>
+#include <chrono>
 #include "Communication.h"
 #include "gcode.h"
+#include "BinaryDecoder.h"
+#include "BinaryEncoder.h"
+#include "Checksum.h"
+#include "CommandFilter.h"
+#include "CommandStore.h"
+#include "CorpusDeduplicator.h"
+#include "DecoderContext.h"
+#include "FileIndex.h"
+#include "MachineState.h"
+#include "MappedFile.h"
+#include "OutputSink.h"
+#include "ParallelDecoder.h"
+#include "PipelineDecoder.h"
+#include "PrintEstimator.h"
+#include "RecordCursor.h"
+#include "SpscQueue.h"
+#include "StartupExtractor.h"
 
 
-const unsigned int MIN_CMD_SIZE = 5;
-const unsigned int MAX_CMD_SIZE2 = 128;
+/** \brief Part of the file selected by --commands, --layer or --offset. */
+enum IndexQuery
+{
+    QUERY_NONE,
+    QUERY_COMMANDS,
+    QUERY_LAYER,
+    QUERY_OFFSETS
+};
+
+struct Options
+{
+    std::string     input;
+    unsigned int    threads = 1;
+    size_t          chunkSize = PARALLEL_CHUNK_SIZE;
+    bool            verifyOnly = false;
+    bool            statistics = false;
+    bool            stream = false;
+    bool            pipeline = false;
+    bool            recover = false;
+    uint32_t        fields = 0;
+    bool            fieldsVerify = false;
+    CommandFilter   filter;
+    bool            startup = false;
+    bool            dedup = false;
+    StartupOptions  startupOptions;
+    bool            index = false;
+    IndexQuery      query = QUERY_NONE;
+    size_t          queryFirst = 0;
+    size_t          queryLast = SIZE_MAX;
+    size_t          snapshotInterval = 0;
+    bool            estimate = false;
+    EstimatorOptions estimatorOptions;
+    std::string     output;
+    uint8_t         encodeVersion = 0;
+    uint8_t         outputTargets = OUTPUT_BOTH;
+};
+
+static void printUsage()
+{
+    std::cerr << "Usage: RepetierDecoder [options] [file.gco]" << std::endl;
+    std::cerr << "  -j, --threads=N     decode with N threads, 0 = one per core" << std::endl;
+    std::cerr << "  --chunk-size=BYTES  size of the chunks decoded in parallel" << std::endl;
+    std::cerr << "  --verify            only check the checksums of all commands" << std::endl;
+    std::cerr << "  --pipeline          decode in a reader, parser, formatter and writer thread, -j N" << std::endl;
+    std::cerr << "                      sets the number of formatter threads, reports the stages" << std::endl;
+    std::cerr << "  --stream            read the input (- for stdin) in pieces like a serial line," << std::endl;
+    std::cerr << "                      with -j 2 or more on a reader thread, messages go to stderr" << std::endl;
+    std::cerr << "  --recover           skip damaged commands up to the next valid one and list the" << std::endl;
+    std::cerr << "                      skipped ranges, with --verify without writing the commands" << std::endl;
+    std::cerr << "  --filter=TERMS      decode only commands matching one of the comma separated terms," << std::endl;
+    std::cerr << "                      e.g. M104,M109,T or G28,G29 or G1+Z or text" << std::endl;
+    std::cerr << "  --fields=LIST       write only the fields in LIST (e.g. M,S,T,text) of the commands" << std::endl;
+    std::cerr << "                      having one of them, the others are not decoded" << std::endl;
+    std::cerr << "  --fields-verify     with --fields also skip commands with a wrong checksum" << std::endl;
+    std::cerr << "  --startup[=END]     write the commands in front of END: extrusion (first extruding" << std::endl;
+    std::cerr << "                      move behind a Z move, default), layer (first layer change) or" << std::endl;
+    std::cerr << "                      filter terms; for a directory one .gcode per .gco below the" << std::endl;
+    std::cerr << "                      output directory (-o, default DIR_startup) on -j N threads" << std::endl;
+    std::cerr << "  --dedup             list the distinct startup and end sequences of all .gco files" << std::endl;
+    std::cerr << "                      below a directory with their file counts, -j N threads," << std::endl;
+    std::cerr << "                      --startup=END sets the end of the startup sequences" << std::endl;
+    std::cerr << "  --index             write the sidecar index file.gco.idx while decoding" << std::endl;
+    std::cerr << "  --commands=A-B      write the commands A to B (counted from 1) using the index," << std::endl;
+    std::cerr << "                      which is built first if it is missing or out of date" << std::endl;
+    std::cerr << "  --layer=K           write the commands of layer K (counted from 1) using the index" << std::endl;
+    std::cerr << "  --offset=A-B        write the commands starting at byte offsets A to B - 1" << std::endl;
+    std::cerr << "  --snapshots[=N]     print the modal state (position, modes, feedrate, tool," << std::endl;
+    std::cerr << "                      temperatures, fan) every N commands (4096) and at the end;" << std::endl;
+    std::cerr << "                      with --offset=A-B resumed at the index checkpoint in front of A" << std::endl;
+    std::cerr << "  --estimate[=LIMITS] print the print time and filament per tool and layer; LIMITS" << std::endl;
+    std::cerr << "                      e.g. accel=1000,retract-accel=1500,jerk=10,z-jerk=0.4,e-jerk=5," << std::endl;
+    std::cerr << "                      feedrate=300,z-feedrate=12,e-feedrate=120,diameter=1.75" << std::endl;
+    std::cerr << "  --stats             print command count, extrusion and bounding box of the moves" << std::endl;
+    std::cerr << "  --encode[=1|2]      convert an ASCII file (data_decoded.gcode) to binary commands" << std::endl;
+    std::cerr << "                      (data_encoded.gco), 1 = V1 where possible (default), 2 = always V2" << std::endl;
+    std::cerr << "  -o, --output-file=F write the decoded commands to F (data_decoded.gcode)" << std::endl;
+    std::cerr << "  --output=TARGET     both (default), file, stdout or none" << std::endl;
+}
+
+/** \brief Parses a decimal number without sign into value. Returns false for an empty text,
+    any other character or a number above max. */
+static bool parseNumber(const char* text, size_t& value, size_t max = SIZE_MAX)
+{
+    char* end;
+    if (!isdigit((unsigned char)*text)) return false;
+    errno = 0;
+    unsigned long long parsed = strtoull(text, &end, 10);
+    if (*end || errno == ERANGE || parsed > max) return false;
+    value = (size_t)parsed;
+    return true;
+}
+
+/** \brief Parses "A-B", "A-" or "A" into first and last. */
+static bool parseRange(const char* text, size_t& first, size_t& last)
+{
+    char* end;
+    if (!isdigit((unsigned char)*text)) return false;
+    first = (size_t)strtoull(text, &end, 10);
+    if (!*end)
+    {
+        last = first;
+        return true;
+    }
+    if (*end++ != '-') return false;
+    if (!*end)
+    {
+        last = SIZE_MAX;
+        return true;
+    }
+    if (!isdigit((unsigned char)*end)) return false;
+    last = (size_t)strtoull(end, &end, 10);
+    return !*end && first <= last;
+}
+
+static bool parseOptions(int argc, char** argv, Options& options)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        const char* arg = argv[i];
+        size_t      value;
+        if (!strcmp(arg, "-j") && i + 1 < argc)
+        {
+            if (!parseNumber(argv[++i], value, UINT_MAX)) return false;
+            options.threads = (unsigned int)value;
+        }
+        else if (!strncmp(arg, "--threads=", 10))
+        {
+            if (!parseNumber(arg + 10, value, UINT_MAX)) return false;
+            options.threads = (unsigned int)value;
+        }
+        else if (!strncmp(arg, "--chunk-size=", 13))
+        {
+            if (!parseNumber(arg + 13, options.chunkSize)) return false;
+        }
+        else if (!strcmp(arg, "--verify"))
+            options.verifyOnly = true;
+        else if (!strcmp(arg, "--encode"))
+            options.encodeVersion = 1;
+        else if (!strncmp(arg, "--encode=", 9))
+        {
+            if (!parseNumber(arg + 9, value, 2) || !value) return false;
+            options.encodeVersion = (uint8_t)value;
+        }
+        else if (!strcmp(arg, "--recover"))
+            options.recover = true;
+        else if (!strcmp(arg, "--pipeline"))
+            options.pipeline = true;
+        else if (!strcmp(arg, "--stream"))
+            options.stream = true;
+        else if (!strncmp(arg, "--filter=", 9))
+        {
+            if (!options.filter.parse(arg + 9) || options.filter.empty()) return false;
+        }
+        else if (!strncmp(arg, "--fields=", 9))
+        {
+            options.fields = RecordCursor::parseFields(arg + 9);
+            if (!options.fields) return false;
+        }
+        else if (!strcmp(arg, "--fields-verify"))
+            options.fieldsVerify = true;
+        else if (!strcmp(arg, "--startup") || !strncmp(arg, "--startup=", 10))
+        {
+            options.startup = true;
+            if (!StartupExtractor::parseTerminator(arg[9] ? arg + 10 : "", options.startupOptions)) return false;
+        }
+        else if (!strcmp(arg, "--dedup"))
+            options.dedup = true;
+        else if (!strcmp(arg, "--index"))
+            options.index = true;
+        else if (!strncmp(arg, "--commands=", 11))
+        {
+            options.query = QUERY_COMMANDS;
+            if (!parseRange(arg + 11, options.queryFirst, options.queryLast) || !options.queryFirst) return false;
+        }
+        else if (!strncmp(arg, "--layer=", 8))
+        {
+            options.query = QUERY_LAYER;
+            if (!parseRange(arg + 8, options.queryFirst, options.queryLast) || options.queryFirst != options.queryLast || !options.queryFirst) return false;
+        }
+        else if (!strncmp(arg, "--offset=", 9))
+        {
+            options.query = QUERY_OFFSETS;
+            if (!parseRange(arg + 9, options.queryFirst, options.queryLast) || options.queryFirst == options.queryLast) return false;
+        }
+        else if (!strcmp(arg, "--snapshots"))
+            options.snapshotInterval = MACHINE_SNAPSHOT_INTERVAL;
+        else if (!strncmp(arg, "--snapshots=", 12))
+        {
+            if (!parseNumber(arg + 12, options.snapshotInterval) || !options.snapshotInterval) return false;
+        }
+        else if (!strcmp(arg, "--estimate") || !strncmp(arg, "--estimate=", 11))
+        {
+            options.estimate = true;
+            if (arg[10] && !options.estimatorOptions.parse(arg + 11)) return false;
+        }
+        else if (!strcmp(arg, "--stats"))
+            options.statistics = true;
+        else if (!strcmp(arg, "-o") && i + 1 < argc)
+            options.output = argv[++i];
+        else if (!strncmp(arg, "--output-file=", 14))
+            options.output = arg + 14;
+        else if (!strncmp(arg, "--output=", 9))
+        {
+            const char* target = arg + 9;
+            if (!strcmp(target, "both")) options.outputTargets = OUTPUT_BOTH;
+            else if (!strcmp(target, "file")) options.outputTargets = OUTPUT_FILE;
+            else if (!strcmp(target, "stdout")) options.outputTargets = OUTPUT_STDOUT;
+            else if (!strcmp(target, "none")) options.outputTargets = OUTPUT_NONE;
+            else return false;
+        }
+        else if (arg[0] == '-' && arg[1])
+            return false;
+        else
+            options.input = arg;
+    }
+    if (options.snapshotInterval && (options.query == QUERY_COMMANDS || options.query == QUERY_LAYER)) return false;
+    if (!options.threads)
+        options.threads = std::max(1u, std::thread::hardware_concurrency());
+    if (options.input.empty())
+        options.input = options.encodeVersion ? "data_decoded.gcode" : "data.gco";
+    if (options.startup && !options.dedup && options.output.empty() && std::filesystem::is_directory(options.input))
+    {
+        // Next to the directory, never inside it: "corp/" gives corp_startup, not corp/_startup
+        std::filesystem::path directory = std::filesystem::path(options.input).lexically_normal();
+        if (directory.filename() == "." || directory.filename() == "..") directory = std::filesystem::absolute(directory).lexically_normal();
+        if (!directory.has_filename()) directory = directory.parent_path();
+        options.output = directory.string() + "_startup";
+    }
+    if (options.output.empty())
+        options.output = options.encodeVersion ? "data_encoded.gco" : "data_decoded.gcode";
+    return true;
+}
 
-int main()
+/** \brief Sets up the output of Com, returns false with a message if the output file can not be created. */
+static bool initializeOutput(const Options& options)
 {
-    std::filesystem::path path("data.gco");
+    if (Com::initialize(options.output.c_str(), options.outputTargets)) return true;
+
+    std::cerr << "Unable to write " << options.output << std::endl;
+    return false;
+}
+
+static int verifyFile(const Options& options)
+{
+    MappedFile file;
+    if (!file.open(options.input.c_str()))
+    {
+        std::cerr << "Unable to map " << options.input << std::endl;
+        return 1;
+    }
+
+    VerifyReport report;
+    BinaryDecoder::verifyRange(file, 0, file.size(), report);
+    std::cout << "File size: " << file.size() << std::endl;
+    std::cout << "Checksum kernel: " << Checksum::kernelName() << std::endl;
+    std::cout << "Commands: " << report.commands << std::endl;
+    std::cout << "Errors: " << report.errors << std::endl;
+    for (size_t offset : report.errorOffsets)
+        std::cout << "Bad command at offset " << offset << std::endl;
+    return report.errors ? 3 : 0;
+}
+
+static int recoverFile(const Options& options)
+{
+    MappedFile file;
+    if (!file.open(options.input.c_str()))
+    {
+        std::cerr << "Unable to map " << options.input << std::endl;
+        return 1;
+    }
+
+    // The report goes to stderr when the commands are written to stdout
+    RecoveryReport  report;
+    std::ostream&   out = options.verifyOnly ? std::cout : std::cerr;
+    if (!options.verifyOnly && !initializeOutput(options)) return 1;
+    BinaryDecoder::recoverRange(file, 0, file.size(), report, !options.verifyOnly);
+    if (!options.verifyOnly) Com::finish();
+
+    out << "File size: " << file.size() << std::endl;
+    out << "Commands: " << report.commands << std::endl;
+    out << "Skipped ranges: " << report.ranges << std::endl;
+    out << "Skipped bytes: " << report.skippedBytes << std::endl;
+    for (const SkippedRange& range : report.skipped)
+        out << "Skipped " << range.begin << " .. " << range.end << " (" << range.end - range.begin << " bytes)" << std::endl;
+    return report.ranges ? 3 : 0;
+}
+
+static int projectFile(const Options& options)
+{
+    MappedFile file;
+    if (!file.open(options.input.c_str()))
+    {
+        std::cerr << "Unable to map " << options.input << std::endl;
+        return 1;
+    }
+
+    RecordCursor cursor(file.data(), file.size(), options.fields, options.fieldsVerify);
+    if (!initializeOutput(options)) return 1;
+    while (cursor.next())
+        if (!cursor.empty() && options.filter.matches(file.data() + cursor.offset())) cursor.command().printCommand();
+    Com::finish();
+    if (cursor.errors())
+        std::cerr << "Skipped commands: " << cursor.errors() << std::endl;
+    return cursor.errors() ? 3 : 0;
+}
+
+/** \brief Writes state as one line: position, modes, feedrate, tool, temperatures and fan. */
+static void printMachineState(std::ostream& out, const MachineState& state)
+{
+    out << "X" << state.position[0] << " Y" << state.position[1] << " Z" << state.position[2] << " E" << state.position[3]
+        << " F" << state.f << " T" << (unsigned int)state.tool << " N" << state.N
+        << (state.flags & MACHINE_RELATIVE ? " G91" : " G90") << (state.flags & MACHINE_RELATIVE_E ? " M83" : " M82");
+    for (int tool = 0; tool < MACHINE_TOOLS; tool++)
+        if (state.hotend[tool] || tool == state.tool) out << " T" << tool << ":" << state.hotend[tool];
+    out << " B:" << state.bed << " fan " << (unsigned int)state.fan << std::endl;
+}
+
+/** \brief Loads the index of the mapped file from its sidecar or, if it is missing or out of
+    date, builds and saves it and maps the file again. Returns false if that fails. */
+static bool loadIndex(const Options& options, MappedFile& file, FileIndex& index, bool& loaded)
+{
+    const char* path = options.input.c_str();
+
+
+    loaded = index.load(path, file);
+    if (loaded) return true;
+
+    index.build(path, file);
+    if (!index.save(path))
+        std::cerr << "Unable to write " << FileIndex::sidecarPath(path) << std::endl;
+    // Building terminated the texts in the mapping, the next decode needs a fresh one
+    file.close();
+    if (file.open(path)) return true;
+
+    std::cerr << "Unable to map " << options.input << std::endl;
+    return false;
+}
+
+/** \brief Prints a snapshot of the modal state every options.snapshotInterval commands and the
+    final state of the file. With --offset=A-B only the commands starting in front of B are
+    tracked, resumed at the checkpoint of the index in front of A. */
+static int trackFile(const Options& options)
+{
+    MappedFile      file;
+    MachineTracker  tracker(options.snapshotInterval);
+    size_t          begin = 0;
+    size_t          end;
+    if (!file.open(options.input.c_str()))
+    {
+        std::cerr << "Unable to map " << options.input << std::endl;
+        return 1;
+    }
+
+    end = file.size();
+    if (options.query == QUERY_OFFSETS)
+    {
+        FileIndex   index;
+        bool        loaded;
+        if (!loadIndex(options, file, index, loaded)) return 1;
+
+        const IndexCheckpoint* checkpoint = index.checkpoint(options.queryFirst);
+        if (checkpoint)
+        {
+            tracker.start({ checkpoint->offset, checkpoint->record, checkpoint->state });
+            begin = (size_t)checkpoint->offset;
+        }
+        end = std::min(end, options.queryLast);
+        std::cerr << "Index: " << (loaded ? "loaded" : "built") << ", resumed at command " << tracker.commands() << " at offset " << begin << std::endl;
+    }
+
+    auto started = std::chrono::steady_clock::now();
+    tracker.trackRange(file, begin, end);
+    auto finished = std::chrono::steady_clock::now();
+    for (const MachineSnapshot& snapshot : tracker.snapshots())
+    {
+        std::cout << "Command " << snapshot.command << " at " << snapshot.offset << ": ";
+        printMachineState(std::cout, snapshot.state);
+    }
+    std::cout << "Final state after " << tracker.commands() << " commands: ";
+    printMachineState(std::cout, tracker.state());
+    std::cerr << "Tracking time: " << std::chrono::duration<double, std::milli>(finished - started).count() << " ms" << std::endl;
+    return 0;
+}
+
+/** \brief Writes seconds as h:mm:ss. */
+static std::string formatDuration(double seconds)
+{
+    char          text[32];
+    unsigned long total = (unsigned long)(seconds + 0.5);
+    snprintf(text, sizeof(text), "%lu:%02lu:%02lu", total / 3600, total / 60 % 60, total % 60);
+    return text;
+}
+
+static int estimateFile(const Options& options)
+{
+    MappedFile      file;
+    PrintEstimator  estimator(options.estimatorOptions);
+    if (!file.open(options.input.c_str()))
+    {
+        std::cerr << "Unable to map " << options.input << std::endl;
+        return 1;
+    }
+
+    auto started = std::chrono::steady_clock::now();
+    estimator.estimateRange(file, 0, file.size());
+    estimator.finish();
+    auto finished = std::chrono::steady_clock::now();
+
+    const EstimateReport& report = estimator.report();
+    double radius = options.estimatorOptions.filamentDiameter / 2;
+    double volume = report.total.filament * 3.14159265358979 * radius * radius / 1000;
+    std::cout << "Commands: " << report.commands << std::endl;
+    std::cout << "Moves: " << report.moves << std::endl;
+    std::cout << "Print time: " << formatDuration(report.total.time) << " (" << report.total.time << " s)" << std::endl;
+    std::cout << "Dwell: " << report.dwell << " s, heating waits not included: " << report.waits << std::endl;
+    std::cout << "Filament: " << report.total.filament << " mm (" << volume << " cm3)" << std::endl;
+    for (int tool = 0; tool < MACHINE_TOOLS; tool++)
+        if (report.tools[tool].time > 0 || report.tools[tool].filament != 0)
+            std::cout << "Tool " << tool << ": " << formatDuration(report.tools[tool].time) << ", " << report.tools[tool].filament << " mm" << std::endl;
+    for (size_t layer = 0; layer < report.layers.size(); layer++)
+        std::cout << "Layer " << layer << " Z" << report.layerZ[layer] << ": " << formatDuration(report.layers[layer].time) << ", "
+                  << report.layers[layer].filament << " mm" << std::endl;
+    std::cerr << "Estimation time: " << std::chrono::duration<double, std::milli>(finished - started).count() << " ms" << std::endl;
+    return 0;
+}
+
+/** \brief Writes the commands selected by --commands, --layer or --offset. The index is
+    loaded from the sidecar or, if it is missing or out of date, built and saved first. */
+static int queryFile(const Options& options)
+{
+    MappedFile  file;
+    FileIndex   index;
+    bool        loaded;
+    auto        started = std::chrono::steady_clock::now();
+
+
+    if (!file.open(options.input.c_str()))
+    {
+        std::cerr << "Unable to map " << options.input << std::endl;
+        return 1;
+    }
+    if (!loadIndex(options, file, index, loaded)) return 1;
+    auto indexed = std::chrono::steady_clock::now();
+
+    size_t first = options.queryFirst - 1;
+    size_t last = options.queryLast == SIZE_MAX ? SIZE_MAX : options.queryLast - 1;
+    if (options.query == QUERY_LAYER && !index.layerCommands(options.queryFirst, first, last))
+    {
+        std::cerr << "No layer " << options.queryFirst << ", the file has " << index.layers() << " layers" << std::endl;
+        return 3;
+    }
+
+    IndexCheckpoint state;
+    size_t          written;
+    if (!initializeOutput(options)) return 1;
+    if (options.query == QUERY_OFFSETS)
+        written = index.decodeOffsets(file, options.queryFirst, options.queryLast, state);
+    else
+        written = index.decodeCommands(file, first, last, state);
+    Com::finish();
+    auto finished = std::chrono::steady_clock::now();
+
+    std::cerr << "Index: " << (loaded ? "loaded" : "built") << ", " << index.records() << " commands, " << index.layers() << " layers" << std::endl;
+    std::cerr << "Commands: " << written;
+    if (written)
+        std::cerr << " from command " << state.record + 1 << " at offset " << state.offset;
+    std::cerr << std::endl;
+    if (written)
+    {
+        std::cerr << "State: layer " << state.layer << " ";
+        printMachineState(std::cerr, state.state);
+    }
+    std::cerr << "Index time: " << std::chrono::duration<double, std::milli>(indexed - started).count() << " ms, query time: "
+              << std::chrono::duration<double, std::milli>(finished - indexed).count() << " ms" << std::endl;
+    return written ? 0 : 3;
+}
+
+static int extractStartup(const Options& options)
+{
+    if (std::filesystem::is_directory(options.input))
+    {
+        StartupDirectoryReport report;
+        StartupExtractor::extractDirectory(options.input.c_str(), options.output.c_str(), options.startupOptions, options.threads, report);
+        std::cout << "Files: " << report.files << std::endl;
+        std::cout << "Terminated: " << report.terminated << std::endl;
+        std::cout << "Commands: " << report.commands << std::endl;
+        std::cout << "Startup bytes: " << report.bytes << std::endl;
+        std::cout << "Failed: " << report.failed << std::endl;
+        for (const std::string& failure : report.failures)
+            std::cout << "Failed " << failure << std::endl;
+        return report.failed ? 3 : 0;
+    }
+
+    // The report goes to stderr, the commands may go to stdout
+    StartupReport report;
+    if (!initializeOutput(options)) return 1;
+    bool mapped = StartupExtractor::extractFile(options.input.c_str(), options.startupOptions, report);
+    Com::finish();
+    if (!mapped)
+    {
+        std::cerr << "Unable to map " << options.input << std::endl;
+        return 1;
+    }
+    std::cerr << "Commands: " << report.commands << std::endl;
+    std::cerr << "Startup bytes: " << report.bytes << std::endl;
+    std::cerr << "Terminated: " << (report.terminated ? "yes" : "no") << std::endl;
+    return 0;
+}
+
+static void printSequences(const char* title, const SequenceTable& table)
+{
+    std::vector<const SequenceCluster*> clusters = table.sorted();
+    std::cout << title << " sequences: " << clusters.size() << " in " << table.files() << " files";
+    if (table.evictedClusters())
+        std::cout << ", " << table.evictedClusters() << " rare ones with " << table.evictedFiles() << " files dropped";
+    std::cout << std::endl;
+    for (size_t i = 0; i < clusters.size(); i++)
+    {
+        const SequenceCluster& cluster = *clusters[i];
+        std::cout << "== " << title << " " << i + 1 << ": " << cluster.files << " files, " << cluster.distinct << " variants, "
+                  << cluster.lines.size() << " commands" << std::endl;
+        for (const std::string& line : cluster.lines)
+            std::cout << line << std::endl;
+    }
+}
+
+static int deduplicate(const Options& options)
+{
+    DedupReport report;
+    CorpusDeduplicator::analyzeDirectory(options.input.c_str(), options.startupOptions, options.threads, report);
+    std::cout << "Files: " << report.files << std::endl;
+    std::cout << "Failed: " << report.failed << std::endl;
+    for (const std::string& failure : report.failures)
+        std::cout << "Failed " << failure << std::endl;
+    std::cout << "Without startup sequence: " << report.withoutStartup << std::endl;
+    std::cout << "Without end sequence: " << report.withoutEnd << std::endl;
+    printSequences("Startup", report.startup);
+    printSequences("End", report.end);
+    return report.failed ? 3 : 0;
+}
+
+static int encodeFile(const Options& options)
+{
+    EncodeReport report;
+    if (!BinaryEncoder::encodeFile(options.input.c_str(), options.output.c_str(), options.encodeVersion, options.threads, report, options.chunkSize))
+    {
+        std::cerr << "Unable to encode " << options.input << " to " << options.output << std::endl;
+        return 1;
+    }
+
+    std::cout << "Lines: " << report.lines << std::endl;
+    std::cout << "Commands: " << report.commands << std::endl;
+    std::cout << "Skipped: " << report.skipped << std::endl;
+    std::cout << "Errors: " << report.errors << std::endl;
+    std::cout << "Binary size: " << report.bytes << std::endl;
+    for (size_t offset : report.errorOffsets)
+        std::cout << "Bad line at offset " << offset << std::endl;
+    return report.errors ? 3 : 0;
+}
+
+/** Bytes read from the input at once by --stream. */
+#define STREAM_READ_SIZE (64 * 1024)
+
+/** Commands between the reader thread and the formatting thread of --stream -j N. */
+#define STREAM_QUEUE_SIZE 4096
+
+/** \brief Reads input in pieces and feeds them to context on a reader thread. The commands go
+    through the command queue of context to the calling thread, which formats them in batches.
+    Messages of the reader thread go to stderr, only the calling thread writes through Com. */
+static size_t streamThreaded(FILE* input, DecoderContext& context)
+{
+    SpscQueue<GCode>& queue = context.getCommandQueue();
+    size_t            commands = 0;
+
+    std::thread reader([&]()
+    {
+        std::vector<uint8_t> buffer(STREAM_READ_SIZE);
+        OutputSink           messages(OUTPUT_MEMORY, 4096);
+        size_t               length;
+
+
+        Com::setThreadSink(&messages);
+        while ((length = fread(buffer.data(), 1, buffer.size(), input)) > 0)
+        {
+            context.feed(buffer.data(), length, [&queue](GCode& command)
+            {
+                *queue.waitForSpace() = command;
+                queue.push();
+                // The text is in the receive buffer, which the next command reuses
+                if (command.hasString()) queue.waitUntilEmpty();
+            });
+            if (messages.size())
+            {
+                std::cerr.write(messages.data(), messages.size());
+                messages.clear();
+            }
+        }
+        Com::setThreadSink(nullptr);
+        queue.close();
+    });
+
+    size_t count;
+    while ((count = queue.waitForData()) > 0)
+    {
+        for (size_t i = 0; i < count; i++)
+            queue.at(i).echoCommand();
+        queue.pop(count);
+        commands += count;
+    }
+    reader.join();
+    return commands;
+}
+
+static int streamFile(const Options& options)
+{
+    bool  fromStdin = options.input == "-";
+    FILE* input = fromStdin ? stdin : fopen(options.input.c_str(), "rb");
+    if (!input)
+    {
+        std::cerr << "Unable to open " << options.input << std::endl;
+        return 1;
+    }
+
+    DecoderContext context(options.threads > 1 ? STREAM_QUEUE_SIZE : GCODE_BUFFER_SIZE);
+    size_t         commands = 0;
+
+
+    if (!initializeOutput(options))
+    {
+        if (!fromStdin) fclose(input);
+        return 1;
+    }
+    if (options.threads > 1)
+        commands = streamThreaded(input, context);
+    else
+    {
+        std::vector<uint8_t> buffer(STREAM_READ_SIZE);
+        size_t               length;
+        while ((length = fread(buffer.data(), 1, buffer.size(), input)) > 0)
+        {
+            context.feed(buffer.data(), length, [&commands](GCode& command)
+            {
+                command.echoCommand();
+                commands++;
+            });
+        }
+    }
+    if (!fromStdin) fclose(input);
+    Com::finish();
+    std::cerr << "Commands: " << commands << std::endl;
+    if (context.getPendingBytes())
+        std::cerr << "Incomplete command at the end: " << (int)context.getPendingBytes() << " bytes" << std::endl;
+    return 0;
+}
+
+/** \brief Prints the throughput of every stage and the queue occupancy of --pipeline to stderr. */
+static void printPipelineReport(const PipelineReport& report)
+{
+    char line[160];
+
+    snprintf(line, sizeof(line), "Pipeline: %.3f s", report.seconds);
+    std::cerr << line << std::endl;
+    for (const PipelineStageReport& stage : report.stages)
+    {
+        double busy = stage.threads ? stage.busySeconds / stage.threads : 0;
+        snprintf(line, sizeof(line), "  %-10s %2u thread(s) %12zu bytes %10zu commands  busy %7.3f s  wait %7.3f s  %8.1f MB/s",
+            stage.name, stage.threads, stage.bytes, stage.commands, busy, stage.waitSeconds / stage.threads,
+            busy > 0 ? stage.bytes / busy / 1e6 : 0.0);
+        std::cerr << line << std::endl;
+    }
+    for (const PipelineQueueReport& queue : report.queues)
+    {
+        snprintf(line, sizeof(line), "  queue %-10s capacity %4zu  average %6.2f  maximum %4zu",
+            queue.name, queue.capacity, queue.average(), queue.maximum);
+        std::cerr << line << std::endl;
+    }
+}
+
+/** Number of records decoded into the CommandStore at once by --stats. */
+#define STATISTICS_BATCH (1024 * 1024)
+
+/** Number of bitfield layouts listed by --stats. */
+#define STATISTICS_LAYOUTS 10
+
+static int printStatistics(const Options& options)
+{
+    MappedFile file;
+    if (!file.open(options.input.c_str()))
+    {
+        std::cerr << "Unable to map " << options.input << std::endl;
+        return 1;
+    }
+
+    CommandStore    store;
+    size_t          offset = 0;
+    size_t          commands = 0;
+    size_t          errors = 0;
+    double          extruded = 0;
+    std::vector<size_t> layouts(65536);
+    CommandBounds   total = { { 0, 0, 0 }, { 0, 0, 0 }, { false, false, false } };
+
+
+    store.reserve(STATISTICS_BATCH);
+    while (offset < file.size())
+    {
+        store.clear();
+        size_t next = BinaryDecoder::decodeColumns(file, offset, file.size(), store, STATISTICS_BATCH);
+        if (next == offset) break;
+        offset = next;
+
+        CommandBounds bounds = store.boundingBox();
+        for (int axis = 0; axis < 3; axis++)
+        {
+            if (!bounds.valid[axis]) continue;
+            total.min[axis] = total.valid[axis] ? std::min(total.min[axis], bounds.min[axis]) : bounds.min[axis];
+            total.max[axis] = total.valid[axis] ? std::max(total.max[axis], bounds.max[axis]) : bounds.max[axis];
+            total.valid[axis] = true;
+        }
+        for (uint16_t bits : store.params)
+            layouts[bits]++;
+        commands += store.size();
+        errors += store.errors;
+        extruded += store.sumE();
+    }
+
+    std::cout << "File size: " << file.size() << std::endl;
+    std::cout << "Commands: " << commands << std::endl;
+    std::cout << "Errors: " << errors << std::endl;
+    std::cout << "Sum of E: " << extruded << std::endl;
+    for (int axis = 0; axis < 3; axis++)
+    {
+        std::cout << "XYZ"[axis] << ": ";
+        if (total.valid[axis]) std::cout << total.min[axis] << " .. " << total.max[axis] << std::endl;
+        else std::cout << "-" << std::endl;
+    }
+
+    // Most frequent layouts, candidates for HotLayouts in HotLayouts.h
+    std::vector<uint16_t> order;
+    for (size_t bits = 0; bits < layouts.size(); bits++)
+        if (layouts[bits]) order.push_back((uint16_t)bits);
+    std::sort(order.begin(), order.end(), [&layouts](uint16_t a, uint16_t b) { return layouts[a] > layouts[b]; });
+    if (order.size() > STATISTICS_LAYOUTS) order.resize(STATISTICS_LAYOUTS);
+    for (uint16_t bits : order)
+    {
+        char line[64];
+        snprintf(line, sizeof(line), "Layout 0x%03x: %zu (%.1f%%)", bits, layouts[bits], 100.0 * layouts[bits] / commands);
+        std::cout << line << std::endl;
+    }
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    Options options;
+    if (!parseOptions(argc, argv, options))
+    {
+        printUsage();
+        return 2;
+    }
+
+    std::filesystem::path path(options.input);
+    if (options.recover)
+        return recoverFile(options);
+    if (options.verifyOnly)
+        return verifyFile(options);
+    if (options.dedup)
+        return deduplicate(options);
+    if (options.startup)
+        return extractStartup(options);
+    if (options.statistics)
+        return printStatistics(options);
+    if (options.fields)
+        return projectFile(options);
+    if (options.snapshotInterval)
+        return trackFile(options);
+    if (options.query != QUERY_NONE)
+        return queryFile(options);
+    if (options.estimate)
+        return estimateFile(options);
+    if (options.encodeVersion)
+        return encodeFile(options);
+    if (options.stream)
+        return streamFile(options);
+
     if (std::filesystem::exists(path))
     {
-        Com::initialize();
+        if (!initializeOutput(options)) return 1;
         std::cout << "File size: " << std::filesystem::file_size(path) << std::endl;
-        uintmax_t fileSize = std::filesystem::file_size(path);
-        std::ifstream file("data.gco", std::ios::in | std::ios::binary);
-
-        uint8_t receivedCommand[MAX_CMD_SIZE2];
-        while (fileSize > MIN_CMD_SIZE)
-        {
-            std::memset(receivedCommand, 0, MAX_CMD_SIZE2);
-            file.read((char*)receivedCommand, MIN_CMD_SIZE);
-            auto bytesRead = file.gcount();
-            fileSize = fileSize - bytesRead;
-            auto size = GCode::computeBinarySize((char*)receivedCommand);
-            auto bytesToRead = size - bytesRead;
-            if (size > MIN_CMD_SIZE && size <= MAX_CMD_SIZE2 && fileSize >= bytesToRead)
+        if (options.pipeline)
+        {
+            PipelineReport report;
+            if (!PipelineDecoder::decodeFile(options.input.c_str(), options.threads, report, &options.filter))
             {
-                file.read((char*)(receivedCommand + bytesRead), bytesToRead );
-                fileSize = fileSize - file.gcount();
+                std::cerr << "Unable to map " << path << std::endl;
+                return 1;
             }
+            Com::flush();
+            printPipelineReport(report);
+        }
+        else if (options.threads > 1)
+        {
+            if (!ParallelDecoder::decodeFile(options.input.c_str(), options.threads, options.chunkSize, &options.filter))
+            {
+                std::cerr << "Unable to map " << path << std::endl;
+                return 1;
+            }
+        }
+        else
+        {
+            MappedFile file;
+            if (!file.open(options.input.c_str()))
+            {
+                std::cerr << "Unable to map " << path << std::endl;
+                return 1;
+            }
+
+            // The index is built in the same pass, unless a filter drops commands
+            FileIndex index;
+            bool      indexed = options.index && options.filter.empty();
+            if (indexed) index.start(options.input.c_str(), file);
+            BinaryDecoder::decodeRange(file, 0, file.size(), &options.filter, indexed ? &index : nullptr);
+            if (indexed)
+            {
+                index.finish();
+                if (!index.save(options.input.c_str()))
+                    std::cerr << "Unable to write " << FileIndex::sidecarPath(options.input.c_str()) << std::endl;
+            }
+        }
+        Com::finish();
 
-            GCode gcode;
-            gcode.parseBinary(receivedCommand, size, false);
-            gcode.echoCommand();
+        // The parallel modes and a filter do not see every command in order, the index gets a pass of its own
+        MappedFile file;
+        FileIndex  index;
+        if (options.index && (options.pipeline || options.threads > 1 || !options.filter.empty()) && file.open(options.input.c_str()))
+        {
+            index.build(options.input.c_str(), file);
+            if (!index.save(options.input.c_str()))
+                std::cerr << "Unable to write " << FileIndex::sidecarPath(options.input.c_str()) << std::endl;
         }
     }
     /*
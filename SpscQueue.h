@@ -0,0 +1,168 @@
+#pragma once
+
+#include "types.h"
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <thread>
+
+/** Size of a cache line. The indices of producer and consumer live in different lines. */
+#define CACHE_LINE_SIZE 64
+
+/** Polls of a waiting thread before it yields the processor. */
+#define SPSC_SPIN_COUNT 64
+
+/** \brief Lock-free ring of capacity elements for exactly one producer and one consumer thread.
+
+The producer fills back() and publishes it with push(), the consumer reads front() or the
+first readable() elements with at() and releases them with pop(). Both sides keep a private
+copy of the other side's index and only reload the shared one when the copy says the ring is
+full or empty, so in the steady state a push or pop touches no cache line of the other
+thread. The capacity is rounded up to a power of two. close() tells the consumer that no
+more elements follow. */
+template <typename T>
+class SpscQueue
+{
+public:
+    explicit SpscQueue(size_t capacity)
+        : mask(roundUp(capacity) - 1), slots(new T[mask + 1]), tail(0), closed(false), cachedHead(0), head(0), cachedTail(0)
+    {
+    } // SpscQueue
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    inline size_t capacity() const
+    {
+        return mask + 1;
+    } // capacity
+
+    /** \brief Number of elements in the ring, exact only for the producer or the consumer. */
+    inline size_t size() const
+    {
+        return tail.load(std::memory_order_acquire) - head.load(std::memory_order_acquire);
+    } // size
+
+    inline bool empty() const
+    {
+        return size() == 0;
+    } // empty
+
+    inline bool full() const
+    {
+        return size() > mask;
+    } // full
+
+    // Producer
+
+    /** \brief Returns the slot push() publishes next, 0 if the ring is full. */
+    inline T* back()
+    {
+        size_t position = tail.load(std::memory_order_relaxed);
+        if (position - cachedHead > mask)
+        {
+            cachedHead = head.load(std::memory_order_acquire);
+            if (position - cachedHead > mask) return nullptr;
+        }
+        return &slots[position & mask];
+    } // back
+
+    /** \brief Publishes the slot returned by back(). */
+    inline void push()
+    {
+        tail.store(tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    } // push
+
+    /** \brief Moves value into the ring, returns false if it is full. */
+    inline bool tryPush(T&& value)
+    {
+        T* slot = back();
+        if (!slot) return false;
+        *slot = std::move(value);
+        push();
+        return true;
+    } // tryPush
+
+    /** \brief Waits until back() has a slot. */
+    inline T* waitForSpace()
+    {
+        T* slot;
+        for (unsigned int spin = 0; !(slot = back()); spin++)
+            if (spin >= SPSC_SPIN_COUNT) std::this_thread::yield();
+        return slot;
+    } // waitForSpace
+
+    /** \brief Waits until the consumer took all elements. */
+    inline void waitUntilEmpty() const
+    {
+        for (unsigned int spin = 0; !empty(); spin++)
+            if (spin >= SPSC_SPIN_COUNT) std::this_thread::yield();
+    } // waitUntilEmpty
+
+    inline void close()
+    {
+        closed.store(true, std::memory_order_release);
+    } // close
+
+    // Consumer
+
+    /** \brief Number of elements the consumer can read with at(). */
+    inline size_t readable()
+    {
+        size_t position = head.load(std::memory_order_relaxed);
+        if (cachedTail == position) cachedTail = tail.load(std::memory_order_acquire);
+        return cachedTail - position;
+    } // readable
+
+    /** \brief Element index behind front(), index must be below readable(). */
+    inline T& at(size_t index)
+    {
+        return slots[(head.load(std::memory_order_relaxed) + index) & mask];
+    } // at
+
+    /** \brief Returns the oldest element, 0 if the ring is empty. */
+    inline T* front()
+    {
+        return readable() ? &at(0) : nullptr;
+    } // front
+
+    /** \brief Releases the count oldest elements to the producer. */
+    inline void pop(size_t count = 1)
+    {
+        head.store(head.load(std::memory_order_relaxed) + count, std::memory_order_release);
+    } // pop
+
+    /** \brief Waits for elements, returns their number or 0 if the ring is empty and closed. */
+    inline size_t waitForData()
+    {
+        size_t count;
+        for (unsigned int spin = 0; !(count = readable()); spin++)
+        {
+            if (closed.load(std::memory_order_acquire))
+                return readable(); // elements pushed in front of close()
+            if (spin >= SPSC_SPIN_COUNT) std::this_thread::yield();
+        }
+        return count;
+    } // waitForData
+
+private:
+    static inline size_t roundUp(size_t capacity)
+    {
+        size_t result = 1;
+        while (result < capacity) result <<= 1;
+        return result;
+    } // roundUp
+
+    const size_t                        mask;           ///< capacity - 1.
+    std::unique_ptr<T[]>                slots;          ///< Elements, index & mask.
+
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> tail;  ///< Elements pushed, written by the producer.
+    std::atomic<bool>                   closed;         ///< No more elements follow.
+    size_t                              cachedHead;     ///< Producer's copy of head.
+
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> head;  ///< Elements popped, written by the consumer.
+    size_t                              cachedTail;     ///< Consumer's copy of tail.
+
+    char                                padding[CACHE_LINE_SIZE - sizeof(std::atomic<size_t>) - sizeof(size_t)];
+
+}; // SpscQueue
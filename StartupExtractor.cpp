@@ -0,0 +1,280 @@
+#include "StartupExtractor.h"
+#include "BinaryDecoder.h"
+#include "Communication.h"
+#include "DecoderContext.h"
+#include "MappedFile.h"
+#include "OutputSink.h"
+#include "gcode.h"
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstring>
+#include <filesystem>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace fs = std::filesystem;
+
+
+/** \brief Applies a command, returns true if it is a G0/G1 moving in X or Y while extruding. */
+bool StartupState::apply(const GCode& command)
+{
+    GCode& c = const_cast<GCode&>(command);     // the has...() accessors are not const
+
+
+    if (c.hasM())
+    {
+        if (c.M == 82) relativeE = false;
+        else if (c.M == 83) relativeE = true;
+        return false;
+    }
+    if (!c.hasG()) return false;
+
+    switch (c.G)
+    {
+    case 90:
+        relative = relativeE = false;
+        break;
+    case 91:
+        relative = relativeE = true;
+        break;
+    case 92:
+        if (c.hasZ()) z = c.Z;
+        if (c.hasE())
+        {
+            e = c.E;
+            eKnown = true;
+        }
+        break;
+    case 0:
+    case 1:
+    {
+        float newZ = c.hasZ() ? (relative ? z + c.Z : c.Z) : z;
+        float newE = c.hasE() ? (relativeE ? e + c.E : c.E) : e;
+        bool  extruding = newE > e && (c.hasX() || c.hasY()) && (eKnown || relativeE);
+
+        if (newZ != z) zMoved = true;
+        if (extruding && !extruded) layerZ = newZ;
+        if (extruding) extruded = true;
+        z = newZ;
+        e = newE;
+        if (c.hasE() && !relativeE) eKnown = true;
+        return extruding;
+    }
+    default:
+        break;
+    }
+    return false;
+
+} // apply
+
+
+/** \brief Applies a command, returns whether it ends the startup sequence. */
+StartupDecision StartupState::decide(const GCode& command, const StartupOptions& options)
+{
+    if (options.terminator == STARTUP_FILTER) return options.filter.matches(command) ? STARTUP_END : STARTUP_CONTINUE;
+
+    bool    zMovedBefore = zMoved;
+    bool    extrudedBefore = extruded;
+    bool    pendingBefore = layerPending;
+    float   zBefore = z;
+    bool    extruding = apply(command);
+
+
+    if (options.terminator == STARTUP_EXTRUSION) return extruding && zMovedBefore ? STARTUP_END : STARTUP_CONTINUE;
+    if (!extrudedBefore) return STARTUP_CONTINUE;
+    if (extruding && z > layerZ) return STARTUP_END;
+
+    // A z-hop goes back down before the next extruding move and releases what it held
+    if (z != zBefore) layerPending = z > layerZ;
+    if (layerPending && z != zBefore) return STARTUP_HOLD;
+    return pendingBefore && !layerPending ? STARTUP_RELEASE : STARTUP_CONTINUE;
+
+} // decide
+
+
+/** \brief Reads extrusion (default), layer or a CommandFilter expression. */
+bool StartupExtractor::parseTerminator(const char* text, StartupOptions& options)
+{
+    if (!*text || !strcmp(text, "extrusion"))
+        options.terminator = STARTUP_EXTRUSION;
+    else if (!strcmp(text, "layer"))
+        options.terminator = STARTUP_LAYER_CHANGE;
+    else
+    {
+        options.terminator = STARTUP_FILTER;
+        return options.filter.parse(text) && !options.filter.empty();
+    }
+    return true;
+
+} // parseTerminator
+
+
+/** \brief Decodes and echoes the commands of the file at path up to the terminator.
+    Damaged commands are written like decodeRange() does but never end the sequence.
+    Returns false if the file can not be mapped. */
+bool StartupExtractor::extractFile(const char* path, const StartupOptions& options, StartupReport& report)
+{
+    MappedFile file;
+    if (!file.open(path, MAPPED_PARTIAL)) return false;
+
+    extractFile(file, options, report, [](GCode& command, uint8_t) { command.echoCommand(); });
+    return true;
+
+} // extractFile
+
+
+/** \brief Decodes the commands of file up to the terminator and hands them to handler. Messages
+    of damaged commands go to Com. */
+void StartupExtractor::extractFile(MappedFile& file, const StartupOptions& options, StartupReport& report, const StartupHandler& handler)
+{
+    uint8_t*        data = file.data();
+    size_t          fileSize = file.size();
+    size_t          offset = 0;
+    GCode           commands[STARTUP_BATCH];
+    BatchRecord     records[STARTUP_BATCH];
+    DecoderContext  context;
+    StartupState    state;
+    size_t          heldOffset = 0;
+    std::vector<std::pair<GCode, uint8_t>> held;    // behind a Z move that may start the next layer
+
+
+    auto release = [&]()
+    {
+        for (std::pair<GCode, uint8_t>& command : held) handler(command.first, command.second);
+        report.commands += held.size();
+        held.clear();
+    };
+
+    report = StartupReport();
+    file.adviseWillNeed(0, STARTUP_PREFETCH);
+    while (offset < fileSize && fileSize - offset > MIN_CMD_SIZE)
+    {
+        size_t      start = offset;
+        BatchResult batch = BinaryDecoder::decodeBatch({ data + start, fileSize - start }, { commands, records, STARTUP_BATCH }, context);
+
+        offset += batch.consumed;
+        for (size_t i = 0; i < batch.count; i++)
+        {
+            if (report.commands + held.size() == options.maxCommands)
+            {
+                release();
+                report.bytes = start + records[i].offset;
+                return;
+            }
+
+            StartupDecision decision = records[i].status == RECORD_OK ? state.decide(commands[i], options) : STARTUP_CONTINUE;
+            if (decision == STARTUP_END)
+            {
+                report.bytes = held.empty() ? start + records[i].offset : heldOffset;
+                report.terminated = true;
+                return;
+            }
+            if (decision != STARTUP_CONTINUE) release();
+            if (decision == STARTUP_HOLD) heldOffset = start + records[i].offset;
+            if (decision == STARTUP_HOLD || !held.empty())
+            {
+                held.emplace_back(commands[i], records[i].status);
+                continue;
+            }
+            handler(commands[i], records[i].status);
+            report.commands++;
+        }
+    }
+    release();
+    report.bytes = fileSize;
+
+} // extractFile
+
+
+/** \brief Lists the .gco files below directory (any case of the extension) in sorted order.
+    Returns false if the directory can not be read. */
+bool StartupExtractor::findFiles(const char* directory, std::vector<std::string>& files)
+{
+    std::error_code error;
+
+
+    for (fs::recursive_directory_iterator it(directory, error), end; !error && it != end; it.increment(error))
+    {
+        std::string extension = it->path().extension().string();
+        std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char c) { return (char)tolower(c); });
+        if (extension == ".gco" && it->is_regular_file(error)) files.push_back(it->path().string());
+    }
+    std::sort(files.begin(), files.end());
+    return !error;
+
+} // findFiles
+
+
+/** \brief Extracts the startup sequence of every .gco file below directory into a .gcode file
+    at the same relative path below outputDirectory, threadCount files at a time. */
+void StartupExtractor::extractDirectory(const char* directory, const char* outputDirectory, const StartupOptions& options,
+    unsigned int threadCount, StartupDirectoryReport& report)
+{
+    std::vector<std::string>    files;
+    fs::path                    root(directory);
+    fs::path                    outputRoot(outputDirectory);
+
+
+    if (!findFiles(directory, files))
+    {
+        report.failed++;
+        report.failures.push_back(root.string());
+    }
+
+    std::atomic<size_t> nextFile(0);
+    std::mutex          mutex;
+    auto worker = [&]()
+    {
+        StartupDirectoryReport  local;
+        OutputSink              output(OUTPUT_FILE, STARTUP_OUTPUT_SIZE);
+
+        Com::setThreadSink(&output);
+        for (size_t index = nextFile++; index < files.size(); index = nextFile++)
+        {
+            fs::path        input(files[index]);
+            fs::path        target = outputRoot / input.lexically_relative(root);
+            StartupReport   result;
+            std::error_code createError;
+
+            target.replace_extension(".gcode");
+            fs::create_directories(target.parent_path(), createError);
+            bool ok = output.openFile(target.string().c_str()) && extractFile(input.string().c_str(), options, result);
+            if (!ok) output.clear(); // nothing of a failed file goes into the next one
+            output.closeFile();
+
+            local.files++;
+            if (!ok)
+            {
+                local.failed++;
+                local.failures.push_back(input.string());
+                continue;
+            }
+            local.commands += result.commands;
+            local.bytes += result.bytes;
+            if (result.terminated) local.terminated++;
+        }
+        Com::setThreadSink(nullptr);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        report.files += local.files;
+        report.terminated += local.terminated;
+        report.commands += local.commands;
+        report.bytes += local.bytes;
+        report.failed += local.failed;
+        for (std::string& failure : local.failures)
+            if (report.failures.size() < STARTUP_MAX_FAILURES) report.failures.push_back(failure);
+    };
+
+    if (!threadCount) threadCount = 1;
+    threadCount = (unsigned int)std::min<size_t>(threadCount, std::max<size_t>(files.size(), 1));
+    std::vector<std::thread> threads;
+    for (unsigned int i = 1; i < threadCount; i++)
+        threads.emplace_back(worker);
+    worker();
+    for (std::thread& thread : threads)
+        thread.join();
+    std::sort(report.failures.begin(), report.failures.end());
+
+} // extractDirectory
@@ -0,0 +1,115 @@
+#pragma once
+
+#include "types.h"
+#include "CommandFilter.h"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+class GCode;
+class MappedFile;
+
+/** Commands decoded per BinaryDecoder::decodeBatch() call while searching the terminator. */
+#define STARTUP_BATCH 64
+
+/** Bytes at the start of a file requested ahead while searching the terminator. */
+#define STARTUP_PREFETCH (64 * 1024)
+
+/** Buffer of the output file of each file in directory mode. */
+#define STARTUP_OUTPUT_SIZE (64 * 1024)
+
+/** Number of failed files listed in a StartupDirectoryReport. */
+#define STARTUP_MAX_FAILURES 100
+
+/** \brief Command at which the startup sequence ends, it is not part of the sequence. */
+enum StartupTerminator
+{
+    STARTUP_EXTRUSION,      ///< First G0/G1 moving in X or Y while extruding, behind a Z move.
+    STARTUP_LAYER_CHANGE,   ///< Last Z move in front of the first extruding move above the first layer,
+                            ///< like the layers of FileIndex. A z-hop between extrusions is no layer change.
+    STARTUP_FILTER          ///< First command matching StartupOptions::filter.
+};
+
+struct StartupOptions
+{
+    StartupTerminator   terminator = STARTUP_EXTRUSION;
+    CommandFilter       filter;
+    size_t              maxCommands = SIZE_MAX;     ///< Ends a sequence without terminator.
+};
+
+/** \brief What a command means for the end of the startup sequence, see StartupState::decide(). */
+enum StartupDecision
+{
+    STARTUP_CONTINUE,       ///< Part of the sequence, unless commands are held in front of it.
+    STARTUP_END,            ///< The terminator, or the first held command is.
+    STARTUP_HOLD,           ///< Z move that may start the next layer: the held commands are part of
+                            ///< the sequence, this one and the following are held.
+    STARTUP_RELEASE         ///< The held commands and this one are part of the sequence.
+};
+
+/** \brief Receives the commands of a startup sequence with their RecordStatus. */
+typedef std::function<void(GCode&, uint8_t)> StartupHandler;
+
+/** \brief Positions and modes of a print, enough to find the terminator. Moves are tracked
+    with G90/G91, M82/M83 and G92. */
+struct StartupState
+{
+    bool    relative = false;       ///< G91
+    bool    relativeE = false;      ///< M83 or G91
+    bool    zMoved = false;
+    bool    extruded = false;
+    float   z = 0;
+    float   e = 0;
+    float   layerZ = 0;             ///< Height of the first extruding move, the first layer.
+    bool    layerPending = false;   ///< Behind a Z move above the first layer, it is the next layer
+                                    ///< if an extruding move follows at that height.
+    bool    eKnown = true;          ///< e is the extruder position, not just an offset to it. Cleared to
+                                    ///< start in the middle of a file, set by G92 E or an absolute E move.
+
+    bool apply(const GCode& command);
+    StartupDecision decide(const GCode& command, const StartupOptions& options);
+};
+
+/** \brief Result of StartupExtractor::extractFile(). */
+struct StartupReport
+{
+    size_t      commands = 0;       ///< Commands of the startup sequence.
+    size_t      bytes = 0;          ///< Offset of the terminator, the file size if there is none.
+    bool        terminated = false; ///< The terminator was found.
+};
+
+/** \brief Result of StartupExtractor::extractDirectory(). */
+struct StartupDirectoryReport
+{
+    size_t                      files = 0;
+    size_t                      terminated = 0;     ///< Files in which the terminator was found.
+    size_t                      commands = 0;
+    size_t                      bytes = 0;          ///< Bytes of all startup sequences.
+    size_t                      failed = 0;         ///< Files that could not be mapped or written.
+    std::vector<std::string>    failures;           ///< The first failed files.
+};
+
+/** \brief Decodes the startup sequence of binary files: homing, heating and priming up to a
+    terminator, and stops there.
+
+The commands are decoded in small batches straight from the mapping. The file is opened
+without the sequential read-ahead of a full decode and only its first STARTUP_PREFETCH bytes
+are requested ahead, so a short startup sequence reads about that much plus the normal
+read-ahead of the kernel around the pages in front of the terminator. StartupState tells an
+extruding move from a retraction or a travel move. For STARTUP_LAYER_CHANGE the commands
+behind a Z move above the first layer are held until the next extruding move shows whether
+the Z move started a new layer. extractDirectory() runs over all .gco files below a directory
+on several threads and writes one file per input. */
+class StartupExtractor
+{
+public:
+    static bool parseTerminator(const char* text, StartupOptions& options);
+    static bool extractFile(const char* path, const StartupOptions& options, StartupReport& report);
+    static void extractFile(MappedFile& file, const StartupOptions& options, StartupReport& report, const StartupHandler& handler);
+    static bool findFiles(const char* directory, std::vector<std::string>& files);
+    static void extractDirectory(const char* directory, const char* outputDirectory, const StartupOptions& options,
+        unsigned int threadCount, StartupDirectoryReport& report);
+
+}; // StartupExtractor
@@ -1,9 +1,12 @@
 ﻿#pragma once
 
 #include "types.h"
+#include "NumberParser.h"
 
 #define MAX_CMD_SIZE 128
 
+class DecoderContext;
+
 enum FirmwareState { NotBusy = 0, Processing, Paused, WaitHeater };
 
 class GCode   // 52 uint8_ts per command needed
@@ -152,27 +155,22 @@ public:
     } // hasFormatError
 
     void printCommand();
-    bool parseBinary(uint8_t* buffer, uint8_t size, bool fromSerial);
-    bool parseAscii(char* line, bool fromSerial);
-    void popCurrentCommand();
+    bool parseBinary(uint8_t* buffer, uint8_t size, bool fromSerial, DecoderContext& context);
+    void decodeBinary(uint8_t* buffer, uint8_t size, DecoderContext& context);
+    bool parseAscii(char* line, bool fromSerial, DecoderContext& context);
     void echoCommand();
-    static GCode* peekCurrentCommand();
-    static void readFromSerial();
-    static void readFromSD();
-    static void pushCommand();
     static uint8_t computeBinarySize(char* ptr);
+    static void computeFletcher16(const uint8_t* buffer, uint8_t len, unsigned int& sum1, unsigned int& sum2);
+    static bool hasValidChecksum(const uint8_t* buffer, uint8_t size);
     static void keepAlive(enum FirmwareState state);
     static uint32_t keepAliveInterval;
 
 
 private:
-    void checkAndPushCommand();
-    static void requestResend();
-
     inline float parseFloatValue(char* s)
     {
         char* endPtr;
-        float f = (strtod(s, &endPtr));
+        float f = (float)NumberParser::toDouble(s, &endPtr);
         if (s == endPtr) setFormatError();
         return f;
     } // parseFloatValue
@@ -180,29 +178,9 @@ private:
     inline long parseLongValue(char* s)
     {
         char* endPtr;
-        long l = (strtol(s, &endPtr, 10));
+        long l = NumberParser::toLong(s, &endPtr);
         if (s == endPtr) setFormatError();
         return l;
     } // parseLongValue
 
-    static GCode commandsBuffered[GCODE_BUFFER_SIZE];	///< Buffer for received commands.
-    static uint8_t bufferReadIndex;						///< Read position in gcode_buffer.
-    static uint8_t bufferWriteIndex;					///< Write position in gcode_buffer.
-    static uint8_t commandReceiving[MAX_CMD_SIZE];		///< Current received command.
-    static uint8_t commandsReceivingWritePosition;		///< Writing position in gcode_transbuffer.
-    static uint8_t sendAsBinary;						///< Flags the command as binary input.
-    static uint8_t wasLastCommandReceivedAsBinary;		///< Was the last successful command in binary mode?
-    static uint8_t commentDetected;						///< Flags true if we are reading the comment part of a command.
-    static uint8_t binaryCommandSize;					///< Expected size of the incoming binary command.
-    static bool waitUntilAllCommandsAreParsed;			///< Don't read until all commands are parsed. Needed if gcode_buffer is misused as storage for strings.
-    static uint32_t lastLineNumber;						///< Last line number received.
-    static uint32_t actLineNumber;						///< Line number of current command.
-    static volatile uint8_t bufferLength;				///< Number of commands stored in gcode_buffer
-    static millis_t timeOfLastDataPacket;				///< Time, when we got the last data packet. Used to detect missing uint8_ts.
-    static uint8_t formatErrors;						///< Number of sequential format errors
-    static millis_t lastBusySignal;						///< When was the last busy signal
-
-public:
-    static int8_t waitingForResend;						///< Waiting for line to be resend. -1 = no wait.
-
 }; // GCode
@@ -0,0 +1,29 @@
+# Runs one decoder test: cmake -DDECODER=... -DARGS=a|b|c [-DRESULT=N] [-DSTDOUT=F] [-DOUTPUT=F -DEXPECTED=G] -P RunDecoder.cmake
+#
+# Runs DECODER with the |-separated ARGS in the current directory, fails unless it exits with
+# RESULT (default 0) and, with OUTPUT, unless the file OUTPUT equals EXPECTED byte by byte.
+# With STDOUT the standard output is written to that file first.
+
+if(NOT DEFINED RESULT)
+    set(RESULT 0)
+endif()
+string(REPLACE "|" ";" arguments "${ARGS}")
+
+execute_process(COMMAND ${DECODER} ${arguments}
+    RESULT_VARIABLE result
+    OUTPUT_VARIABLE output
+    ERROR_VARIABLE errors)
+if(DEFINED STDOUT)
+    file(WRITE ${STDOUT} "${output}")
+endif()
+if(NOT result EQUAL RESULT)
+    string(REPLACE "|" " " command "${ARGS}")
+    message(FATAL_ERROR "${DECODER} ${command} exited with ${result} instead of ${RESULT}:\n${output}${errors}")
+endif()
+
+if(DEFINED OUTPUT)
+    execute_process(COMMAND ${CMAKE_COMMAND} -E compare_files ${OUTPUT} ${EXPECTED} RESULT_VARIABLE different)
+    if(different)
+        message(FATAL_ERROR "${OUTPUT} differs from ${EXPECTED}")
+    endif()
+endif()
@@ -0,0 +1,6 @@
+Error:Wrong checksum|-170|85|G1  X71.76 Y61.14 E23.1598
+G1  X73.40 Y59.92 E23.2113
+G1  X74.26 Y59.37 E23.2371
+G1  X75.15 Y58.87 E23.2628
+G1  X76.07 Y58.40 E23.2886
+G1  X77.00 Y57.99 E23.3144
@@ -0,0 +1,25 @@
+M107 
+M190  S60
+M104 T0  S230
+M104 T1  S230
+M82 
+M185 
+M190  S0
+T0 
+M109 T0  S230
+T1 
+M109 T1  S230
+M201 
+M202 
+M82 
+T0 
+M109 T0  S210
+M80 A<m
+T119 
+
+T7 
+B:BAE
+M183  S1118437900
+M46 
+T204 
+T37  S2990715142
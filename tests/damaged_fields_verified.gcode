@@ -0,0 +1,16 @@
+M107 
+M190  S60
+M104 T0  S230
+M104 T1  S230
+M82 
+M185 
+M190  S0
+T0 
+M109 T0  S230
+T1 
+M109 T1  S230
+M201 
+M202 
+M82 
+T0 
+M109 T0  S210
@@ -0,0 +1,2414 @@
+M107 
+M190  S60
+M104 T0  S230
+M104 T1  S230
+G28 
+G1  Z5.00 F5000.00
+G90 
+M82 
+M185 
+M190  S0
+T0 
+M109 T0  S230
+G92  E0.0000
+G1  E-0.5000 F300.00
+G1  X0.00 Y25.00 Z0.35 F2000.00
+G1  E8.0000 F800.00
+G1  X180.00 Y30.00 E25.0000 F1000.00
+G1  Y33.00
+T1 
+M109 T1  S230
+G92  E0.0000
+G1  E-0.5000 F300.00
+G1  E8.0000 F800.00
+G1  X0.00 Y28.00 E25.0000 F1000.00
+M201  X1500.00 Y1500.00 Z1000.00
+M202  X1500.00 Y1500.00 Z1000.00
+G21 
+G90 
+M82 
+G92  E0.0000
+T0 
+G92  E0.0000
+M109 T0  S210
+G1  Z0.30 F4200.00
+G1  E-1.5000 F1080.00
+G92  E0.0000
+G1  X59.71 Y56.47 F4200.00
+G1  E1.5000 F1080.00
+G1  F3000.00
+G1  X61.88 Y54.08 E1.5813
+G1  X64.24 Y51.95 E1.6615
+G1  X66.79 Y50.05 E1.7415
+G1  X69.53 Y48.41 E1.8219
+G1  X72.48 Y47.01 E1.9043
+G1  X75.50 Y45.93 E1.9852
+G1  X78.62 Y45.15 E2.0660
+G1  X81.79 Y44.68 E2.1468
+G1  X85.00 Y44.52 E2.2278
+G1  X88.20 Y44.68 E2.3085
+G1  X91.38 Y45.15 E2.3894
+G1  X94.45 Y45.92 E2.4690
+G1  X97.52 Y47.01 E2.5512
+G1  X100.42 Y48.39 E2.6321
+G1  X103.18 Y50.04 E2.7129
+G1  X105.75 Y51.95 E2.7938
+G1  X108.14 Y54.12 E2.8751
+G1  X110.29 Y56.49 E2.9555
+G1  X112.19 Y59.06 E3.0362
+G1  X113.82 Y61.77 E3.1157
+G1  X115.20 Y64.67 E3.1968
+G1  X116.28 Y67.69 E3.2774
+G1  X117.08 Y70.84 E3.3594
+G1  X117.55 Y74.05 E3.4412
+G1  X117.71 Y77.23 E3.5213
+G1  X117.55 Y80.44 E3.6022
+G1  X117.08 Y83.61 E3.6830
+G1  X116.31 Y86.70 E3.7630
+G1  X115.21 Y89.76 E3.8450
+G1  X113.84 Y92.66 E3.9258
+G1  X112.19 Y95.41 E4.0066
+G1  X110.26 Y98.01 E4.0881
+G1  X108.11 Y100.38 E4.1689
+G1  X105.74 Y102.53 E4.2493
+G1  X103.16 Y104.44 E4.3302
+G1  X100.45 Y106.06 E4.4097
+G1  X97.50 Y107.46 E4.4919
+G1  X94.53 Y108.52 E4.5714
+G1  X91.38 Y109.32 E4.6534
+G1  X88.19 Y109.79 E4.7344
+G1  X84.99 Y109.95 E4.8152
+G1  X81.83 Y109.79 E4.8950
+G1  X78.61 Y109.32 E4.9768
+G1  X75.50 Y108.54 E5.0577
+G1  X72.47 Y107.45 E5.1388
+G1  X69.57 Y106.08 E5.2194
+G1  X66.85 Y104.45 E5.2994
+G1  X64.24 Y102.52 E5.3812
+G1  X61.84 Y100.35 E5.4627
+G1  X59.70 Y97.98 E5.5431
+G1  X57.79 Y95.40 E5.6241
+G1  X56.16 Y92.69 E5.7037
+G1  X54.77 Y89.74 E5.7858
+G1  X53.69 Y86.72 E5.8666
+G1  X52.91 Y83.61 E5.9474
+G1  X52.44 Y80.41 E6.0288
+G1  X52.28 Y77.23 E6.1089
+G1  X52.44 Y74.03 E6.1898
+G1  X52.91 Y70.85 E6.2707
+G1  X53.69 Y67.74 E6.3515
+G1  X54.77 Y64.71 E6.4326
+G1  X56.15 Y61.81 E6.5134
+G1  X57.80 Y59.05 E6.5944
+G1  X59.68 Y56.52 E6.6737
+G1  X60.11 Y56.84 F4200.00
+G1  F3000.00
+G1  X62.26 Y54.46 E6.7546
+G1  X64.58 Y52.36 E6.8334
+G1  X67.09 Y50.50 E6.9120
+G1  X69.78 Y48.88 E6.9911
+G1  X72.68 Y47.50 E7.0722
+G1  X75.66 Y46.44 E7.1517
+G1  X78.72 Y45.67 E7.2313
+G1  X81.84 Y45.21 E7.3107
+G1  X85.00 Y45.06 E7.3904
+G1  X88.15 Y45.21 E7.4697
+G1  X91.27 Y45.67 E7.5493
+G1  X94.30 Y46.43 E7.6279
+G1  X97.31 Y47.51 E7.7085
+G1  X100.16 Y48.85 E7.7878
+G1  X102.88 Y50.48 E7.8676
+G1  X105.41 Y52.36 E7.9471
+G1  X107.77 Y54.50 E8.0272
+G1  X109.87 Y56.83 E8.1062
+G1  X111.75 Y59.36 E8.1855
+G1  X113.35 Y62.02 E8.2639
+G1  X114.71 Y64.88 E8.3437
+G1  X115.77 Y67.84 E8.4228
+G1  X116.55 Y70.94 E8.5034
+G1  X117.02 Y74.11 E8.5840
+G1  X117.17 Y77.23 E8.6627
+G1  X117.02 Y80.38 E8.7423
+G1  X116.55 Y83.52 E8.8220
+G1  X115.80 Y86.54 E8.9005
+G1  X114.72 Y89.55 E8.9811
+G1  X113.37 Y92.41 E9.0606
+G1  X111.74 Y95.12 E9.1403
+G1  X109.85 Y97.67 E9.2204
+G1  X107.73 Y100.01 E9.2999
+G1  X105.40 Y102.11 E9.3788
+G1  X102.87 Y103.99 E9.4583
+G1  X100.19 Y105.59 E9.5368
+G1  X97.30 Y106.96 E9.6174
+G1  X94.38 Y108.01 E9.6956
+G1  X91.27 Y108.79 E9.7763
+G1  X88.14 Y109.26 E9.8560
+G1  X84.99 Y109.41 E9.9354
+G1  X81.88 Y109.26 E10.0139
+G1  X78.71 Y108.79 E10.0947
+G1  X75.65 Y108.02 E10.1742
+G1  X72.68 Y106.96 E10.2537
+G1  X69.83 Y105.61 E10.3331
+G1  X67.15 Y104.01 E10.4117
+G1  X64.58 Y102.11 E10.4921
+G1  X62.22 Y99.97 E10.5725
+G1  X60.12 Y97.64 E10.6514
+G1  X58.23 Y95.10 E10.7311
+G1  X56.63 Y92.44 E10.8094
+G1  X55.26 Y89.54 E10.8901
+G1  X54.20 Y86.57 E10.9696
+G1  X53.43 Y83.51 E11.0491
+G1  X52.97 Y80.36 E11.1292
+G1  X52.82 Y77.24 E11.2080
+G1  X52.97 Y74.08 E11.2875
+G1  X53.43 Y70.96 E11.3671
+G1  X54.20 Y67.90 E11.4466
+G1  X55.27 Y64.91 E11.5263
+G1  X56.62 Y62.06 E11.6058
+G1  X58.24 Y59.35 E11.6855
+G1  X60.07 Y56.89 E11.7627
+G1  X60.50 Y57.21 F4200.00
+G1  F3000.00
+G1  X62.64 Y54.84 E11.8432
+G1  X64.92 Y52.77 E11.9207
+G1  X67.38 Y50.95 E11.9978
+G1  X70.04 Y49.35 E12.0758
+G1  X72.89 Y48.00 E12.1554
+G1  X75.81 Y46.95 E12.2336
+G1  X78.82 Y46.20 E12.3118
+G1  X81.89 Y45.74 E12.3899
+G1  X85.00 Y45.59 E12.4682
+G1  X88.09 Y45.74 E12.5463
+G1  X91.17 Y46.20 E12.6245
+G1  X94.14 Y46.94 E12.7018
+G1  X97.11 Y48.00 E12.7811
+G1  X99.91 Y49.33 E12.8593
+G1  X102.58 Y50.93 E12.9375
+G1  X105.07 Y52.78 E13.0157
+G1  X107.39 Y54.88 E13.0946
+G1  X109.46 Y57.16 E13.1722
+G1  X111.30 Y59.65 E13.2502
+G1  X112.88 Y62.27 E13.3272
+G1  X114.21 Y65.09 E13.4057
+G1  X115.26 Y67.99 E13.4835
+G1  X116.03 Y71.05 E13.5630
+G1  X116.49 Y74.16 E13.6421
+G1  X116.64 Y77.24 E13.7196
+G1  X116.48 Y80.34 E13.7979
+G1  X116.03 Y83.41 E13.8761
+G1  X115.28 Y86.38 E13.9532
+G1  X114.23 Y89.34 E14.0325
+G1  X112.90 Y92.15 E14.1107
+G1  X111.30 Y94.82 E14.1890
+G1  X109.43 Y97.33 E14.2679
+G1  X107.35 Y99.63 E14.3460
+G1  X105.06 Y101.70 E14.4236
+G1  X102.57 Y103.54 E14.5018
+G1  X99.94 Y105.12 E14.5789
+G1  X97.10 Y106.47 E14.6582
+G1  X94.22 Y107.50 E14.7353
+G1  X91.16 Y108.27 E14.8146
+G1  X88.09 Y108.72 E14.8928
+G1  X85.00 Y108.88 E14.9710
+G1  X81.94 Y108.73 E15.0481
+G1  X78.82 Y108.27 E15.1275
+G1  X75.80 Y107.51 E15.2057
+G1  X72.88 Y106.47 E15.2839
+G1  X70.08 Y105.14 E15.3619
+G1  X67.45 Y103.56 E15.4393
+G1  X64.92 Y101.70 E15.5184
+G1  X62.60 Y99.59 E15.5975
+G1  X60.53 Y97.30 E15.6750
+G1  X58.68 Y94.81 E15.7533
+G1  X57.11 Y92.19 E15.8303
+G1  X55.76 Y89.34 E15.9097
+G1  X54.71 Y86.42 E15.9879
+G1  X53.96 Y83.40 E16.0661
+G1  X53.50 Y80.31 E16.1450
+G1  X53.35 Y77.23 E16.2225
+G1  X53.50 Y74.13 E16.3008
+G1  X53.96 Y71.06 E16.3790
+G1  X54.71 Y68.05 E16.4570
+G1  X55.76 Y65.11 E16.5356
+G1  X57.09 Y62.31 E16.6138
+G1  X58.69 Y59.65 E16.6919
+G1  X60.46 Y57.26 E16.7670
+G1  E15.2670 F1080.00
+G92  E0.0000
+G1  X66.37 Y62.01 F4200.00
+G1  E1.5000 F1080.00
+G1  F3000.00
+G1  X67.14 Y61.12 E1.5296
+G1  X67.94 Y60.27 E1.5590
+G1  X68.79 Y59.46 E1.5887
+G1  X69.68 Y58.68 E1.6184
+G1  X70.61 Y57.95 E1.6482
+G1  X71.58 Y57.27 E1.6779
+G1  X72.57 Y56.64 E1.7076
+G1  X73.60 Y56.05 E1.7374
+G1  X74.65 Y55.52 E1.7671
+G1  X75.73 Y55.04 E1.7969
+G1  X76.83 Y54.61 E1.8266
+G1  X77.95 Y54.24 E1.8563
+G1  X79.09 Y53.92 E1.8861
+G1  X80.24 Y53.66 E1.9158
+G1  X81.40 Y53.45 E1.9454
+G1  X82.57 Y53.30 E1.9753
+G1  X83.75 Y53.21 E2.0049
+G1  X84.93 Y53.18 E2.0348
+G1  X86.05 Y53.20 E2.0631
+G1  X87.28 Y53.29 E2.0941
+G1  X88.46 Y53.43 E2.1239
+G1  X89.64 Y53.63 E2.1541
+G1  X90.78 Y53.89 E2.1835
+G1  X91.91 Y54.20 E2.2132
+G1  X93.04 Y54.57 E2.2429
+G1  X94.14 Y54.99 E2.2727
+G1  X95.22 Y55.46 E2.3024
+G1  X96.27 Y55.99 E2.3321
+G1  X97.30 Y56.57 E2.3619
+G1  X98.30 Y57.20 E2.3916
+G1  X99.27 Y57.88 E2.4213
+G1  X100.20 Y58.60 E2.4511
+G1  X101.10 Y59.37 E2.4808
+G1  X101.96 Y60.18 E2.5105
+G1  X102.77 Y61.03 E2.5403
+G1  X103.55 Y61.93 E2.5700
+G1  X104.27 Y62.85 E2.5997
+G1  X104.96 Y63.83 E2.6298
+G1  X105.60 Y64.82 E2.6595
+G1  X106.18 Y65.85 E2.6893
+G1  X106.71 Y66.89 E2.7187
+G1  X107.19 Y67.97 E2.7483
+G1  X107.62 Y69.07 E2.7781
+G1  X107.99 Y70.19 E2.8079
+G1  X108.31 Y71.33 E2.8376
+G1  X108.57 Y72.48 E2.8674
+G1  X108.78 Y73.64 E2.8971
+G1  X108.92 Y74.81 E2.9268
+G1  X109.01 Y75.99 E2.9566
+G1  X109.05 Y77.17 E2.9863
+G1  X109.02 Y78.35 E3.0161
+G1  X108.94 Y79.53 E3.0458
+G1  X108.79 Y80.70 E3.0755
+G1  X108.60 Y81.86 E3.1053
+G1  X108.34 Y83.02 E3.1350
+G1  X108.03 Y84.15 E3.1647
+G1  X107.66 Y85.29 E3.1949
+G1  X107.23 Y86.40 E3.2247
+G1  X106.76 Y87.46 E3.2540
+G1  X106.24 Y88.51 E3.2836
+G1  X105.65 Y89.54 E3.3135
+G1  X105.02 Y90.55 E3.3435
+G1  X104.34 Y91.52 E3.3732
+G1  X103.63 Y92.44 E3.4025
+G1  X102.86 Y93.34 E3.4323
+G1  X102.05 Y94.20 E3.4621
+G1  X101.19 Y95.01 E3.4918
+G1  X100.30 Y95.79 E3.5216
+G1  X99.37 Y96.51 E3.5513
+G1  X98.41 Y97.20 E3.5810
+G1  X97.41 Y97.83 E3.6108
+G1  X95.34 Y98.95 E3.6702
+G1  X94.26 Y99.43 E3.7000
+G1  X93.16 Y99.86 E3.7297
+G1  X92.02 Y100.24 E3.7598
+G1  X90.88 Y100.55 E3.7896
+G1  X89.73 Y100.81 E3.8193
+G1  X88.57 Y101.02 E3.8491
+G1  X87.40 Y101.17 E3.8788
+G1  X86.24 Y101.25 E3.9082
+G1  X85.06 Y101.29 E3.9379
+G1  X83.88 Y101.26 E3.9677
+G1  X82.70 Y101.18 E3.9974
+G1  X81.52 Y101.03 E4.0272
+G1  X80.37 Y100.84 E4.0568
+G1  X79.21 Y100.58 E4.0865
+G1  X78.07 Y100.27 E4.1163
+G1  X76.95 Y99.90 E4.1460
+G1  X75.85 Y99.48 E4.1758
+G1  X74.77 Y99.00 E4.2055
+G1  X73.71 Y98.48 E4.2352
+G1  X72.68 Y97.90 E4.2650
+G1  X71.68 Y97.27 E4.2947
+G1  X70.72 Y96.59 E4.3244
+G1  X69.79 Y95.87 E4.3542
+G1  X68.89 Y95.10 E4.3839
+G1  X68.03 Y94.29 E4.4137
+G1  X67.21 Y93.43 E4.4434
+G1  X66.44 Y92.54 E4.4731
+G1  X65.71 Y91.61 E4.5028
+G1  X65.03 Y90.65 E4.5327
+G1  X64.39 Y89.65 E4.5624
+G1  X63.80 Y88.61 E4.5925
+G1  X63.27 Y87.55 E4.6225
+G1  X62.79 Y86.48 E4.6520
+G1  X62.37 Y85.39 E4.6814
+G1  X62.00 Y84.28 E4.7110
+G1  X61.68 Y83.14 E4.7407
+G1  X61.42 Y81.99 E4.7705
+G1  X61.21 Y80.83 E4.8002
+G1  X61.06 Y79.66 E4.8300
+G1  X60.97 Y78.48 E4.8597
+G1  X60.94 Y77.30 E4.8894
+G1  X60.97 Y76.12 E4.9192
+G1  X61.05 Y74.94 E4.9489
+G1  X61.19 Y73.77 E4.9786
+G1  X61.39 Y72.61 E5.0084
+G1  X61.65 Y71.45 E5.0381
+G1  X61.96 Y70.30 E5.0682
+G1  X62.33 Y69.17 E5.0982
+G1  X62.75 Y68.08 E5.1276
+G1  X63.22 Y67.00 E5.1572
+G1  X63.76 Y65.94 E5.1873
+G1  X64.33 Y64.91 E5.2169
+G1  X64.97 Y63.91 E5.2467
+G1  X65.64 Y62.95 E5.2761
+G1  X66.34 Y62.06 E5.3048
+G1  X66.79 Y62.34 F4200.00
+G1  F3000.00
+G1  X67.54 Y61.47 E5.3337
+G1  X68.32 Y60.64 E5.3624
+G1  X69.16 Y59.85 E5.3915
+G1  X70.03 Y59.09 E5.4206
+G1  X70.94 Y58.38 E5.4496
+G1  X71.88 Y57.71 E5.4787
+G1  X72.86 Y57.09 E5.5078
+G1  X73.86 Y56.52 E5.5369
+G1  X74.89 Y56.00 E5.5659
+G1  X75.94 Y55.53 E5.5950
+G1  X77.02 Y55.11 E5.6241
+G1  X78.11 Y54.75 E5.6532
+G1  X79.22 Y54.44 E5.6822
+G1  X80.35 Y54.18 E5.7113
+G1  X81.48 Y53.98 E5.7403
+G1  X82.63 Y53.84 E5.7695
+G1  X83.78 Y53.75 E5.7984
+G1  X84.94 Y53.72 E5.8277
+G1  X86.04 Y53.74 E5.8553
+G1  X87.24 Y53.82 E5.8857
+G1  X88.38 Y53.96 E5.9148
+G1  X89.54 Y54.16 E5.9443
+G1  X90.65 Y54.41 E5.9730
+G1  X91.77 Y54.71 E6.0020
+G1  X92.86 Y55.07 E6.0311
+G1  X93.94 Y55.49 E6.0602
+G1  X95.00 Y55.95 E6.0893
+G1  X96.03 Y56.47 E6.1184
+G1  X97.04 Y57.03 E6.1474
+G1  X98.01 Y57.65 E6.1765
+G1  X98.96 Y58.31 E6.2056
+G1  X99.87 Y59.02 E6.2347
+G1  X100.75 Y59.77 E6.2637
+G1  X101.58 Y60.56 E6.2928
+G1  X102.38 Y61.40 E6.3219
+G1  X103.14 Y62.27 E6.3509
+G1  X103.85 Y63.18 E6.3800
+G1  X104.52 Y64.13 E6.4094
+G1  X105.14 Y65.11 E6.4385
+G1  X105.71 Y66.11 E6.4675
+G1  X106.23 Y67.13 E6.4963
+G1  X106.70 Y68.18 E6.5253
+G1  X107.12 Y69.26 E6.5544
+G1  X107.48 Y70.35 E6.5835
+G1  X107.79 Y71.46 E6.6126
+G1  X108.05 Y72.59 E6.6417
+G1  X108.25 Y73.73 E6.6708
+G1  X108.39 Y74.87 E6.6998
+G1  X108.48 Y76.02 E6.7289
+G1  X108.51 Y77.18 E6.7580
+G1  X108.48 Y78.33 E6.7870
+G1  X108.40 Y79.48 E6.8161
+G1  X108.26 Y80.63 E6.8452
+G1  X108.07 Y81.77 E6.8743
+G1  X107.82 Y82.89 E6.9033
+G1  X107.51 Y84.01 E6.9324
+G1  X107.15 Y85.12 E6.9619
+G1  X106.73 Y86.20 E6.9910
+G1  X106.27 Y87.24 E7.0197
+G1  X105.76 Y88.27 E7.0487
+G1  X105.19 Y89.28 E7.0778
+G1  X104.57 Y90.26 E7.1072
+G1  X103.91 Y91.21 E7.1363
+G1  X103.21 Y92.11 E7.1649
+G1  X102.46 Y92.98 E7.1941
+G1  X101.66 Y93.82 E7.2232
+G1  X100.83 Y94.62 E7.2522
+G1  X99.96 Y95.38 E7.2813
+G1  X99.05 Y96.09 E7.3104
+G1  X98.11 Y96.76 E7.3394
+G1  X97.13 Y97.38 E7.3685
+G1  X96.13 Y97.95 E7.3976
+G1  X95.10 Y98.47 E7.4267
+G1  X94.05 Y98.94 E7.4558
+G1  X92.97 Y99.36 E7.4848
+G1  X91.86 Y99.73 E7.5143
+G1  X90.75 Y100.04 E7.5434
+G1  X89.62 Y100.29 E7.5725
+G1  X88.48 Y100.49 E7.6016
+G1  X87.34 Y100.63 E7.6305
+G1  X86.20 Y100.72 E7.6593
+G1  X85.05 Y100.75 E7.6884
+G1  X83.89 Y100.72 E7.7175
+G1  X82.74 Y100.64 E7.7465
+G1  X81.59 Y100.50 E7.7757
+G1  X80.46 Y100.31 E7.8046
+G1  X79.33 Y100.06 E7.8337
+G1  X78.22 Y99.75 E7.8628
+G1  X77.12 Y99.39 E7.8919
+G1  X76.05 Y98.98 E7.9209
+G1  X74.99 Y98.52 E7.9500
+G1  X73.96 Y98.00 E7.9791
+G1  X72.95 Y97.43 E8.0081
+G1  X71.98 Y96.82 E8.0372
+G1  X71.03 Y96.16 E8.0663
+G1  X70.12 Y95.45 E8.0954
+G1  X69.24 Y94.70 E8.1244
+G1  X68.40 Y93.90 E8.1535
+G1  X67.61 Y93.07 E8.1826
+G1  X66.85 Y92.20 E8.2117
+G1  X66.14 Y91.29 E8.2407
+G1  X65.47 Y90.34 E8.2699
+G1  X64.85 Y89.37 E8.2989
+G1  X64.27 Y88.36 E8.3284
+G1  X63.75 Y87.31 E8.3577
+G1  X63.28 Y86.27 E8.3865
+G1  X62.87 Y85.21 E8.4153
+G1  X62.51 Y84.11 E8.4443
+G1  X62.20 Y83.00 E8.4733
+G1  X61.94 Y81.88 E8.5024
+G1  X61.74 Y80.74 E8.5315
+G1  X61.60 Y79.59 E8.5606
+G1  X61.51 Y78.44 E8.5896
+G1  X61.48 Y77.29 E8.6187
+G1  X61.50 Y76.14 E8.6478
+G1  X61.58 Y74.98 E8.6769
+G1  X61.72 Y73.84 E8.7059
+G1  X61.92 Y72.70 E8.7350
+G1  X62.17 Y71.57 E8.7641
+G1  X62.48 Y70.45 E8.7935
+G1  X62.84 Y69.34 E8.8229
+G1  X63.25 Y68.28 E8.8516
+G1  X63.71 Y67.23 E8.8805
+G1  X64.23 Y66.18 E8.9099
+G1  X64.80 Y65.18 E8.9389
+G1  X65.42 Y64.20 E8.9680
+G1  X66.07 Y63.27 E8.9968
+G1  X66.75 Y62.39 E9.0247
+G1  X67.21 Y62.68 F4200.00
+G1  F3000.00
+G1  X67.94 Y61.83 E9.0531
+G1  X68.71 Y61.02 E9.0811
+G1  X69.52 Y60.24 E9.1095
+G1  X70.38 Y59.50 E9.1379
+G1  X71.26 Y58.80 E9.1663
+G1  X72.18 Y58.15 E9.1947
+G1  X73.14 Y57.55 E9.2232
+G1  X74.12 Y56.99 E9.2516
+G1  X75.12 Y56.48 E9.2800
+G1  X76.15 Y56.02 E9.3084
+G1  X77.21 Y55.61 E9.3368
+G1  X78.28 Y55.26 E9.3652
+G1  X79.36 Y54.95 E9.3936
+G1  X80.46 Y54.70 E9.4220
+G1  X81.57 Y54.51 E9.4503
+G1  X82.69 Y54.37 E9.4789
+G1  X83.81 Y54.28 E9.5072
+G1  X84.95 Y54.25 E9.5357
+G1  X86.02 Y54.28 E9.5627
+G1  X87.19 Y54.36 E9.5924
+G1  X88.31 Y54.49 E9.6209
+G1  X89.44 Y54.69 E9.6498
+G1  X90.53 Y54.93 E9.6778
+G1  X91.62 Y55.23 E9.7062
+G1  X92.69 Y55.58 E9.7346
+G1  X93.74 Y55.98 E9.7630
+G1  X94.77 Y56.44 E9.7914
+G1  X95.78 Y56.94 E9.8198
+G1  X96.77 Y57.50 E9.8482
+G1  X97.72 Y58.10 E9.8766
+G1  X98.64 Y58.75 E9.9051
+G1  X99.54 Y59.44 E9.9335
+G1  X100.39 Y60.17 E9.9619
+G1  X101.21 Y60.95 E9.9903
+G1  X101.99 Y61.76 E10.0187
+G1  X102.73 Y62.62 E10.0471
+G1  X103.42 Y63.50 E10.0755
+G1  X104.08 Y64.44 E10.1043
+G1  X104.69 Y65.39 E10.1327
+G1  X105.24 Y66.37 E10.1611
+G1  X105.75 Y67.36 E10.1892
+G1  X106.20 Y68.39 E10.2175
+G1  X106.61 Y69.44 E10.2460
+G1  X106.97 Y70.52 E10.2744
+G1  X107.27 Y71.60 E10.3028
+G1  X107.52 Y72.70 E10.3312
+G1  X107.72 Y73.81 E10.3596
+G1  X107.86 Y74.93 E10.3881
+G1  X107.94 Y76.06 E10.4165
+G1  X107.97 Y77.18 E10.4449
+G1  X107.95 Y78.31 E10.4733
+G1  X107.87 Y79.44 E10.5017
+G1  X107.73 Y80.56 E10.5301
+G1  X107.54 Y81.67 E10.5585
+G1  X107.30 Y82.77 E10.5869
+G1  X107.00 Y83.86 E10.6154
+G1  X106.64 Y84.94 E10.6441
+G1  X106.24 Y86.00 E10.6726
+G1  X105.79 Y87.02 E10.7006
+G1  X105.29 Y88.02 E10.7290
+G1  X104.73 Y89.01 E10.7574
+G1  X104.12 Y89.97 E10.7862
+G1  X103.47 Y90.89 E10.8146
+G1  X102.79 Y91.77 E10.8426
+G1  X102.05 Y92.63 E10.8710
+G1  X101.28 Y93.45 E10.8995
+G1  X100.46 Y94.23 E10.9279
+G1  X99.61 Y94.97 E10.9563
+G1  X98.72 Y95.66 E10.9847
+G1  X97.80 Y96.31 E11.0131
+G1  X96.85 Y96.92 E11.0415
+G1  X95.87 Y97.48 E11.0699
+G1  X94.86 Y97.99 E11.0983
+G1  X93.83 Y98.45 E11.1268
+G1  X92.78 Y98.86 E11.1552
+G1  X91.70 Y99.22 E11.1839
+G1  X90.61 Y99.52 E11.2124
+G1  X89.51 Y99.77 E11.2408
+G1  X88.40 Y99.96 E11.2692
+G1  X87.28 Y100.10 E11.2976
+G1  X86.17 Y100.18 E11.3257
+G1  X85.04 Y100.21 E11.3541
+G1  X83.91 Y100.19 E11.3825
+G1  X82.79 Y100.11 E11.4109
+G1  X81.67 Y99.97 E11.4394
+G1  X80.56 Y99.78 E11.4677
+G1  X79.46 Y99.54 E11.4961
+G1  X78.37 Y99.24 E11.5245
+G1  X77.30 Y98.89 E11.5529
+G1  X76.24 Y98.48 E11.5813
+G1  X75.21 Y98.03 E11.6098
+G1  X74.20 Y97.52 E11.6382
+G1  X73.22 Y96.97 E11.6666
+G1  X72.27 Y96.37 E11.6950
+G1  X71.34 Y95.72 E11.7234
+G1  X70.45 Y95.03 E11.7518
+G1  X69.60 Y94.29 E11.7802
+G1  X68.78 Y93.52 E11.8086
+G1  X68.00 Y92.70 E11.8371
+G1  X67.26 Y91.85 E11.8655
+G1  X66.56 Y90.96 E11.8939
+G1  X65.91 Y90.04 E11.9223
+G1  X65.30 Y89.09 E11.9508
+G1  X64.74 Y88.10 E11.9795
+G1  X64.23 Y87.08 E12.0082
+G1  X63.77 Y86.06 E12.0364
+G1  X63.37 Y85.02 E12.0645
+G1  X63.02 Y83.95 E12.0928
+G1  X62.71 Y82.86 E12.1212
+G1  X62.46 Y81.76 E12.1496
+G1  X62.27 Y80.65 E12.1780
+G1  X62.13 Y79.54 E12.2064
+G1  X62.04 Y78.41 E12.2348
+G1  X62.01 Y77.28 E12.2632
+G1  X62.04 Y76.15 E12.2916
+G1  X62.12 Y75.03 E12.3201
+G1  X62.25 Y73.91 E12.3485
+G1  X62.44 Y72.80 E12.3769
+G1  X62.69 Y71.70 E12.4053
+G1  X62.99 Y70.60 E12.4341
+G1  X63.35 Y69.51 E12.4628
+G1  X63.75 Y68.47 E12.4908
+G1  X64.20 Y67.45 E12.5190
+G1  X64.71 Y66.43 E12.5478
+G1  X65.26 Y65.45 E12.5761
+G1  X65.86 Y64.49 E12.6046
+G1  X66.51 Y63.58 E12.6327
+G1  X67.17 Y62.73 E12.6600
+G1  X67.63 Y63.01 F4200.00
+G1  F3000.00
+G1  X68.34 Y62.18 E12.6876
+G1  X69.09 Y61.39 E12.7150
+G1  X69.89 Y60.63 E12.7428
+G1  X70.72 Y59.91 E12.7705
+G1  X71.59 Y59.23 E12.7983
+G1  X72.49 Y58.59 E12.8260
+G1  X73.42 Y58.00 E12.8538
+G1  X74.38 Y57.46 E12.8815
+G1  X75.36 Y56.96 E12.9093
+G1  X76.37 Y56.51 E12.9370
+G1  X77.39 Y56.11 E12.9648
+G1  X78.44 Y55.77 E12.9925
+G1  X79.50 Y55.47 E13.0203
+G1  X80.57 Y55.23 E13.0480
+G1  X81.65 Y55.04 E13.0757
+G1  X82.75 Y54.90 E13.1035
+G1  X83.85 Y54.82 E13.1312
+G1  X84.95 Y54.79 E13.1591
+G1  X86.00 Y54.81 E13.1854
+G1  X87.15 Y54.89 E13.2145
+G1  X88.24 Y55.02 E13.2422
+G1  X89.35 Y55.21 E13.2704
+G1  X90.41 Y55.45 E13.2978
+G1  X91.47 Y55.74 E13.3255
+G1  X92.52 Y56.09 E13.3533
+G1  X93.54 Y56.48 E13.3810
+G1  X94.55 Y56.93 E13.4088
+G1  X95.54 Y57.42 E13.4365
+G1  X96.50 Y57.96 E13.4643
+G1  X97.43 Y58.55 E13.4920
+G1  X98.33 Y59.18 E13.5198
+G1  X99.20 Y59.86 E13.5475
+G1  X100.04 Y60.58 E13.5753
+G1  X100.84 Y61.33 E13.6030
+G1  X101.60 Y62.13 E13.6308
+G1  X102.32 Y62.96 E13.6585
+G1  X103.00 Y63.83 E13.6862
+G1  X103.64 Y64.74 E13.7144
+G1  X104.23 Y65.67 E13.7421
+G1  X104.78 Y66.63 E13.7698
+G1  X105.27 Y67.60 E13.7973
+G1  X105.71 Y68.60 E13.8249
+G1  X106.11 Y69.63 E13.8528
+G1  X106.46 Y70.68 E13.8805
+G1  X106.76 Y71.74 E13.9083
+G1  X107.00 Y72.81 E13.9360
+G1  X107.19 Y73.90 E13.9638
+G1  X107.33 Y74.99 E13.9915
+G1  X107.41 Y76.09 E14.0193
+G1  X107.44 Y77.19 E14.0470
+G1  X107.41 Y78.29 E14.0748
+G1  X107.34 Y79.39 E14.1025
+G1  X107.20 Y80.49 E14.1303
+G1  X107.02 Y81.57 E14.1580
+G1  X106.78 Y82.65 E14.1858
+G1  X106.48 Y83.71 E14.2135
+G1  X106.14 Y84.77 E14.2416
+G1  X105.74 Y85.80 E14.2694
+G1  X105.30 Y86.79 E14.2968
+G1  X104.81 Y87.78 E14.3245
+G1  X104.27 Y88.74 E14.3523
+G1  X103.67 Y89.68 E14.3804
+G1  X103.04 Y90.58 E14.4081
+G1  X102.37 Y91.44 E14.4354
+G1  X101.65 Y92.28 E14.4633
+G1  X100.89 Y93.08 E14.4910
+G1  X100.10 Y93.84 E14.5188
+G1  X99.26 Y94.56 E14.5465
+G1  X98.40 Y95.24 E14.5743
+G1  X97.50 Y95.87 E14.6020
+G1  X96.57 Y96.46 E14.6298
+G1  X95.61 Y97.01 E14.6575
+G1  X94.63 Y97.51 E14.6853
+G1  X93.62 Y97.95 E14.7130
+G1  X92.59 Y98.35 E14.7408
+G1  X91.54 Y98.70 E14.7689
+G1  X90.47 Y99.00 E14.7966
+G1  X89.40 Y99.24 E14.8244
+G1  X88.31 Y99.43 E14.8522
+G1  X87.22 Y99.57 E14.8799
+G1  X86.13 Y99.65 E14.9073
+G1  X85.04 Y99.68 E14.9350
+G1  X83.93 Y99.65 E14.9628
+G1  X82.83 Y99.58 E14.9905
+G1  X81.74 Y99.44 E15.0183
+G1  X80.66 Y99.26 E15.0460
+G1  X79.58 Y99.02 E15.0737
+G1  X78.52 Y98.72 E15.1015
+G1  X77.47 Y98.38 E15.1292
+G1  X76.44 Y97.99 E15.1570
+G1  X75.43 Y97.54 E15.1847
+G1  X74.45 Y97.05 E15.2125
+G1  X73.49 Y96.51 E15.2402
+G1  X72.56 Y95.92 E15.2680
+G1  X70.79 Y94.61 E15.3235
+G1  X69.95 Y93.89 E15.3512
+G1  X69.15 Y93.13 E15.3790
+G1  X68.39 Y92.34 E15.4067
+G1  X67.67 Y91.51 E15.4345
+G1  X66.99 Y90.64 E15.4622
+G1  X66.35 Y89.74 E15.4901
+G1  X65.76 Y88.81 E15.5178
+G1  X65.21 Y87.84 E15.5459
+G1  X64.71 Y86.84 E15.5739
+G1  X64.26 Y85.85 E15.6014
+G1  X63.87 Y84.83 E15.6288
+G1  X63.53 Y83.79 E15.6565
+G1  X63.23 Y82.73 E15.6843
+G1  X62.99 Y81.65 E15.7120
+G1  X62.80 Y80.57 E15.7398
+G1  X62.66 Y79.47 E15.7675
+G1  X62.58 Y78.38 E15.7953
+G1  X62.55 Y77.27 E15.8230
+G1  X62.57 Y76.17 E15.8508
+G1  X62.65 Y75.07 E15.8785
+G1  X62.79 Y73.98 E15.9063
+G1  X62.97 Y72.90 E15.9340
+G1  X63.21 Y71.82 E15.9618
+G1  X63.51 Y70.75 E15.9898
+G1  X63.86 Y69.69 E16.0179
+G1  X64.24 Y68.67 E16.0453
+G1  X64.68 Y67.67 E16.0728
+G1  X65.19 Y66.68 E16.1009
+G1  X65.72 Y65.72 E16.1286
+G1  X66.31 Y64.79 E16.1564
+G1  X66.94 Y63.89 E16.1838
+G1  X67.59 Y63.06 E16.2104
+G1  X68.05 Y63.35 F4200.00
+G1  F3000.00
+G1  X68.75 Y62.54 E16.2375
+G1  X69.48 Y61.77 E16.2642
+G1  X70.25 Y61.02 E16.2913
+G1  X71.07 Y60.32 E16.3184
+G1  X71.91 Y59.66 E16.3455
+G1  X72.79 Y59.04 E16.3725
+G1  X73.70 Y58.46 E16.3996
+G1  X74.63 Y57.93 E16.4267
+G1  X75.59 Y57.44 E16.4538
+G1  X76.58 Y57.01 E16.4809
+G1  X77.58 Y56.62 E16.5080
+G1  X78.60 Y56.28 E16.5351
+G1  X79.64 Y55.99 E16.5622
+G1  X80.68 Y55.75 E16.5892
+G1  X81.74 Y55.56 E16.6162
+G1  X82.81 Y55.43 E16.6434
+G1  X83.88 Y55.35 E16.6705
+G1  X84.96 Y55.32 E16.6976
+G1  X85.98 Y55.35 E16.7233
+G1  X87.11 Y55.43 E16.7517
+G1  X88.17 Y55.56 E16.7788
+G1  X89.25 Y55.74 E16.8063
+G1  X90.29 Y55.97 E16.8331
+G1  X91.32 Y56.26 E16.8601
+G1  X92.34 Y56.59 E16.8872
+G1  X93.35 Y56.98 E16.9143
+G1  X94.33 Y57.41 E16.9414
+G1  X95.29 Y57.90 E16.9685
+G1  X96.23 Y58.42 E16.9956
+G1  X97.14 Y59.00 E17.0227
+G1  X98.02 Y59.62 E17.0497
+G1  X98.87 Y60.28 E17.0768
+G1  X99.68 Y60.98 E17.1039
+G1  X100.46 Y61.72 E17.1310
+G1  X101.20 Y62.50 E17.1581
+G1  X101.91 Y63.31 E17.1852
+G1  X102.57 Y64.15 E17.2122
+G1  X103.20 Y65.04 E17.2397
+G1  X103.77 Y65.95 E17.2667
+G1  X104.31 Y66.89 E17.2938
+G1  X104.79 Y67.84 E17.3206
+G1  X105.22 Y68.81 E17.3476
+G1  X105.61 Y69.82 E17.3748
+G1  X105.95 Y70.84 E17.4019
+G1  X106.24 Y71.88 E17.4290
+G1  X106.48 Y72.93 E17.4561
+G1  X106.66 Y73.98 E17.4832
+G1  X106.79 Y75.05 E17.5102
+G1  X106.88 Y76.12 E17.5373
+G1  X106.90 Y77.20 E17.5644
+G1  X106.88 Y78.27 E17.5915
+G1  X106.80 Y79.35 E17.6186
+G1  X106.67 Y80.41 E17.6457
+G1  X106.49 Y81.47 E17.6728
+G1  X106.26 Y82.52 E17.6998
+G1  X105.97 Y83.56 E17.7269
+G1  X105.63 Y84.60 E17.7544
+G1  X105.24 Y85.60 E17.7815
+G1  X104.81 Y86.57 E17.8082
+G1  X104.33 Y87.53 E17.8353
+G1  X103.80 Y88.47 E17.8624
+G1  X103.22 Y89.39 E17.8898
+G1  X102.60 Y90.27 E17.9169
+G1  X101.95 Y91.11 E17.9436
+G1  X101.25 Y91.92 E17.9707
+G1  X100.51 Y92.70 E17.9978
+G1  X99.73 Y93.44 E18.0249
+G1  X98.92 Y94.15 E18.0520
+G1  X98.07 Y94.81 E18.0791
+G1  X97.19 Y95.43 E18.1061
+G1  X96.29 Y96.01 E18.1332
+G1  X95.35 Y96.54 E18.1603
+G1  X94.39 Y97.03 E18.1874
+G1  X93.41 Y97.46 E18.2145
+G1  X92.41 Y97.85 E18.2416
+G1  X91.37 Y98.19 E18.2690
+G1  X90.34 Y98.48 E18.2961
+G1  X89.29 Y98.72 E18.3232
+G1  X88.23 Y98.90 E18.3503
+G1  X87.16 Y99.04 E18.3774
+G1  X86.10 Y99.12 E18.4041
+G1  X85.03 Y99.14 E18.4312
+G1  X83.95 Y99.12 E18.4583
+G1  X82.88 Y99.04 E18.4854
+G1  X81.81 Y98.91 E18.5125
+G1  X80.75 Y98.73 E18.5395
+G1  X79.70 Y98.50 E18.5666
+G1  X78.67 Y98.21 E18.5937
+G1  X77.64 Y97.87 E18.6208
+G1  X76.64 Y97.49 E18.6479
+G1  X75.66 Y97.05 E18.6750
+G1  X74.70 Y96.57 E18.7021
+G1  X73.76 Y96.04 E18.7292
+G1  X72.85 Y95.47 E18.7562
+G1  X71.97 Y94.85 E18.7833
+G1  X71.12 Y94.19 E18.8104
+G1  X70.30 Y93.49 E18.8375
+G1  X69.52 Y92.75 E18.8646
+G1  X68.78 Y91.97 E18.8917
+G1  X68.08 Y91.16 E18.9188
+G1  X67.42 Y90.31 E18.9458
+G1  X66.79 Y89.43 E18.9730
+G1  X66.22 Y88.53 E19.0001
+G1  X65.68 Y87.58 E19.0275
+G1  X65.19 Y86.61 E19.0549
+G1  X64.76 Y85.64 E19.0817
+G1  X64.37 Y84.64 E19.1085
+G1  X64.04 Y83.63 E19.1355
+G1  X63.75 Y82.59 E19.1626
+G1  X63.51 Y81.54 E19.1897
+G1  X63.33 Y80.48 E19.2167
+G1  X63.19 Y79.41 E19.2438
+G1  X63.11 Y78.34 E19.2709
+G1  X63.08 Y77.27 E19.2980
+G1  X63.11 Y76.19 E19.3251
+G1  X63.19 Y75.12 E19.3522
+G1  X63.32 Y74.05 E19.3793
+G1  X63.50 Y72.99 E19.4064
+G1  X63.73 Y71.94 E19.4335
+G1  X64.02 Y70.89 E19.4609
+G1  X64.36 Y69.86 E19.4883
+G1  X64.74 Y68.87 E19.5150
+G1  X65.17 Y67.89 E19.5418
+G1  X65.66 Y66.92 E19.5693
+G1  X66.19 Y65.99 E19.5963
+G1  X66.76 Y65.08 E19.6234
+G1  X67.37 Y64.21 E19.6502
+G1  X68.01 Y63.40 E19.6761
+G1  X68.46 Y63.68 F4200.00
+G1  F3000.00
+G1  X69.15 Y62.89 E19.7025
+G1  X69.86 Y62.14 E19.7286
+G1  X70.62 Y61.41 E19.7550
+G1  X71.41 Y60.73 E19.7815
+G1  X72.24 Y60.08 E19.8079
+G1  X73.10 Y59.48 E19.8343
+G1  X73.98 Y58.91 E19.8607
+G1  X74.89 Y58.40 E19.8872
+G1  X75.83 Y57.92 E19.9136
+G1  X76.79 Y57.50 E19.9400
+G1  X77.77 Y57.12 E19.9664
+G1  X78.76 Y56.79 E19.9929
+G1  X79.77 Y56.51 E20.0193
+G1  X80.80 Y56.28 E20.0457
+G1  X81.83 Y56.09 E20.0721
+G1  X82.87 Y55.97 E20.0986
+G1  X83.92 Y55.88 E20.1249
+G1  X84.97 Y55.86 E20.1514
+G1  X85.96 Y55.88 E20.1765
+G1  X87.06 Y55.96 E20.2042
+G1  X88.10 Y56.09 E20.2306
+G1  X89.15 Y56.27 E20.2575
+G1  X90.16 Y56.49 E20.2836
+G1  X91.17 Y56.77 E20.3100
+G1  X92.17 Y57.10 E20.3364
+G1  X93.15 Y57.48 E20.3628
+G1  X94.11 Y57.90 E20.3892
+G1  X95.05 Y58.37 E20.4157
+G1  X95.96 Y58.89 E20.4421
+G1  X96.85 Y59.45 E20.4685
+G1  X97.70 Y60.05 E20.4949
+G1  X98.53 Y60.69 E20.5214
+G1  X99.33 Y61.38 E20.5478
+G1  X100.09 Y62.10 E20.5742
+G1  X100.81 Y62.86 E20.6007
+G1  X101.50 Y63.65 E20.6271
+G1  X102.14 Y64.48 E20.6535
+G1  X102.76 Y65.35 E20.6802
+G1  X103.32 Y66.23 E20.7066
+G1  X103.84 Y67.14 E20.7331
+G1  X104.30 Y68.07 E20.7592
+G1  X104.73 Y69.03 E20.7856
+G1  X105.11 Y70.01 E20.8120
+G1  X105.44 Y71.00 E20.8385
+G1  X105.72 Y72.01 E20.8649
+G1  X105.95 Y73.04 E20.8913
+G1  X106.13 Y74.07 E20.9178
+G1  X106.26 Y75.11 E20.9442
+G1  X106.34 Y76.16 E20.9706
+G1  X106.37 Y77.21 E20.9970
+G1  X106.34 Y78.26 E21.0235
+G1  X106.27 Y79.30 E21.0499
+G1  X106.14 Y80.34 E21.0763
+G1  X105.96 Y81.38 E21.1027
+G1  X105.73 Y82.40 E21.1292
+G1  X105.46 Y83.41 E21.1556
+G1  X105.12 Y84.42 E21.1824
+G1  X104.75 Y85.40 E21.2088
+G1  X104.33 Y86.35 E21.2349
+G1  X103.86 Y87.29 E21.2613
+G1  X103.34 Y88.20 E21.2877
+G1  X102.77 Y89.10 E21.3145
+G1  X102.17 Y89.95 E21.3409
+G1  X101.54 Y90.77 E21.3669
+G1  X100.85 Y91.57 E21.3934
+G1  X100.13 Y92.33 E21.4198
+G1  X99.37 Y93.05 E21.4463
+G1  X98.57 Y93.74 E21.4727
+G1  X97.75 Y94.39 E21.4991
+G1  X96.89 Y94.99 E21.5255
+G1  X96.01 Y95.55 E21.5520
+G1  X95.09 Y96.07 E21.5784
+G1  X94.16 Y96.54 E21.6048
+G1  X93.20 Y96.97 E21.6312
+G1  X92.22 Y97.35 E21.6577
+G1  X91.21 Y97.68 E21.6844
+G1  X90.20 Y97.96 E21.7109
+G1  X89.18 Y98.19 E21.7373
+G1  X88.14 Y98.37 E21.7637
+G1  X87.10 Y98.50 E21.7901
+G1  X86.07 Y98.58 E21.8162
+G1  X85.02 Y98.61 E21.8427
+G1  X83.97 Y98.58 E21.8691
+G1  X82.92 Y98.51 E21.8955
+G1  X81.88 Y98.38 E21.9220
+G1  X80.85 Y98.20 E21.9483
+G1  X79.83 Y97.97 E21.9748
+G1  X78.81 Y97.70 E22.0012
+G1  X77.82 Y97.37 E22.0276
+G1  X76.84 Y96.99 E22.0540
+G1  X75.88 Y96.57 E22.0805
+G1  X74.94 Y96.10 E22.1069
+G1  X74.03 Y95.58 E22.1333
+G1  X73.14 Y95.02 E22.1597
+G1  X72.28 Y94.42 E22.1862
+G1  X71.45 Y93.77 E22.2126
+G1  X70.66 Y93.09 E22.2390
+G1  X69.90 Y92.37 E22.2654
+G1  X69.17 Y91.61 E22.2919
+G1  X68.49 Y90.81 E22.3183
+G1  X67.84 Y89.99 E22.3447
+G1  X67.23 Y89.13 E22.3712
+G1  X66.67 Y88.25 E22.3976
+G1  X66.15 Y87.32 E22.4244
+G1  X65.67 Y86.37 E22.4511
+G1  X65.25 Y85.43 E22.4772
+G1  X64.88 Y84.46 E22.5033
+G1  X64.55 Y83.46 E22.5297
+G1  X64.27 Y82.45 E22.5561
+G1  X64.04 Y81.43 E22.5825
+G1  X63.85 Y80.40 E22.6090
+G1  X63.72 Y79.36 E22.6354
+G1  X63.65 Y78.31 E22.6618
+G1  X63.62 Y77.26 E22.6882
+G1  X63.64 Y76.21 E22.7147
+G1  X63.72 Y75.17 E22.7411
+G1  X63.85 Y74.12 E22.7675
+G1  X64.02 Y73.09 E22.7940
+G1  X64.25 Y72.07 E22.8204
+G1  X64.54 Y71.04 E22.8471
+G1  X64.87 Y70.04 E22.8739
+G1  X65.24 Y69.07 E22.9000
+G1  X65.66 Y68.12 E22.9261
+G1  X66.14 Y67.17 E22.9529
+G1  X66.65 Y66.26 E22.9793
+G1  X67.21 Y65.37 E23.0057
+G1  X67.81 Y64.52 E23.0318
+G1  X68.43 Y63.73 E23.0571
+G1  X68.88 Y64.02 F4200.00
+G1  F3000.00
+G1  X69.55 Y63.24 E23.0828
+G1  X70.24 Y62.51 E23.1083
+G1  X70.98 Y61.81 E23.1340
+G1  X71.76 Y61.14 E23.1598
+G1  X72.56 Y60.51 E23.1856
+G1  X73.40 Y59.92 E23.2113
+G1  X74.26 Y59.37 E23.2371
+G1  X75.15 Y58.87 E23.2628
+G1  X76.07 Y58.40 E23.2886
+G1  X77.00 Y57.99 E23.3144
+G1  X77.95 Y57.62 E23.3401
+G1  X78.93 Y57.30 E23.3659
+G1  X79.91 Y57.02 E23.3917
+G1  X80.91 Y56.80 E23.4174
+G1  X81.91 Y56.62 E23.4431
+G1  X82.93 Y56.50 E23.4689
+G1  X83.95 Y56.42 E23.4947
+G1  X84.97 Y56.40 E23.5205
+G1  X85.94 Y56.42 E23.5449
+G1  X87.02 Y56.49 E23.5720
+G1  X88.03 Y56.62 E23.5977
+G1  X89.05 Y56.79 E23.6239
+G1  X90.04 Y57.02 E23.6493
+G1  X91.02 Y57.29 E23.6751
+G1  X92.00 Y57.61 E23.7008
+G1  X92.95 Y57.97 E23.7266
+G1  X93.89 Y58.39 E23.7523
+G1  X94.80 Y58.85 E23.7781
+G1  X95.69 Y59.35 E23.8039
+G1  X96.55 Y59.90 E23.8296
+G1  X97.39 Y60.48 E23.8554
+G1  X98.20 Y61.11 E23.8812
+G1  X98.97 Y61.78 E23.9069
+G1  X99.71 Y62.48 E23.9327
+G1  X100.42 Y63.22 E23.9584
+G1  X101.09 Y64.00 E23.9842
+G1  X101.72 Y64.80 E24.0099
+G1  X102.32 Y65.65 E24.0361
+G1  X102.86 Y66.51 E24.0618
+G1  X103.37 Y67.40 E24.0876
+G1  X103.82 Y68.31 E24.1130
+G1  X104.24 Y69.24 E24.1387
+G1  X104.61 Y70.19 E24.1646
+G1  X104.93 Y71.17 E24.1903
+G1  X105.20 Y72.15 E24.2161
+G1  X105.43 Y73.15 E24.2418
+G1  X105.60 Y74.16 E24.2676
+G1  X105.73 Y75.17 E24.2934
+G1  X105.81 Y76.19 E24.3191
+G1  X105.83 Y77.21 E24.3449
+G1  X105.81 Y78.24 E24.3707
+G1  X105.73 Y79.26 E24.3964
+G1  X105.61 Y80.27 E24.4222
+G1  X105.44 Y81.28 E24.4479
+G1  X105.21 Y82.28 E24.4737
+G1  X104.94 Y83.26 E24.4995
+G1  X104.62 Y84.25 E24.5256
+G1  X104.25 Y85.20 E24.5514
+G1  X103.84 Y86.12 E24.5768
+G1  X103.38 Y87.04 E24.6025
+G1  X102.88 Y87.93 E24.6283
+G1  X102.32 Y88.80 E24.6544
+G1  X101.73 Y89.64 E24.6802
+G1  X101.12 Y90.44 E24.7055
+G1  X100.45 Y91.21 E24.7313
+G1  X99.74 Y91.95 E24.7571
+G1  X99.00 Y92.66 E24.7829
+G1  X98.23 Y93.33 E24.8086
+G1  X97.42 Y93.96 E24.8344
+G1  X96.59 Y94.55 E24.8601
+G1  X95.72 Y95.10 E24.8859
+G1  X94.83 Y95.60 E24.9117
+G1  X93.92 Y96.06 E24.9374
+G1  X92.99 Y96.48 E24.9632
+G1  X92.03 Y96.85 E24.9890
+G1  X91.05 Y97.17 E25.0151
+G1  X90.06 Y97.45 E25.0408
+G1  X89.06 Y97.67 E25.0666
+G1  X88.06 Y97.84 E25.0924
+G1  X87.04 Y97.97 E25.1181
+G1  X86.04 Y98.05 E25.1436
+G1  X85.01 Y98.07 E25.1693
+G1  X83.99 Y98.05 E25.1951
+G1  X82.97 Y97.97 E25.2209
+G1  X81.95 Y97.85 E25.2467
+G1  X80.95 Y97.68 E25.2723
+G1  X79.95 Y97.45 E25.2981
+G1  X78.96 Y97.18 E25.3239
+G1  X77.99 Y96.86 E25.3496
+G1  X77.04 Y96.49 E25.3754
+G1  X76.10 Y96.08 E25.4012
+G1  X75.19 Y95.62 E25.4269
+G1  X74.30 Y95.12 E25.4527
+G1  X73.43 Y94.57 E25.4785
+G1  X72.60 Y93.98 E25.5042
+G1  X71.79 Y93.36 E25.5300
+G1  X71.01 Y92.69 E25.5558
+G1  X70.27 Y91.98 E25.5815
+G1  X69.57 Y91.24 E25.6073
+G1  X68.90 Y90.47 E25.6331
+G1  X68.27 Y89.66 E25.6588
+G1  X67.68 Y88.83 E25.6846
+G1  X67.13 Y87.96 E25.7104
+G1  X66.62 Y87.06 E25.7364
+G1  X66.15 Y86.14 E25.7626
+G1  X65.74 Y85.21 E25.7880
+G1  X65.38 Y84.27 E25.8134
+G1  X65.06 Y83.30 E25.8392
+G1  X64.78 Y82.32 E25.8649
+G1  X64.56 Y81.32 E25.8907
+G1  X64.38 Y80.31 E25.9165
+G1  X64.26 Y79.30 E25.9422
+G1  X64.18 Y78.28 E25.9680
+G1  X64.15 Y77.25 E25.9937
+G1  X64.18 Y76.23 E26.0195
+G1  X64.25 Y75.21 E26.0453
+G1  X64.38 Y74.20 E26.0710
+G1  X64.55 Y73.19 E26.0968
+G1  X64.77 Y72.19 E26.1225
+G1  X65.05 Y71.20 E26.1483
+G1  X65.37 Y70.22 E26.1744
+G1  X65.74 Y69.26 E26.2002
+G1  X66.15 Y68.34 E26.2256
+G1  X66.61 Y67.41 E26.2518
+G1  X67.11 Y66.53 E26.2775
+G1  X67.66 Y65.66 E26.3032
+G1  X68.24 Y64.83 E26.3287
+G1  X68.84 Y64.06 E26.3533
+G1  X69.30 Y64.35 F4200.00
+G1  F3000.00
+G1  X69.95 Y63.60 E26.3784
+G1  X70.63 Y62.89 E26.4032
+G1  X71.35 Y62.20 E26.4282
+G1  X72.10 Y61.55 E26.4533
+G1  X72.89 Y60.93 E26.4785
+G1  X73.70 Y60.36 E26.5035
+G1  X74.54 Y59.83 E26.5287
+G1  X75.41 Y59.33 E26.5538
+G1  X76.30 Y58.88 E26.5789
+G1  X77.21 Y58.48 E26.6040
+G1  X78.14 Y58.12 E26.6291
+G1  X79.09 Y57.81 E26.6542
+G1  X80.05 Y57.54 E26.6793
+G1  X81.02 Y57.32 E26.7044
+G1  X82.00 Y57.15 E26.7294
+G1  X82.99 Y57.03 E26.7545
+G1  X83.98 Y56.95 E26.7796
+G1  X84.98 Y56.93 E26.8048
+G1  X85.93 Y56.95 E26.8286
+G1  X86.97 Y57.03 E26.8550
+G1  X87.96 Y57.15 E26.8800
+G1  X88.95 Y57.32 E26.9055
+G1  X89.91 Y57.54 E26.9303
+G1  X90.87 Y57.80 E26.9554
+G1  X91.82 Y58.11 E26.9805
+G1  X92.75 Y58.47 E27.0056
+G1  X93.66 Y58.87 E27.0307
+G1  X94.55 Y59.32 E27.0558
+G1  X95.42 Y59.81 E27.0809
+G1  X96.26 Y60.35 E27.1060
+G1  X97.08 Y60.92 E27.1311
+G1  X97.86 Y61.53 E27.1562
+G1  X98.62 Y62.18 E27.1813
+G1  X99.34 Y62.87 E27.2064
+G1  X100.03 Y63.59 E27.2315
+G1  X100.68 Y64.34 E27.2566
+G1  X101.29 Y65.13 E27.2816
+G1  X101.87 Y65.95 E27.3071
+G1  X102.41 Y66.79 E27.3322
+G1  X102.90 Y67.66 E27.3573
+G1  X103.34 Y68.54 E27.3821
+G1  X103.75 Y69.45 E27.4071
+G1  X104.11 Y70.38 E27.4323
+G1  X104.42 Y71.33 E27.4574
+G1  X104.68 Y72.29 E27.4825
+G1  X104.90 Y73.26 E27.5076
+G1  X105.07 Y74.24 E27.5327
+G1  X105.30 Y77.22 E27.6080
+G1  X105.27 Y78.22 E27.6331
+G1  X105.20 Y79.21 E27.6582
+G1  X105.08 Y80.20 E27.6833
+G1  X104.91 Y81.18 E27.7084
+G1  X104.69 Y82.15 E27.7335
+G1  X104.43 Y83.11 E27.7586
+G1  X104.11 Y84.07 E27.7840
+G1  X103.75 Y85.00 E27.8092
+G1  X103.35 Y85.90 E27.8339
+G1  X102.90 Y86.79 E27.8590
+G1  X102.41 Y87.66 E27.8841
+G1  X101.87 Y88.51 E27.9095
+G1  X101.30 Y89.33 E27.9347
+G1  X100.70 Y90.10 E27.9594
+G1  X100.05 Y90.86 E27.9845
+G1  X99.36 Y91.58 E28.0096
+G1  X98.64 Y92.27 E28.0347
+G1  X97.88 Y92.92 E28.0598
+G1  X97.10 Y93.53 E28.0849
+G1  X96.29 Y94.11 E28.1100
+G1  X95.44 Y94.64 E28.1351
+G1  X94.58 Y95.13 E28.1602
+G1  X93.69 Y95.58 E28.1853
+G1  X92.78 Y95.99 E28.2104
+G1  X91.85 Y96.35 E28.2355
+G1  X90.89 Y96.66 E28.2609
+G1  X89.93 Y96.93 E28.2861
+G1  X88.95 Y97.15 E28.3112
+G1  X87.97 Y97.32 E28.3363
+G1  X86.98 Y97.44 E28.3614
+G1  X86.00 Y97.51 E28.3861
+G1  X85.01 Y97.54 E28.4112
+G1  X84.01 Y97.51 E28.4363
+G1  X83.01 Y97.44 E28.4615
+G1  X82.02 Y97.32 E28.4866
+G1  X81.05 Y97.15 E28.5116
+G1  X80.07 Y96.93 E28.5367
+G1  X79.11 Y96.67 E28.5618
+G1  X78.17 Y96.36 E28.5869
+G1  X77.24 Y96.00 E28.6120
+G1  X76.32 Y95.59 E28.6371
+G1  X75.43 Y95.15 E28.6622
+G1  X74.57 Y94.65 E28.6873
+G1  X73.72 Y94.12 E28.7124
+G1  X72.91 Y93.55 E28.7375
+G1  X72.12 Y92.94 E28.7626
+G1  X71.37 Y92.29 E28.7877
+G1  X70.65 Y91.60 E28.8128
+G1  X69.96 Y90.88 E28.8379
+G1  X69.31 Y90.12 E28.8630
+G1  X68.69 Y89.34 E28.8881
+G1  X68.12 Y88.52 E28.9133
+G1  X67.58 Y87.68 E28.9384
+G1  X67.09 Y86.80 E28.9638
+G1  X66.63 Y85.90 E28.9892
+G1  X66.23 Y85.00 E29.0140
+G1  X65.88 Y84.09 E29.0388
+G1  X65.57 Y83.14 E29.0639
+G1  X65.30 Y82.18 E29.0890
+G1  X65.08 Y81.21 E29.1141
+G1  X64.91 Y80.23 E29.1392
+G1  X64.79 Y79.24 E29.1643
+G1  X64.72 Y78.24 E29.1894
+G1  X64.69 Y77.25 E29.2145
+G1  X64.71 Y76.25 E29.2396
+G1  X64.79 Y75.26 E29.2647
+G1  X64.91 Y74.27 E29.2898
+G1  X65.08 Y73.29 E29.3149
+G1  X65.30 Y72.31 E29.3400
+G1  X65.56 Y71.35 E29.3651
+G1  X65.88 Y70.39 E29.3905
+G1  X66.23 Y69.46 E29.4156
+G1  X66.63 Y68.56 E29.4404
+G1  X67.09 Y67.66 E29.4659
+G1  X67.58 Y66.79 E29.4909
+G1  X68.11 Y65.95 E29.5160
+G1  X68.68 Y65.15 E29.5408
+G1  X69.26 Y64.40 E29.5647
+G1  X69.72 Y64.69 F4200.00
+G1  F3000.00
+G1  X70.35 Y63.95 E29.5892
+G1  X71.01 Y63.26 E29.6133
+G1  X71.71 Y62.59 E29.6377
+G1  X72.45 Y61.96 E29.6622
+G1  X73.21 Y61.36 E29.6866
+G1  X74.01 Y60.80 E29.7110
+G1  X74.83 Y60.28 E29.7355
+G1  X75.67 Y59.80 E29.7599
+G1  X76.54 Y59.37 E29.7843
+G1  X77.42 Y58.97 E29.8088
+G1  X78.33 Y58.62 E29.8332
+G1  X79.25 Y58.32 E29.8577
+G1  X80.18 Y58.06 E29.8821
+G1  X81.13 Y57.85 E29.9065
+G1  X82.08 Y57.68 E29.9309
+G1  X83.05 Y57.56 E29.9554
+G1  X84.02 Y57.49 E29.9798
+G1  X84.99 Y57.47 E30.0043
+G1  X85.91 Y57.49 E30.0275
+G1  X86.93 Y57.56 E30.0532
+G1  X87.89 Y57.68 E30.0776
+G1  X88.86 Y57.85 E30.1024
+G1  X89.79 Y58.06 E30.1265
+G1  X90.73 Y58.31 E30.1509
+G1  X91.65 Y58.62 E30.1754
+G1  X92.55 Y58.97 E30.1998
+G1  X93.44 Y59.36 E30.2243
+G1  X94.31 Y59.80 E30.2487
+G1  X95.15 Y60.28 E30.2731
+G1  X95.97 Y60.79 E30.2976
+G1  X96.76 Y61.35 E30.3220
+G1  X97.53 Y61.95 E30.3465
+G1  X98.26 Y62.58 E30.3709
+G1  X98.97 Y63.25 E30.3953
+G1  X99.64 Y63.95 E30.4198
+G1  X100.27 Y64.69 E30.4442
+G1  X100.87 Y65.45 E30.4686
+G1  X101.43 Y66.26 E30.4934
+G1  X101.95 Y67.08 E30.5178
+G1  X102.43 Y67.92 E30.5422
+G1  X102.86 Y68.78 E30.5664
+G1  X103.25 Y69.66 E30.5908
+G1  X103.60 Y70.57 E30.6153
+G1  X103.91 Y71.49 E30.6397
+G1  X104.17 Y72.42 E30.6641
+G1  X104.38 Y73.37 E30.6886
+G1  X104.55 Y74.33 E30.7130
+G1  X104.67 Y75.29 E30.7375
+G1  X104.74 Y76.26 E30.7619
+G1  X104.76 Y77.23 E30.7863
+G1  X104.74 Y78.20 E30.8108
+G1  X104.67 Y79.16 E30.8352
+G1  X104.55 Y80.13 E30.8597
+G1  X104.38 Y81.08 E30.8841
+G1  X104.17 Y82.03 E30.9085
+G1  X103.91 Y82.97 E30.9330
+G1  X103.60 Y83.90 E30.9577
+G1  X103.25 Y84.80 E30.9822
+G1  X102.86 Y85.68 E31.0063
+G1  X102.43 Y86.55 E31.0307
+G1  X101.95 Y87.39 E31.0552
+G1  X101.43 Y88.22 E31.0799
+G1  X100.87 Y89.01 E31.1044
+G1  X100.28 Y89.77 E31.1285
+G1  X99.64 Y90.50 E31.1529
+G1  X98.98 Y91.21 E31.1774
+G1  X98.27 Y91.88 E31.2018
+G1  X97.54 Y92.51 E31.2262
+G1  X96.77 Y93.11 E31.2507
+G1  X95.98 Y93.67 E31.2751
+G1  X95.16 Y94.19 E31.2995
+G1  X94.32 Y94.66 E31.3240
+G1  X93.45 Y95.10 E31.3484
+G1  X92.56 Y95.49 E31.3729
+G1  X91.66 Y95.84 E31.3973
+G1  X90.73 Y96.15 E31.4221
+G1  X89.79 Y96.41 E31.4465
+G1  X88.84 Y96.62 E31.4709
+G1  X87.89 Y96.79 E31.4954
+G1  X86.92 Y96.91 E31.5198
+G1  X85.97 Y96.98 E31.5439
+G1  X85.00 Y97.00 E31.5684
+G1  X84.03 Y96.98 E31.5928
+G1  X83.06 Y96.91 E31.6173
+G1  X82.10 Y96.79 E31.6418
+G1  X81.14 Y96.62 E31.6661
+G1  X80.20 Y96.41 E31.6906
+G1  X79.26 Y96.15 E31.7150
+G1  X78.34 Y95.85 E31.7395
+G1  X77.43 Y95.50 E31.7639
+G1  X76.55 Y95.11 E31.7883
+G1  X75.68 Y94.67 E31.8128
+G1  X74.84 Y94.19 E31.8372
+G1  X74.02 Y93.67 E31.8616
+G1  X73.22 Y93.11 E31.8861
+G1  X72.46 Y92.52 E31.9105
+G1  X71.72 Y91.88 E31.9350
+G1  X71.02 Y91.22 E31.9594
+G1  X70.35 Y90.51 E31.9838
+G1  X69.72 Y89.78 E32.0083
+G1  X69.12 Y89.01 E32.0327
+G1  X68.56 Y88.22 E32.0572
+G1  X68.04 Y87.40 E32.0816
+G1  X67.56 Y86.55 E32.1064
+G1  X67.12 Y85.68 E32.1308
+G1  X66.73 Y84.80 E32.1549
+G1  X66.38 Y83.90 E32.1794
+G1  X66.08 Y82.98 E32.2038
+G1  X65.82 Y82.04 E32.2282
+G1  X65.61 Y81.10 E32.2527
+G1  X65.44 Y80.14 E32.2771
+G1  X65.32 Y79.18 E32.3016
+G1  X65.25 Y78.21 E32.3260
+G1  X65.23 Y77.24 E32.3504
+G1  X65.25 Y76.27 E32.3749
+G1  X65.32 Y75.30 E32.3993
+G1  X65.44 Y74.34 E32.4237
+G1  X65.61 Y73.38 E32.4482
+G1  X65.82 Y72.44 E32.4726
+G1  X66.07 Y71.50 E32.4971
+G1  X66.38 Y70.58 E32.5215
+G1  X66.73 Y69.66 E32.5463
+G1  X67.12 Y68.79 E32.5704
+G1  X67.56 Y67.91 E32.5952
+G1  X68.04 Y67.06 E32.6196
+G1  X68.56 Y66.25 E32.6440
+G1  X69.11 Y65.46 E32.6682
+G1  X69.68 Y64.74 E32.6914
+G1  E31.1914 F1080.00
+G92  E0.0000
+G1  X96.18 Y86.94 F4200.00
+G1  E1.5000 F1080.00
+G1  F3000.00
+G1  X96.18 Y87.12 E1.5045
+G1  X96.27 Y87.42 E1.5124
+G1  X96.39 Y87.59 E1.5176
+G1  X96.51 Y87.70 E1.5218
+G1  X99.54 Y89.44 E1.6098
+G1  X99.07 Y89.99 E1.6280
+G1  X98.43 Y90.67 E1.6515
+G1  X97.75 Y91.31 E1.6749
+G1  X97.05 Y91.92 E1.6984
+G1  X96.31 Y92.50 E1.7219
+G1  X95.55 Y93.03 E1.7454
+G1  X94.76 Y93.53 E1.7689
+G1  X93.95 Y93.99 E1.7924
+G1  X93.12 Y94.41 E1.8159
+G1  X92.26 Y94.79 E1.8394
+G1  X91.39 Y95.12 E1.8629
+G1  X90.51 Y95.42 E1.8864
+G1  X89.61 Y95.66 E1.9098
+G1  X88.70 Y95.87 E1.9333
+G1  X88.29 Y95.94 E1.9437
+G1  X88.29 Y92.44 E2.0318
+G1  X88.27 Y92.28 E2.0360
+G1  X88.18 Y92.09 E2.0412
+G1  X87.96 Y91.87 E2.0490
+G1  X87.81 Y91.77 E2.0536
+G1  X87.62 Y91.72 E2.0585
+G1  X87.45 Y91.72 E2.0627
+G1  X86.91 Y91.81 E2.0765
+G1  X85.95 Y91.90 E2.1008
+G1  X84.99 Y91.93 E2.1250
+G1  X84.03 Y91.90 E2.1492
+G1  X83.07 Y91.81 E2.1735
+G1  X82.53 Y91.72 E2.1873
+G1  X82.36 Y91.72 E2.1915
+G1  X82.16 Y91.78 E2.1968
+G1  X81.91 Y91.96 E2.2047
+G1  X81.80 Y92.10 E2.2092
+G1  X81.72 Y92.28 E2.2140
+G1  X81.69 Y92.44 E2.2182
+G1  X81.69 Y95.94 E2.3063
+G1  X81.29 Y95.87 E2.3167
+G1  X80.38 Y95.66 E2.3401
+G1  X79.48 Y95.42 E2.3636
+G1  X78.59 Y95.12 E2.3871
+G1  X77.72 Y94.79 E2.4106
+G1  X76.87 Y94.41 E2.4341
+G1  X76.04 Y93.99 E2.4576
+G1  X75.23 Y93.53 E2.4811
+G1  X74.44 Y93.03 E2.5046
+G1  X73.68 Y92.50 E2.5281
+G1  X72.94 Y91.92 E2.5515
+G1  X72.23 Y91.31 E2.5750
+G1  X71.56 Y90.67 E2.5985
+G1  X70.92 Y89.99 E2.6220
+G1  X70.45 Y89.44 E2.6402
+G1  X73.47 Y87.70 E2.7283
+G1  X73.60 Y87.59 E2.7324
+G1  X73.72 Y87.42 E2.7376
+G1  X73.81 Y87.12 E2.7455
+G1  X73.81 Y86.94 E2.7500
+G1  X73.76 Y86.75 E2.7549
+G1  X73.68 Y86.61 E2.7591
+G1  X73.33 Y86.18 E2.7730
+G1  X72.77 Y85.40 E2.7972
+G1  X72.26 Y84.58 E2.8214
+G1  X71.81 Y83.73 E2.8457
+G1  X71.41 Y82.86 E2.8699
+G1  X71.22 Y82.34 E2.8837
+G1  X71.13 Y82.20 E2.8880
+G1  X70.99 Y82.06 E2.8928
+G1  X70.84 Y81.98 E2.8974
+G1  X70.53 Y81.90 E2.9053
+G1  X70.33 Y81.92 E2.9104
+G1  X70.17 Y81.98 E2.9146
+G1  X67.14 Y83.73 E3.0029
+G1  X66.81 Y82.75 E3.0290
+G1  X66.56 Y81.85 E3.0525
+G1  X66.36 Y80.94 E3.0760
+G1  X66.20 Y80.02 E3.0995
+G1  X66.08 Y79.10 E3.1230
+G1  X66.02 Y78.17 E3.1465
+G1  X65.99 Y77.23 E3.1700
+G1  X66.02 Y76.30 E3.1934
+G1  X66.08 Y75.37 E3.2169
+G1  X66.20 Y74.45 E3.2404
+G1  X66.36 Y73.53 E3.2639
+G1  X66.56 Y72.62 E3.2874
+G1  X66.81 Y71.72 E3.3109
+G1  X67.14 Y70.73 E3.3370
+G1  X70.17 Y72.49 E3.4253
+G1  X70.33 Y72.55 E3.4295
+G1  X70.52 Y72.56 E3.4343
+G1  X70.70 Y72.54 E3.4388
+G1  X70.98 Y72.41 E3.4467
+G1  X71.13 Y72.27 E3.4519
+G1  X71.22 Y72.12 E3.4562
+G1  X71.41 Y71.61 E3.4700
+G1  X71.81 Y70.73 E3.4943
+G1  X72.26 Y69.88 E3.5185
+G1  X72.77 Y69.07 E3.5427
+G1  X73.33 Y68.29 E3.5669
+G1  X73.68 Y67.86 E3.5808
+G1  X73.76 Y67.71 E3.5850
+G1  X73.81 Y67.53 E3.5899
+G1  X73.81 Y67.34 E3.5945
+G1  X73.72 Y67.04 E3.6023
+G1  X73.60 Y66.88 E3.6075
+G1  X73.47 Y66.77 E3.6117
+G1  X70.45 Y65.02 E3.6997
+G1  X70.92 Y64.47 E3.7179
+G1  X71.56 Y63.80 E3.7414
+G1  X72.23 Y63.16 E3.7649
+G1  X72.94 Y62.55 E3.7884
+G1  X73.68 Y61.97 E3.8119
+G1  X74.44 Y61.44 E3.8353
+G1  X75.23 Y60.94 E3.8588
+G1  X76.04 Y60.48 E3.8823
+G1  X76.87 Y60.06 E3.9058
+G1  X77.72 Y59.68 E3.9293
+G1  X78.59 Y59.35 E3.9528
+G1  X79.48 Y59.05 E3.9763
+G1  X80.38 Y58.80 E3.9998
+G1  X81.29 Y58.60 E4.0233
+G1  X81.69 Y58.53 E4.0336
+G1  X81.69 Y62.03 E4.1217
+G1  X81.72 Y62.19 E4.1259
+G1  X81.81 Y62.38 E4.1311
+G1  X82.02 Y62.60 E4.1390
+G1  X82.18 Y62.69 E4.1435
+G1  X82.36 Y62.75 E4.1484
+G1  X82.53 Y62.75 E4.1526
+G1  X83.07 Y62.66 E4.1665
+G1  X84.03 Y62.57 E4.1907
+G1  X84.99 Y62.53 E4.2149
+G1  X85.95 Y62.57 E4.2392
+G1  X86.91 Y62.66 E4.2634
+G1  X87.45 Y62.75 E4.2772
+G1  X87.62 Y62.75 E4.2815
+G1  X87.82 Y62.69 E4.2867
+G1  X88.07 Y62.50 E4.2946
+G1  X88.19 Y62.36 E4.2991
+G1  X88.27 Y62.19 E4.3039
+G1  X88.29 Y62.03 E4.3081
+G1  X88.29 Y58.53 E4.3962
+G1  X88.70 Y58.60 E4.4066
+G1  X89.61 Y58.80 E4.4301
+G1  X90.51 Y59.05 E4.4536
+G1  X91.39 Y59.35 E4.4771
+G1  X92.26 Y59.68 E4.5006
+G1  X93.12 Y60.06 E4.5241
+G1  X93.95 Y60.48 E4.5475
+G1  X94.76 Y60.94 E4.5710
+G1  X95.55 Y61.44 E4.5945
+G1  X96.31 Y61.97 E4.6180
+G1  X97.05 Y62.55 E4.6415
+G1  X97.75 Y63.16 E4.6650
+G1  X98.43 Y63.80 E4.6885
+G1  X99.07 Y64.47 E4.7119
+G1  X99.54 Y65.02 E4.7302
+G1  X96.51 Y66.77 E4.8182
+G1  X96.39 Y66.88 E4.8224
+G1  X96.27 Y67.04 E4.8276
+G1  X96.18 Y67.34 E4.8354
+G1  X96.18 Y67.53 E4.8400
+G1  X96.22 Y67.71 E4.8448
+G1  X96.31 Y67.86 E4.8491
+G1  X96.66 Y68.29 E4.8629
+G1  X97.22 Y69.07 E4.8871
+G1  X97.72 Y69.88 E4.9114
+G1  X98.18 Y70.73 E4.9356
+G1  X98.57 Y71.61 E4.9598
+G1  X98.77 Y72.12 E4.9737
+G1  X98.85 Y72.27 E4.9779
+G1  X98.99 Y72.40 E4.9828
+G1  X99.15 Y72.49 E4.9873
+G1  X99.45 Y72.57 E4.9952
+G1  X99.66 Y72.54 E5.0004
+G1  X99.81 Y72.49 E5.0046
+G1  X102.85 Y70.73 E5.0929
+G1  X103.18 Y71.72 E5.1190
+G1  X103.42 Y72.62 E5.1424
+G1  X103.63 Y73.53 E5.1659
+G1  X103.79 Y74.45 E5.1894
+G1  X103.90 Y75.37 E5.2129
+G1  X103.97 Y76.30 E5.2364
+G1  X103.99 Y77.23 E5.2599
+G1  X103.97 Y78.17 E5.2834
+G1  X103.90 Y79.10 E5.3069
+G1  X103.79 Y80.02 E5.3304
+G1  X103.63 Y80.94 E5.3538
+G1  X103.42 Y81.85 E5.3773
+G1  X103.18 Y82.75 E5.4008
+G1  X102.85 Y83.73 E5.4269
+G1  X99.81 Y81.98 E5.5152
+G1  X99.66 Y81.92 E5.5194
+G1  X99.47 Y81.90 E5.5243
+G1  X99.29 Y81.93 E5.5288
+G1  X99.00 Y82.05 E5.5366
+G1  X98.85 Y82.20 E5.5419
+G1  X98.77 Y82.34 E5.5461
+G1  X98.57 Y82.86 E5.5600
+G1  X98.18 Y83.73 E5.5842
+G1  X97.72 Y84.58 E5.6084
+G1  X97.22 Y85.40 E5.6326
+G1  X96.66 Y86.18 E5.6569
+G1  X96.31 Y86.61 E5.6707
+G1  X96.22 Y86.75 E5.6750
+G1  X96.19 Y86.88 E5.6783
+G1  X96.01 Y87.01 F4200.00
+G1  E4.1783 F1080.00
+G92  E0.0000
+G1  X71.61 Y81.79 F4200.00
+G1  E1.5000 F1080.00
+G1  F3000.00
+G1  X71.03 Y81.48 E1.5166
+G1  X70.57 Y81.36 E1.5286
+G1  X70.21 Y81.40 E1.5378
+G1  X69.94 Y81.49 E1.5449
+G1  X67.44 Y82.94 E1.6178
+G1  X67.32 Y82.59 E1.6270
+G1  X67.08 Y81.72 E1.6498
+G1  X66.88 Y80.84 E1.6726
+G1  X66.73 Y79.94 E1.6955
+G1  X66.62 Y79.04 E1.7183
+G1  X66.55 Y78.14 E1.7411
+G1  X66.53 Y77.23 E1.7639
+G1  X66.55 Y76.33 E1.7868
+G1  X66.62 Y75.42 E1.8096
+G1  X66.73 Y74.52 E1.8324
+G1  X66.88 Y73.63 E1.8552
+G1  X67.08 Y72.75 E1.8781
+G1  X67.32 Y71.87 E1.9009
+G1  X67.44 Y71.53 E1.9101
+G1  X69.94 Y72.97 E1.9830
+G1  X70.21 Y73.07 E1.9900
+G1  X70.54 Y73.10 E1.9983
+G1  X70.85 Y73.05 E2.0062
+G1  X71.59 Y72.73 E2.0268
+G1  X71.34 Y73.57 E2.0490
+G1  X71.13 Y74.48 E2.0723
+G1  X70.98 Y75.39 E2.0956
+G1  X70.89 Y76.31 E2.1189
+G1  X70.86 Y77.23 E2.1422
+G1  X70.89 Y78.16 E2.1655
+G1  X70.98 Y79.08 E2.1888
+G1  X71.13 Y79.99 E2.2121
+G1  X71.34 Y80.89 E2.2354
+G1  X71.59 Y81.74 E2.2576
+G1  E0.7576 F1080.00
+G92  E0.0000
+G1  X70.77 Y80.80 F4200.00
+G1  E1.5000 F1080.00
+G1  F3000.00
+G1  X70.09 Y80.87 E1.5172
+G1  X69.72 Y81.01 E1.5272
+G1  X67.75 Y82.14 E1.5842
+G1  X67.60 Y81.59 E1.5986
+G1  X67.41 Y80.73 E1.6208
+G1  X67.26 Y79.86 E1.6429
+G1  X67.15 Y78.99 E1.6651
+G1  X67.09 Y78.11 E1.6873
+G1  X67.06 Y77.23 E1.7094
+G1  X67.09 Y76.35 E1.7316
+G1  X67.15 Y75.48 E1.7538
+G1  X67.26 Y74.60 E1.7759
+G1  X67.41 Y73.74 E1.7981
+G1  X67.60 Y72.88 E1.8203
+G1  X67.75 Y72.33 E1.8346
+G1  X69.72 Y73.46 E1.8917
+G1  X70.09 Y73.60 E1.9016
+G1  X70.55 Y73.64 E1.9134
+G1  X70.78 Y73.61 E1.9192
+G1  X70.60 Y74.37 E1.9390
+G1  X70.45 Y75.32 E1.9632
+G1  X70.35 Y76.27 E1.9874
+G1  X70.32 Y77.23 E2.0116
+G1  X70.35 Y78.19 E2.0357
+G1  X70.45 Y79.15 E2.0599
+G1  X70.60 Y80.10 E2.0841
+G1  X70.75 Y80.74 E2.1009
+G1  E0.6009 F1080.00
+G92  E0.0000
+G1  X74.35 Y86.54 F4200.00
+G1  E1.5000 F1080.00
+G1  F3000.00
+G1  X75.00 Y87.23 E1.5237
+G1  X75.67 Y87.86 E1.5470
+G1  X76.39 Y88.45 E1.5703
+G1  X77.14 Y88.99 E1.5936
+G1  X77.93 Y89.48 E1.6169
+G1  X78.74 Y89.91 E1.6402
+G1  X79.58 Y90.29 E1.6635
+G1  X80.45 Y90.62 E1.6868
+G1  X81.33 Y90.89 E1.7101
+G1  X82.19 Y91.09 E1.7323
+G1  X81.54 Y91.57 E1.7529
+G1  X81.34 Y91.82 E1.7608
+G1  X81.20 Y92.12 E1.7691
+G1  X81.16 Y92.40 E1.7761
+G1  X81.16 Y95.29 E1.8490
+G1  X80.51 Y95.14 E1.8658
+G1  X79.63 Y94.90 E1.8887
+G1  X78.77 Y94.62 E1.9115
+G1  X77.93 Y94.29 E1.9343
+G1  X77.10 Y93.93 E1.9571
+G1  X76.29 Y93.52 E1.9800
+G1  X75.50 Y93.07 E2.0028
+G1  X74.74 Y92.59 E2.0256
+G1  X74.00 Y92.06 E2.0485
+G1  X73.28 Y91.51 E2.0713
+G1  X72.59 Y90.91 E2.0941
+G1  X71.94 Y90.29 E2.1169
+G1  X71.27 Y89.59 E2.1414
+G1  X73.78 Y88.14 E2.2144
+G1  X74.00 Y87.96 E2.2215
+G1  X74.21 Y87.66 E2.2308
+G1  X74.34 Y87.20 E2.2427
+G1  X74.35 Y86.60 E2.2578
+G1  E0.7578 F1080.00
+G92  E0.0000
+G1  X74.79 Y87.77 F4200.00
+G1  E1.5000 F1080.00
+G1  F3000.00
+G1  X75.32 Y88.26 E1.5183
+G1  X76.06 Y88.87 E1.5424
+G1  X76.84 Y89.43 E1.5666
+G1  X77.66 Y89.94 E1.5908
+G1  X78.50 Y90.39 E1.6150
+G1  X79.38 Y90.79 E1.6392
+G1  X80.28 Y91.13 E1.6634
+G1  X81.03 Y91.36 E1.6831
+G1  X80.88 Y91.54 E1.6890
+G1  X80.69 Y91.96 E1.7008
+G1  X80.62 Y92.35 E1.7107
+G1  X80.62 Y94.62 E1.7679
+G1  X79.79 Y94.39 E1.7896
+G1  X78.95 Y94.11 E1.8118
+G1  X78.13 Y93.80 E1.8340
+G1  X77.33 Y93.44 E1.8562
+G1  X76.54 Y93.04 E1.8783
+G1  X75.78 Y92.61 E1.9005
+G1  X75.03 Y92.14 E1.9226
+G1  X74.31 Y91.63 E1.9448
+G1  X73.62 Y91.09 E1.9670
+G1  X72.95 Y90.52 E1.9891
+G1  X72.13 Y89.71 E2.0183
+G1  X74.09 Y88.58 E2.0753
+G1  X74.39 Y88.33 E2.0853
+G1  X74.76 Y87.82 E2.1010
+G1  E0.6010 F1080.00
+G92  E0.0000
+G1  X87.73 Y91.10 F4200.00
+G1  E1.5000 F1080.00
+G1  F3000.00
+G1  X88.65 Y90.89 E1.5237
+G1  X89.54 Y90.62 E1.5470
+G1  X90.40 Y90.29 E1.5703
+G1  X91.25 Y89.91 E1.5936
+G1  X92.06 Y89.48 E1.6169
+G1  X92.85 Y88.99 E1.6402
+G1  X93.60 Y88.45 E1.6635
+G1  X94.31 Y87.86 E1.6868
+G1  X94.99 Y87.23 E1.7101
+G1  X95.63 Y86.54 E1.7338
+G1  X95.65 Y87.20 E1.7505
+G1  X95.78 Y87.66 E1.7624
+G1  X95.99 Y87.96 E1.7717
+G1  X96.21 Y88.14 E1.7788
+G1  X98.72 Y89.59 E1.8518
+G1  X98.05 Y90.29 E1.8763
+G1  X97.39 Y90.91 E1.8991
+G1  X96.71 Y91.51 E1.9219
+G1  X95.99 Y92.06 E1.9447
+G1  X95.25 Y92.59 E1.9676
+G1  X94.49 Y93.07 E1.9904
+G1  X93.70 Y93.52 E2.0132
+G1  X92.89 Y93.93 E2.0361
+G1  X92.06 Y94.29 E2.0589
+G1  X91.21 Y94.62 E2.0817
+G1  X90.35 Y94.90 E2.1045
+G1  X89.48 Y95.14 E2.1274
+G1  X88.83 Y95.29 E2.1442
+G1  X88.83 Y92.40 E2.2171
+G1  X88.78 Y92.12 E2.2241
+G1  X88.63 Y91.78 E2.2334
+G1  X88.30 Y91.44 E2.2453
+G1  X87.79 Y91.13 E2.2605
+G1  E0.7605 F1080.00
+G92  E0.0000
+G1  X89.02 Y91.34 F4200.00
+G1  E1.5000 F1080.00
+G1  F3000.00
+G1  X89.71 Y91.13 E1.5183
+G1  X90.61 Y90.79 E1.5424
+G1  X91.48 Y90.39 E1.5666
+G1  X92.33 Y89.94 E1.5908
+G1  X93.14 Y89.43 E1.6150
+G1  X93.93 Y88.87 E1.6392
+G1  X94.67 Y88.26 E1.6634
+G1  X95.20 Y87.77 E1.6816
+G1  X95.60 Y88.33 E1.6989
+G1  X95.90 Y88.58 E1.7088
+G1  X97.86 Y89.71 E1.7659
+G1  X97.03 Y90.52 E1.7950
+G1  X96.37 Y91.09 E1.8172
+G1  X95.67 Y91.63 E1.8393
+G1  X94.95 Y92.14 E1.8615
+G1  X94.21 Y92.61 E1.8837
+G1  X93.44 Y93.04 E1.9058
+G1  X92.66 Y93.44 E1.9280
+G1  X91.86 Y93.80 E1.9502
+G1  X91.03 Y94.11 E1.9723
+G1  X90.20 Y94.39 E1.9945
+G1  X89.36 Y94.62 E2.0163
+G1  X89.36 Y92.35 E2.0735
+G1  X89.30 Y91.96 E2.0834
+G1  X89.04 Y91.39 E2.0991
+G1  E0.5991 F1080.00
+G92  E0.0000
+G1  X98.39 Y81.74 F4200.00
+G1  E1.5000 F1080.00
+G1  F3000.00
+G1  X98.65 Y80.89 E1.5222
+G1  X98.86 Y79.99 E1.5455
+G1  X99.01 Y79.08 E1.5688
+G1  X99.10 Y78.16 E1.5921
+G1  X99.13 Y77.23 E1.6154
+G1  X99.10 Y76.31 E1.6387
+G1  X99.01 Y75.39 E1.6620
+G1  X98.86 Y74.48 E1.6853
+G1  X98.65 Y73.57 E1.7086
+G1  X98.37 Y72.67 E1.7323
+G1  X98.95 Y72.99 E1.7489
+G1  X99.41 Y73.11 E1.7609
+G1  X99.78 Y73.07 E1.7702
+G1  X100.04 Y72.97 E1.7772
+G1  X102.55 Y71.53 E1.8501
+G1  X102.66 Y71.87 E1.8593
+G1  X102.90 Y72.75 E1.8821
+G1  X103.10 Y73.63 E1.9049
+G1  X103.26 Y74.52 E1.9278
+G1  X103.37 Y75.42 E1.9506
+G1  X103.44 Y76.33 E1.9734
+G1  X103.44 Y78.14 E2.0191
+G1  X103.37 Y79.04 E2.0419
+G1  X103.26 Y79.94 E2.0647
+G1  X103.10 Y80.84 E2.0876
+G1  X102.90 Y81.72 E2.1104
+G1  X102.66 Y82.59 E2.1332
+G1  X102.55 Y82.94 E2.1424
+G1  X100.04 Y81.49 E2.2153
+G1  X99.78 Y81.40 E2.2223
+G1  X99.45 Y81.36 E2.2306
+G1  X99.14 Y81.41 E2.2386
+G1  X98.45 Y81.71 E2.2576
+G1  E0.7576 F1080.00
+G92  E0.0000
+G1  X99.21 Y80.86 F4200.00
+G1  E1.5000 F1080.00
+G1  F3000.00
+G1  X99.38 Y80.10 E1.5198
+G1  X99.54 Y79.15 E1.5439
+G1  X99.63 Y78.19 E1.5681
+G1  X99.67 Y77.23 E1.5923
+G1  X99.63 Y76.27 E1.6165
+G1  X99.54 Y75.32 E1.6407
+G1  X99.38 Y74.37 E1.6649
+G1  X99.22 Y73.66 E1.6831
+G1  X99.90 Y73.60 E1.7004
+G1  X100.27 Y73.46 E1.7103
+G1  X102.23 Y72.33 E1.7674
+G1  X102.38 Y72.88 E1.7817
+G1  X102.58 Y73.74 E1.8039
+G1  X102.73 Y74.60 E1.8261
+G1  X102.84 Y75.48 E1.8482
+G1  X102.90 Y76.35 E1.8704
+G1  X102.92 Y77.23 E1.8925
+G1  X102.90 Y78.11 E1.9147
+G1  X102.84 Y78.99 E1.9369
+G1  X102.73 Y79.86 E1.9590
+G1  X102.58 Y80.73 E1.9812
+G1  X102.38 Y81.59 E2.0034
+G1  X102.23 Y82.14 E2.0177
+G1  X100.27 Y81.01 E2.0748
+G1  X99.90 Y80.87 E2.0847
+G1  X99.44 Y80.82 E2.0965
+G1  X99.26 Y80.85 E2.1009
+G1  E0.6009 F1080.00
+G92  E0.0000
+G1  X95.63 Y67.93 F4200.00
+G1  E1.5000 F1080.00
+G1  F3000.00
+G1  X94.99 Y67.24 E1.5237
+G1  X94.31 Y66.61 E1.5470
+G1  X93.60 Y66.02 E1.5703
+G1  X92.85 Y65.48 E1.5936
+G1  X92.06 Y64.99 E1.6169
+G1  X91.25 Y64.56 E1.6402
+G1  X90.40 Y64.17 E1.6635
+G1  X89.54 Y63.85 E1.6868
+G1  X88.65 Y63.58 E1.7101
+G1  X87.79 Y63.38 E1.7323
+G1  X88.45 Y62.89 E1.7529
+G1  X88.65 Y62.65 E1.7608
+G1  X88.78 Y62.35 E1.7691
+G1  X88.83 Y62.07 E1.7761
+G1  X88.83 Y59.18 E1.8490
+G1  X89.48 Y59.32 E1.8658
+G1  X90.35 Y59.56 E1.8887
+G1  X91.21 Y59.85 E1.9115
+G1  X92.06 Y60.18 E1.9343
+G1  X92.89 Y60.54 E1.9571
+G1  X93.70 Y60.95 E1.9800
+G1  X94.49 Y61.40 E2.0028
+G1  X95.25 Y61.88 E2.0256
+G1  X95.99 Y62.40 E2.0485
+G1  X96.71 Y62.96 E2.0713
+G1  X97.39 Y63.55 E2.0941
+G1  X98.05 Y64.18 E2.1169
+G1  X98.72 Y64.88 E2.1414
+G1  X96.21 Y66.33 E2.2144
+G1  X95.99 Y66.51 E2.2215
+G1  X95.78 Y66.81 E2.2308
+G1  X95.65 Y67.26 E2.2427
+G1  X95.63 Y67.87 E2.2578
+G1  E0.7578 F1080.00
+G92  E0.0000
+G1  X95.20 Y66.70 F4200.00
+G1  E1.5000 F1080.00
+G1  F3000.00
+G1  X94.67 Y66.20 E1.5183
+G1  X93.93 Y65.59 E1.5424
+G1  X93.14 Y65.03 E1.5666
+G1  X92.33 Y64.53 E1.5908
+G1  X91.48 Y64.07 E1.6150
+G1  X90.61 Y63.68 E1.6392
+G1  X89.71 Y63.34 E1.6634
+G1  X88.96 Y63.11 E1.6831
+G1  X89.11 Y62.93 E1.6890
+G1  X89.30 Y62.51 E1.7008
+G1  X89.36 Y62.12 E1.7107
+G1  X89.36 Y59.85 E1.7679
+G1  X90.20 Y60.08 E1.7896
+G1  X91.03 Y60.35 E1.8118
+G1  X91.86 Y60.67 E1.8340
+G1  X92.66 Y61.03 E1.8562
+G1  X93.44 Y61.42 E1.8783
+G1  X94.21 Y61.86 E1.9005
+G1  X94.95 Y62.33 E1.9226
+G1  X95.67 Y62.83 E1.9448
+G1  X96.37 Y63.38 E1.9670
+G1  X97.03 Y63.95 E1.9891
+G1  X97.86 Y64.76 E2.0183
+G1  X95.90 Y65.89 E2.0753
+G1  X95.60 Y66.14 E2.0853
+G1  X95.23 Y66.65 E2.1010
+G1  E0.6010 F1080.00
+G92  E0.0000
+G1  X82.25 Y63.37 F4200.00
+G1  E1.5000 F1080.00
+G1  F3000.00
+G1  X81.33 Y63.58 E1.5237
+G1  X80.45 Y63.85 E1.5470
+G1  X79.58 Y64.18 E1.5705
+G1  X78.54 Y64.66 E1.5993
+G1  X77.93 Y64.99 E1.6169
+G1  X77.14 Y65.48 E1.6402
+G1  X76.39 Y66.02 E1.6635
+G1  X75.67 Y66.61 E1.6868
+G1  X75.00 Y67.24 E1.7101
+G1  X74.35 Y67.93 E1.7338
+G1  X74.34 Y67.26 E1.7505
+G1  X74.21 Y66.81 E1.7624
+G1  X74.00 Y66.51 E1.7717
+G1  X73.78 Y66.33 E1.7787
+G1  X71.27 Y64.88 E1.8518
+G1  X71.94 Y64.18 E1.8763
+G1  X72.59 Y63.55 E1.8991
+G1  X73.28 Y62.96 E1.9219
+G1  X74.00 Y62.40 E1.9447
+G1  X74.74 Y61.88 E1.9676
+G1  X75.50 Y61.40 E1.9904
+G1  X76.29 Y60.95 E2.0132
+G1  X77.10 Y60.54 E2.0360
+G1  X77.93 Y60.18 E2.0589
+G1  X78.77 Y59.85 E2.0817
+G1  X79.63 Y59.56 E2.1045
+G1  X80.51 Y59.32 E2.1274
+G1  X81.16 Y59.18 E2.1442
+G1  X81.16 Y62.07 E2.2171
+G1  X81.20 Y62.35 E2.2241
+G1  X81.36 Y62.68 E2.2334
+G1  X81.69 Y63.02 E2.2453
+G1  X82.20 Y63.33 E2.2605
+G1  E0.7605 F1080.00
+G92  E0.0000
+G1  X80.97 Y63.13 F4200.00
+G1  E1.5000 F1080.00
+G1  F3000.00
+G1  X80.28 Y63.34 E1.5183
+G1  X79.37 Y63.68 E1.5427
+G1  X78.30 Y64.18 E1.5724
+G1  X77.66 Y64.53 E1.5908
+G1  X76.84 Y65.04 E1.6150
+G1  X76.06 Y65.59 E1.6392
+G1  X75.32 Y66.20 E1.6634
+G1  X74.79 Y66.70 E1.6816
+G1  X74.39 Y66.14 E1.6989
+G1  X74.09 Y65.89 E1.7088
+G1  X72.13 Y64.76 E1.7659
+G1  X72.95 Y63.95 E1.7950
+G1  X73.62 Y63.38 E1.8172
+G1  X74.31 Y62.83 E1.8393
+G1  X75.03 Y62.33 E1.8615
+G1  X75.78 Y61.86 E1.8837
+G1  X76.54 Y61.42 E1.9058
+G1  X77.33 Y61.03 E1.9280
+G1  X78.13 Y60.67 E1.9502
+G1  X78.95 Y60.35 E1.9723
+G1  X79.79 Y60.08 E1.9945
+G1  X80.62 Y59.85 E2.0163
+G1  X80.62 Y62.12 E2.0734
+G1  X80.69 Y62.51 E2.0834
+G1  X80.95 Y63.08 E2.0991
+G1  E0.5991 F1080.00
+G92  E0.0000
+G1  X81.28 Y64.15 F4200.00
+G1  E1.5000 F1080.00
+G1  F3000.00
+G1  X82.34 Y63.90 E1.5274
+G1  X83.22 Y63.75 E1.5499
+G1  X84.10 Y63.66 E1.5723
+G1  X84.77 Y63.64 E1.5891
+G1  X85.88 Y63.66 E1.6171
+G1  X86.77 Y63.75 E1.6395
+G1  X87.65 Y63.90 E1.6619
+G1  X88.51 Y64.10 E1.6843
+G1  X89.36 Y64.36 E1.7068
+G1  X90.20 Y64.67 E1.7292
+G1  X91.01 Y65.04 E1.7516
+G1  X91.79 Y65.46 E1.7740
+G1  X92.55 Y65.93 E1.7964
+G1  X93.27 Y66.44 E1.8189
+G1  X93.96 Y67.01 E1.8413
+G1  X94.61 Y67.62 E1.8637
+G1  X95.22 Y68.27 E1.8861
+G1  X95.64 Y68.78 E1.9029
+G1  X96.30 Y69.68 E1.9309
+G1  X96.77 Y70.43 E1.9533
+G1  X97.19 Y71.22 E1.9758
+G1  X97.56 Y72.03 E1.9982
+G1  X97.87 Y72.86 E2.0206
+G1  X98.13 Y73.71 E2.0430
+G1  X98.33 Y74.58 E2.0654
+G1  X98.48 Y75.46 E2.0879
+G1  X98.56 Y76.34 E2.1103
+G1  X98.59 Y77.23 E2.1327
+G1  X98.56 Y78.12 E2.1551
+G1  X98.48 Y79.01 E2.1775
+G1  X98.33 Y79.89 E2.1999
+G1  X98.13 Y80.75 E2.2223
+G1  X97.87 Y81.61 E2.2448
+G1  X97.56 Y82.44 E2.2672
+G1  X97.19 Y83.25 E2.2896
+G1  X96.77 Y84.03 E2.3120
+G1  X96.30 Y84.79 E2.3344
+G1  X95.78 Y85.51 E2.3568
+G1  X95.22 Y86.20 E2.3793
+G1  X94.61 Y86.85 E2.4017
+G1  X93.96 Y87.46 E2.4241
+G1  X93.27 Y88.02 E2.4465
+G1  X92.55 Y88.54 E2.4689
+G1  X91.79 Y89.01 E2.4914
+G1  X91.01 Y89.43 E2.5138
+G1  X90.20 Y89.80 E2.5362
+G1  X89.36 Y90.11 E2.5586
+G1  X88.51 Y90.37 E2.5810
+G1  X87.65 Y90.57 E2.6034
+G1  X86.77 Y90.72 E2.6259
+G1  X85.88 Y90.80 E2.6483
+G1  X84.99 Y90.83 E2.6707
+G1  X84.10 Y90.80 E2.6931
+G1  X83.22 Y90.72 E2.7155
+G1  X82.34 Y90.57 E2.7379
+G1  X81.47 Y90.37 E2.7604
+G1  X80.62 Y90.11 E2.7828
+G1  X79.79 Y89.80 E2.8052
+G1  X78.98 Y89.43 E2.8276
+G1  X78.19 Y89.01 E2.8500
+G1  X77.44 Y88.54 E2.8724
+G1  X76.71 Y88.02 E2.8949
+G1  X76.03 Y87.46 E2.9173
+G1  X75.38 Y86.85 E2.9397
+G1  X74.77 Y86.20 E2.9621
+G1  X74.20 Y85.51 E2.9845
+G1  X73.69 Y84.79 E3.0069
+G1  X73.22 Y84.03 E3.0294
+G1  X72.80 Y83.25 E3.0518
+G1  X72.43 Y82.44 E3.0742
+G1  X72.11 Y81.61 E3.0966
+G1  X71.86 Y80.75 E3.1190
+G1  X71.65 Y79.89 E3.1414
+G1  X71.51 Y79.01 E3.1639
+G1  X71.42 Y78.12 E3.1863
+G1  X71.39 Y77.23 E3.2087
+G1  X71.42 Y76.34 E3.2311
+G1  X71.51 Y75.46 E3.2535
+G1  X71.65 Y74.58 E3.2760
+G1  X71.86 Y73.71 E3.2984
+G1  X72.11 Y72.86 E3.3208
+G1  X72.43 Y72.03 E3.3432
+G1  X72.80 Y71.22 E3.3656
+G1  X73.22 Y70.43 E3.3880
+G1  X73.69 Y69.68 E3.4105
+G1  X74.20 Y68.95 E3.4329
+G1  X74.77 Y68.27 E3.4553
+G1  X75.38 Y67.62 E3.4777
+G1  X76.03 Y67.01 E3.5001
+G1  X76.71 Y66.44 E3.5225
+G1  X77.44 Y65.93 E3.5450
+G1  X78.19 Y65.46 E3.5674
+G1  X78.78 Y65.14 E3.5842
+G1  X79.79 Y64.67 E3.6121
+G1  X80.62 Y64.36 E3.6346
+G1  X81.22 Y64.17 E3.6505
+G1  X81.38 Y63.77 F4200.00
+G1  X81.44 Y63.28
+G1  F3000.00
+G1  X81.33 Y63.13 E3.6518
+G1  X81.23 Y62.98 E3.6528
+G1  E2.1528 F1080.00
+G92  E0.0000
+G1  X82.64 Y63.29 F4200.00
+G1  E1.5000 F1080.00
+G1  F3000.00
+G1  X83.14 Y63.21 E1.5133
+G1  X83.15 Y63.21 E1.5136
+G1  X83.16 Y63.20 E1.5138
+G1  X84.06 Y63.12 E1.5379
+G1  X84.07 Y63.11 E1.5381
+G1  X84.08 Y63.11 E1.5383
+G1  X84.76 Y63.09 E1.5564
+G1  X84.77 Y63.09 E1.5568
+G1  X84.99 Y63.09 E1.5627
+G1  X85.90 Y63.11 E1.5873
+G1  X85.92 Y63.11 E1.5878
+G1  X85.93 Y63.12 E1.5879
+G1  X86.83 Y63.20 E1.6121
+G1  X86.84 Y63.21 E1.6123
+G1  X86.85 Y63.21 E1.6126
+G1  X87.45 Y63.31 E1.6286
+G1  X86.69 Y63.47 F4200.00
+G1  F3000.00
+G1  X87.68 Y63.07 E1.6343
+G1  X87.80 Y63.01 E1.6350
+G1  X87.79 Y63.04 F4200.00
+G1  F3000.00
+G1  X86.41 Y63.45 E1.6540
+G1  E0.1540 F1080.00
+G92  E0.0000
+G1  X89.58 Y62.09 F4200.00
+G1  E1.5000 F1080.00
+G1  F3000.00
+G1  X90.73 Y63.24 E1.5446
+G1  X91.68 Y63.67 E1.5731
+G1  X92.32 Y64.01 E1.5929
+G1  X89.82 Y61.50 E1.6897
+G1  X89.82 Y60.68 E1.7121
+G1  X95.14 Y66.00 E1.9176
+G1  X95.26 Y65.83 E1.9233
+G1  X95.55 Y65.59 E1.9336
+G1  X90.67 Y60.71 E2.1220
+G1  X91.68 Y61.09 E2.1513
+G1  X92.02 Y61.24 E2.1616
+G1  X96.05 Y65.27 E2.3173
+G1  X96.58 Y64.97 E2.3338
+G1  X93.68 Y62.08 E2.4456
+G1  X94.70 Y62.71 E2.4782
+G1  X95.40 Y63.20 E2.5016
+G1  X96.08 Y63.73 E2.5250
+G1  X96.61 Y64.18 E2.5442
+G1  X97.27 Y64.85 E2.5699
+G1  E1.0698 F1080.00
+G92  E0.0000
+G1  X95.46 Y66.85 F4200.00
+G1  E1.5000 F1080.00
+G1  F3000.00
+G1  X95.30 Y67.18 E1.5020
+G1  E0.0020 F1080.00
+G92  E0.0000
+G1  X95.89 Y68.21 F4200.00
+G1  E1.5000 F1080.00
+G1  F3000.00
+G1  X96.21 Y68.62 E1.5141
+G1  X96.75 Y69.36 E1.5387
+G1  X96.76 Y69.37 E1.5391
+G1  X96.76 Y69.38 E1.5393
+G1  X97.24 Y70.15 E1.5634
+G1  X97.25 Y70.16 E1.5637
+G1  X97.25 Y70.17 E1.5639
+G1  X97.68 Y70.97 E1.5879
+G1  X97.68 Y70.98 E1.5882
+G1  X97.69 Y70.98 E1.5884
+G1  X98.06 Y71.81 E1.6125
+G1  X98.07 Y71.82 E1.6127
+G1  X98.07 Y71.83 E1.6130
+G1  X98.25 Y72.30 E1.6263
+G1  E0.1263 F1080.00
+G92  E0.0000
+G1  X98.86 Y73.34 F4200.00
+G1  E1.5000 F1080.00
+G1  F3000.00
+G1  X99.22 Y73.37 E1.5020
+G1  E0.0020 F1080.00
+G92  E0.0000
+G1  X102.42 Y74.06 F4200.00
+G1  E1.5000 F1080.00
+G1  F3000.00
+G1  X101.59 Y73.23 E1.5298
+G1  X101.10 Y73.51 E1.5440
+G1  X102.28 Y74.68 E1.5862
+G1  X102.38 Y75.55 E1.6085
+G1  X100.62 Y73.79 E1.6719
+G1  X100.46 Y73.87 E1.6764
+G1  X100.08 Y74.02 E1.6867
+G1  X102.45 Y76.38 E1.7716
+G1  X102.46 Y77.16 E1.7914
+G1  X99.88 Y74.57 E1.8843
+G1  X100.01 Y75.47 E1.9074
+G1  X102.45 Y77.91 E1.9949
+G1  X102.41 Y78.63 E2.0132
+G1  X100.09 Y76.31 E2.0963
+G1  X100.12 Y77.10 E2.1164
+G1  X102.34 Y79.32 E2.1961
+G1  X102.24 Y79.99 E2.2133
+G1  X100.10 Y77.85 E2.2902
+G1  X100.05 Y78.57 E2.3085
+G1  X102.13 Y80.64 E2.3830
+G1  X101.99 Y81.27 E2.3993
+G1  X99.98 Y79.26 E2.4713
+G1  X99.87 Y79.92 E2.4882
+G1  X101.33 Y81.37 E2.5404
+G1  E1.0404 F1080.00
+G92  E0.0000
+G1  X97.64 Y82.90 F4200.00
+G1  E1.5000 F1080.00
+G1  F3000.00
+G1  X98.68 Y81.90 E1.5190
+G1  X98.72 Y81.92 F4200.00
+G1  F3000.00
+G1  X98.61 Y81.99 E1.5197
+G1  X97.76 Y82.64 E1.5255
+G1  X98.28 Y82.07 F4200.00
+G1  F3000.00
+G1  X98.07 Y82.64 E1.5415
+G1  X98.07 Y82.65 E1.5417
+G1  X98.06 Y82.66 E1.5420
+G1  X97.69 Y83.48 E1.5660
+G1  X97.68 Y83.49 E1.5663
+G1  X97.68 Y83.50 E1.5665
+G1  X97.25 Y84.30 E1.5905
+G1  X97.25 Y84.31 E1.5908
+G1  X97.24 Y84.32 E1.5910
+G1  X96.76 Y85.09 E1.6151
+G1  X96.76 Y85.09 E1.6153
+G1  X96.75 Y85.10 E1.6156
+G1  X96.22 Y85.84 E1.6396
+G1  X96.22 Y85.85 E1.6398
+G1  X96.21 Y85.86 E1.6401
+G1  X95.89 Y86.24 E1.6534
+G1  E0.1534 F1080.00
+G92  E0.0000
+G1  X95.30 Y87.29 F4200.00
+G1  E1.5000 F1080.00
+G1  F3000.00
+G1  X95.46 Y87.62 E1.5020
+G1  E0.0020 F1080.00
+G92  E0.0000
+G1  X96.93 Y90.31 F4200.00
+G1  E1.5000 F1080.00
+G1  F3000.00
+G1  X95.10 Y88.48 E1.5680
+G1  X94.68 Y88.85 E1.5827
+G1  X96.34 Y90.51 E1.6445
+G1  X95.91 Y90.87 E1.6592
+G1  X94.24 Y89.20 E1.7212
+G1  X93.79 Y89.53 E1.7360
+G1  X95.47 Y91.22 E1.7984
+G1  X95.01 Y91.54 E1.8133
+G1  X93.32 Y89.86 E1.8758
+G1  X92.84 Y90.16 E1.8909
+G1  X94.54 Y91.86 E1.9541
+G1  X94.06 Y92.17 E1.9691
+G1  X92.34 Y90.45 E2.0329
+G1  X91.82 Y90.73 E2.0482
+G1  X93.56 Y92.46 E2.1124
+G1  X93.04 Y92.74 E2.1277
+G1  X91.29 Y90.98 E2.1929
+G1  X90.74 Y91.22 E2.2086
+G1  X92.52 Y93.00 E2.2745
+G1  X91.97 Y93.25 E2.2902
+G1  X90.17 Y91.44 E2.3572
+G1  X89.64 Y91.62 E2.3717
+G1  X89.71 Y91.77 E2.3761
+G1  X91.42 Y93.48 E2.4393
+G1  X90.85 Y93.70 E2.4554
+G1  X89.82 Y92.67 E2.4935
+G1  X89.82 Y93.46 E2.5142
+G1  X90.44 Y94.08 E2.5374
+G1  E1.0374 F1080.00
+G92  E0.0000
+G1  X88.76 Y91.49 F4200.00
+G1  E1.5000 F1080.00
+G1  F3000.00
+G1  X88.55 Y91.19 E1.5020
+G1  E0.0020 F1080.00
+G92  E0.0000
+G1  X87.35 Y91.18 F4200.00
+G1  E1.5000 F1080.00
+G1  F3000.00
+G1  X86.85 Y91.26 E1.5133
+G1  X86.84 Y91.26 E1.5136
+G1  X86.83 Y91.26 E1.5138
+G1  X85.93 Y91.35 E1.5379
+G1  X85.92 Y91.35 E1.5381
+G1  X85.91 Y91.35 E1.5383
+G1  X85.00 Y91.38 E1.5624
+G1  X84.99 Y91.38 E1.5626
+G1  X84.98 Y91.38 E1.5629
+G1  X84.08 Y91.35 E1.5869
+G1  X84.07 Y91.35 E1.5872
+G1  X84.06 Y91.35 E1.5874
+G1  X83.16 Y91.26 E1.6114
+G1  X83.15 Y91.26 E1.6117
+G1  X83.14 Y91.26 E1.6119
+G1  X82.54 Y91.16 E1.6279
+G1  X83.30 Y91.00 F4200.00
+G1  F3000.00
+G1  X82.31 Y91.40 E1.6337
+G1  X82.19 Y91.46 E1.6344
+G1  X82.19 Y91.42 F4200.00
+G1  F3000.00
+G1  X83.58 Y91.02 E1.6534
+G1  E0.1534 F1080.00
+G92  E0.0000
+G1  X80.41 Y92.38 F4200.00
+G1  E1.5000 F1080.00
+G1  F3000.00
+G1  X79.25 Y91.23 E1.5446
+G1  X78.30 Y90.80 E1.5731
+G1  X77.66 Y90.46 E1.5929
+G1  X80.17 Y92.96 E1.6897
+G1  X80.17 Y93.79 E1.7122
+G1  X74.85 Y88.47 E1.9176
+G1  X74.73 Y88.64 E1.9233
+G1  X74.44 Y88.88 E1.9336
+G1  X79.31 Y93.75 E2.1220
+G1  X78.31 Y93.38 E2.1513
+G1  X77.96 Y93.22 E2.1616
+G1  X73.93 Y89.19 E2.3174
+G1  X73.41 Y89.49 E2.3338
+G1  X76.30 Y92.39 E2.4456
+G1  X75.29 Y91.76 E2.4782
+G1  X74.58 Y91.27 E2.5016
+G1  X73.91 Y90.74 E2.5250
+G1  X73.38 Y90.28 E2.5442
+G1  X72.71 Y89.62 E2.5699
+G1  E1.0698 F1080.00
+G92  E0.0000
+G1  X74.53 Y87.62 F4200.00
+G1  E1.5000 F1080.00
+G1  F3000.00
+G1  X74.61 Y87.46 E1.5010
+G1  X74.69 Y87.29 E1.5023
+G1  E0.0023 F1080.00
+G92  E0.0000
+G1  X74.09 Y86.24 F4200.00
+G1  E1.5000 F1080.00
+G1  F3000.00
+G1  X73.77 Y85.86 E1.5133
+G1  X73.77 Y85.85 E1.5136
+G1  X73.76 Y85.84 E1.5138
+G1  X73.23 Y85.10 E1.5379
+G1  X73.23 Y85.09 E1.5381
+G1  X73.22 Y85.09 E1.5383
+G1  X72.74 Y84.32 E1.5624
+G1  X72.74 Y84.31 E1.5626
+G1  X72.73 Y84.30 E1.5629
+G1  X72.31 Y83.50 E1.5869
+G1  X72.30 Y83.49 E1.5872
+G1  X72.30 Y83.48 E1.5874
+G1  X71.93 Y82.66 E1.6114
+G1  X71.92 Y82.65 E1.6117
+G1  X71.92 Y82.64 E1.6119
+G1  X71.74 Y82.17 E1.6253
+G1  E0.1253 F1080.00
+G92  E0.0000
+G1  X71.13 Y81.13 F4200.00
+G1  E1.5000 F1080.00
+G1  F3000.00
+G1  X70.95 Y81.11 E1.5013
+G1  X70.77 Y81.10 E1.5023
+G1  E0.0023 F1080.00
+G92  E0.0000
+G1  X68.58 Y81.42 F4200.00
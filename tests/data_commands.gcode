@@ -0,0 +1,501 @@
+G1  X64.04 Y81.43 E22.5825
+G1  X63.85 Y80.40 E22.6090
+G1  X63.72 Y79.36 E22.6354
+G1  X63.65 Y78.31 E22.6618
+G1  X63.62 Y77.26 E22.6882
+G1  X63.64 Y76.21 E22.7147
+G1  X63.72 Y75.17 E22.7411
+G1  X63.85 Y74.12 E22.7675
+G1  X64.02 Y73.09 E22.7940
+G1  X64.25 Y72.07 E22.8204
+G1  X64.54 Y71.04 E22.8471
+G1  X64.87 Y70.04 E22.8739
+G1  X65.24 Y69.07 E22.9000
+G1  X65.66 Y68.12 E22.9261
+G1  X66.14 Y67.17 E22.9529
+G1  X66.65 Y66.26 E22.9793
+G1  X67.21 Y65.37 E23.0057
+G1  X67.81 Y64.52 E23.0318
+G1  X68.43 Y63.73 E23.0571
+G1  X68.88 Y64.02 F4200.00
+G1  F3000.00
+G1  X69.55 Y63.24 E23.0828
+G1  X70.24 Y62.51 E23.1083
+G1  X70.98 Y61.81 E23.1340
+G1  X71.76 Y61.14 E23.1598
+G1  X72.56 Y60.51 E23.1856
+G1  X73.40 Y59.92 E23.2113
+G1  X74.26 Y59.37 E23.2371
+G1  X75.15 Y58.87 E23.2628
+G1  X76.07 Y58.40 E23.2886
+G1  X77.00 Y57.99 E23.3144
+G1  X77.95 Y57.62 E23.3401
+G1  X78.93 Y57.30 E23.3659
+G1  X79.91 Y57.02 E23.3917
+G1  X80.91 Y56.80 E23.4174
+G1  X81.91 Y56.62 E23.4431
+G1  X82.93 Y56.50 E23.4689
+G1  X83.95 Y56.42 E23.4947
+G1  X84.97 Y56.40 E23.5205
+G1  X85.94 Y56.42 E23.5449
+G1  X87.02 Y56.49 E23.5720
+G1  X88.03 Y56.62 E23.5977
+G1  X89.05 Y56.79 E23.6239
+G1  X90.04 Y57.02 E23.6493
+G1  X91.02 Y57.29 E23.6751
+G1  X92.00 Y57.61 E23.7008
+G1  X92.95 Y57.97 E23.7266
+G1  X93.89 Y58.39 E23.7523
+G1  X94.80 Y58.85 E23.7781
+G1  X95.69 Y59.35 E23.8039
+G1  X96.55 Y59.90 E23.8296
+G1  X97.39 Y60.48 E23.8554
+G1  X98.20 Y61.11 E23.8812
+G1  X98.97 Y61.78 E23.9069
+G1  X99.71 Y62.48 E23.9327
+G1  X100.42 Y63.22 E23.9584
+G1  X101.09 Y64.00 E23.9842
+G1  X101.72 Y64.80 E24.0099
+G1  X102.32 Y65.65 E24.0361
+G1  X102.86 Y66.51 E24.0618
+G1  X103.37 Y67.40 E24.0876
+G1  X103.82 Y68.31 E24.1130
+G1  X104.24 Y69.24 E24.1387
+G1  X104.61 Y70.19 E24.1646
+G1  X104.93 Y71.17 E24.1903
+G1  X105.20 Y72.15 E24.2161
+G1  X105.43 Y73.15 E24.2418
+G1  X105.60 Y74.16 E24.2676
+G1  X105.73 Y75.17 E24.2934
+G1  X105.81 Y76.19 E24.3191
+G1  X105.83 Y77.21 E24.3449
+G1  X105.81 Y78.24 E24.3707
+G1  X105.73 Y79.26 E24.3964
+G1  X105.61 Y80.27 E24.4222
+G1  X105.44 Y81.28 E24.4479
+G1  X105.21 Y82.28 E24.4737
+G1  X104.94 Y83.26 E24.4995
+G1  X104.62 Y84.25 E24.5256
+G1  X104.25 Y85.20 E24.5514
+G1  X103.84 Y86.12 E24.5768
+G1  X103.38 Y87.04 E24.6025
+G1  X102.88 Y87.93 E24.6283
+G1  X102.32 Y88.80 E24.6544
+G1  X101.73 Y89.64 E24.6802
+G1  X101.12 Y90.44 E24.7055
+G1  X100.45 Y91.21 E24.7313
+G1  X99.74 Y91.95 E24.7571
+G1  X99.00 Y92.66 E24.7829
+G1  X98.23 Y93.33 E24.8086
+G1  X97.42 Y93.96 E24.8344
+G1  X96.59 Y94.55 E24.8601
+G1  X95.72 Y95.10 E24.8859
+G1  X94.83 Y95.60 E24.9117
+G1  X93.92 Y96.06 E24.9374
+G1  X92.99 Y96.48 E24.9632
+G1  X92.03 Y96.85 E24.9890
+G1  X91.05 Y97.17 E25.0151
+G1  X90.06 Y97.45 E25.0408
+G1  X89.06 Y97.67 E25.0666
+G1  X88.06 Y97.84 E25.0924
+G1  X87.04 Y97.97 E25.1181
+G1  X86.04 Y98.05 E25.1436
+G1  X85.01 Y98.07 E25.1693
+G1  X83.99 Y98.05 E25.1951
+G1  X82.97 Y97.97 E25.2209
+G1  X81.95 Y97.85 E25.2467
+G1  X80.95 Y97.68 E25.2723
+G1  X79.95 Y97.45 E25.2981
+G1  X78.96 Y97.18 E25.3239
+G1  X77.99 Y96.86 E25.3496
+G1  X77.04 Y96.49 E25.3754
+G1  X76.10 Y96.08 E25.4012
+G1  X75.19 Y95.62 E25.4269
+G1  X74.30 Y95.12 E25.4527
+G1  X73.43 Y94.57 E25.4785
+G1  X72.60 Y93.98 E25.5042
+G1  X71.79 Y93.36 E25.5300
+G1  X71.01 Y92.69 E25.5558
+G1  X70.27 Y91.98 E25.5815
+G1  X69.57 Y91.24 E25.6073
+G1  X68.90 Y90.47 E25.6331
+G1  X68.27 Y89.66 E25.6588
+G1  X67.68 Y88.83 E25.6846
+G1  X67.13 Y87.96 E25.7104
+G1  X66.62 Y87.06 E25.7364
+G1  X66.15 Y86.14 E25.7626
+G1  X65.74 Y85.21 E25.7880
+G1  X65.38 Y84.27 E25.8134
+G1  X65.06 Y83.30 E25.8392
+G1  X64.78 Y82.32 E25.8649
+G1  X64.56 Y81.32 E25.8907
+G1  X64.38 Y80.31 E25.9165
+G1  X64.26 Y79.30 E25.9422
+G1  X64.18 Y78.28 E25.9680
+G1  X64.15 Y77.25 E25.9937
+G1  X64.18 Y76.23 E26.0195
+G1  X64.25 Y75.21 E26.0453
+G1  X64.38 Y74.20 E26.0710
+G1  X64.55 Y73.19 E26.0968
+G1  X64.77 Y72.19 E26.1225
+G1  X65.05 Y71.20 E26.1483
+G1  X65.37 Y70.22 E26.1744
+G1  X65.74 Y69.26 E26.2002
+G1  X66.15 Y68.34 E26.2256
+G1  X66.61 Y67.41 E26.2518
+G1  X67.11 Y66.53 E26.2775
+G1  X67.66 Y65.66 E26.3032
+G1  X68.24 Y64.83 E26.3287
+G1  X68.84 Y64.06 E26.3533
+G1  X69.30 Y64.35 F4200.00
+G1  F3000.00
+G1  X69.95 Y63.60 E26.3784
+G1  X70.63 Y62.89 E26.4032
+G1  X71.35 Y62.20 E26.4282
+G1  X72.10 Y61.55 E26.4533
+G1  X72.89 Y60.93 E26.4785
+G1  X73.70 Y60.36 E26.5035
+G1  X74.54 Y59.83 E26.5287
+G1  X75.41 Y59.33 E26.5538
+G1  X76.30 Y58.88 E26.5789
+G1  X77.21 Y58.48 E26.6040
+G1  X78.14 Y58.12 E26.6291
+G1  X79.09 Y57.81 E26.6542
+G1  X80.05 Y57.54 E26.6793
+G1  X81.02 Y57.32 E26.7044
+G1  X82.00 Y57.15 E26.7294
+G1  X82.99 Y57.03 E26.7545
+G1  X83.98 Y56.95 E26.7796
+G1  X84.98 Y56.93 E26.8048
+G1  X85.93 Y56.95 E26.8286
+G1  X86.97 Y57.03 E26.8550
+G1  X87.96 Y57.15 E26.8800
+G1  X88.95 Y57.32 E26.9055
+G1  X89.91 Y57.54 E26.9303
+G1  X90.87 Y57.80 E26.9554
+G1  X91.82 Y58.11 E26.9805
+G1  X92.75 Y58.47 E27.0056
+G1  X93.66 Y58.87 E27.0307
+G1  X94.55 Y59.32 E27.0558
+G1  X95.42 Y59.81 E27.0809
+G1  X96.26 Y60.35 E27.1060
+G1  X97.08 Y60.92 E27.1311
+G1  X97.86 Y61.53 E27.1562
+G1  X98.62 Y62.18 E27.1813
+G1  X99.34 Y62.87 E27.2064
+G1  X100.03 Y63.59 E27.2315
+G1  X100.68 Y64.34 E27.2566
+G1  X101.29 Y65.13 E27.2816
+G1  X101.87 Y65.95 E27.3071
+G1  X102.41 Y66.79 E27.3322
+G1  X102.90 Y67.66 E27.3573
+G1  X103.34 Y68.54 E27.3821
+G1  X103.75 Y69.45 E27.4071
+G1  X104.11 Y70.38 E27.4323
+G1  X104.42 Y71.33 E27.4574
+G1  X104.68 Y72.29 E27.4825
+G1  X104.90 Y73.26 E27.5076
+G1  X105.07 Y74.24 E27.5327
+G1  X105.20 Y75.23 E27.5578
+G1  X105.27 Y76.22 E27.5829
+G1  X105.30 Y77.22 E27.6080
+G1  X105.27 Y78.22 E27.6331
+G1  X105.20 Y79.21 E27.6582
+G1  X105.08 Y80.20 E27.6833
+G1  X104.91 Y81.18 E27.7084
+G1  X104.69 Y82.15 E27.7335
+G1  X104.43 Y83.11 E27.7586
+G1  X104.11 Y84.07 E27.7840
+G1  X103.75 Y85.00 E27.8092
+G1  X103.35 Y85.90 E27.8339
+G1  X102.90 Y86.79 E27.8590
+G1  X102.41 Y87.66 E27.8841
+G1  X101.87 Y88.51 E27.9095
+G1  X101.30 Y89.33 E27.9347
+G1  X100.70 Y90.10 E27.9594
+G1  X100.05 Y90.86 E27.9845
+G1  X99.36 Y91.58 E28.0096
+G1  X98.64 Y92.27 E28.0347
+G1  X97.88 Y92.92 E28.0598
+G1  X97.10 Y93.53 E28.0849
+G1  X96.29 Y94.11 E28.1100
+G1  X95.44 Y94.64 E28.1351
+G1  X94.58 Y95.13 E28.1602
+G1  X93.69 Y95.58 E28.1853
+G1  X92.78 Y95.99 E28.2104
+G1  X91.85 Y96.35 E28.2355
+G1  X90.89 Y96.66 E28.2609
+G1  X89.93 Y96.93 E28.2861
+G1  X88.95 Y97.15 E28.3112
+G1  X87.97 Y97.32 E28.3363
+G1  X86.98 Y97.44 E28.3614
+G1  X86.00 Y97.51 E28.3861
+G1  X85.01 Y97.54 E28.4112
+G1  X84.01 Y97.51 E28.4363
+G1  X83.01 Y97.44 E28.4615
+G1  X82.02 Y97.32 E28.4866
+G1  X81.05 Y97.15 E28.5116
+G1  X80.07 Y96.93 E28.5367
+G1  X79.11 Y96.67 E28.5618
+G1  X78.17 Y96.36 E28.5869
+G1  X77.24 Y96.00 E28.6120
+G1  X76.32 Y95.59 E28.6371
+G1  X75.43 Y95.15 E28.6622
+G1  X74.57 Y94.65 E28.6873
+G1  X73.72 Y94.12 E28.7124
+G1  X72.91 Y93.55 E28.7375
+G1  X72.12 Y92.94 E28.7626
+G1  X71.37 Y92.29 E28.7877
+G1  X70.65 Y91.60 E28.8128
+G1  X69.96 Y90.88 E28.8379
+G1  X69.31 Y90.12 E28.8630
+G1  X68.69 Y89.34 E28.8881
+G1  X68.12 Y88.52 E28.9133
+G1  X67.58 Y87.68 E28.9384
+G1  X67.09 Y86.80 E28.9638
+G1  X66.63 Y85.90 E28.9892
+G1  X66.23 Y85.00 E29.0140
+G1  X65.88 Y84.09 E29.0388
+G1  X65.57 Y83.14 E29.0639
+G1  X65.30 Y82.18 E29.0890
+G1  X65.08 Y81.21 E29.1141
+G1  X64.91 Y80.23 E29.1392
+G1  X64.79 Y79.24 E29.1643
+G1  X64.72 Y78.24 E29.1894
+G1  X64.69 Y77.25 E29.2145
+G1  X64.71 Y76.25 E29.2396
+G1  X64.79 Y75.26 E29.2647
+G1  X64.91 Y74.27 E29.2898
+G1  X65.08 Y73.29 E29.3149
+G1  X65.30 Y72.31 E29.3400
+G1  X65.56 Y71.35 E29.3651
+G1  X65.88 Y70.39 E29.3905
+G1  X66.23 Y69.46 E29.4156
+G1  X66.63 Y68.56 E29.4404
+G1  X67.09 Y67.66 E29.4659
+G1  X67.58 Y66.79 E29.4909
+G1  X68.11 Y65.95 E29.5160
+G1  X68.68 Y65.15 E29.5408
+G1  X69.26 Y64.40 E29.5647
+G1  X69.72 Y64.69 F4200.00
+G1  F3000.00
+G1  X70.35 Y63.95 E29.5892
+G1  X71.01 Y63.26 E29.6133
+G1  X71.71 Y62.59 E29.6377
+G1  X72.45 Y61.96 E29.6622
+G1  X73.21 Y61.36 E29.6866
+G1  X74.01 Y60.80 E29.7110
+G1  X74.83 Y60.28 E29.7355
+G1  X75.67 Y59.80 E29.7599
+G1  X76.54 Y59.37 E29.7843
+G1  X77.42 Y58.97 E29.8088
+G1  X78.33 Y58.62 E29.8332
+G1  X79.25 Y58.32 E29.8577
+G1  X80.18 Y58.06 E29.8821
+G1  X81.13 Y57.85 E29.9065
+G1  X82.08 Y57.68 E29.9309
+G1  X83.05 Y57.56 E29.9554
+G1  X84.02 Y57.49 E29.9798
+G1  X84.99 Y57.47 E30.0043
+G1  X85.91 Y57.49 E30.0275
+G1  X86.93 Y57.56 E30.0532
+G1  X87.89 Y57.68 E30.0776
+G1  X88.86 Y57.85 E30.1024
+G1  X89.79 Y58.06 E30.1265
+G1  X90.73 Y58.31 E30.1509
+G1  X91.65 Y58.62 E30.1754
+G1  X92.55 Y58.97 E30.1998
+G1  X93.44 Y59.36 E30.2243
+G1  X94.31 Y59.80 E30.2487
+G1  X95.15 Y60.28 E30.2731
+G1  X95.97 Y60.79 E30.2976
+G1  X96.76 Y61.35 E30.3220
+G1  X97.53 Y61.95 E30.3465
+G1  X98.26 Y62.58 E30.3709
+G1  X98.97 Y63.25 E30.3953
+G1  X99.64 Y63.95 E30.4198
+G1  X100.27 Y64.69 E30.4442
+G1  X100.87 Y65.45 E30.4686
+G1  X101.43 Y66.26 E30.4934
+G1  X101.95 Y67.08 E30.5178
+G1  X102.43 Y67.92 E30.5422
+G1  X102.86 Y68.78 E30.5664
+G1  X103.25 Y69.66 E30.5908
+G1  X103.60 Y70.57 E30.6153
+G1  X103.91 Y71.49 E30.6397
+G1  X104.17 Y72.42 E30.6641
+G1  X104.38 Y73.37 E30.6886
+G1  X104.55 Y74.33 E30.7130
+G1  X104.67 Y75.29 E30.7375
+G1  X104.74 Y76.26 E30.7619
+G1  X104.76 Y77.23 E30.7863
+G1  X104.74 Y78.20 E30.8108
+G1  X104.67 Y79.16 E30.8352
+G1  X104.55 Y80.13 E30.8597
+G1  X104.38 Y81.08 E30.8841
+G1  X104.17 Y82.03 E30.9085
+G1  X103.91 Y82.97 E30.9330
+G1  X103.60 Y83.90 E30.9577
+G1  X103.25 Y84.80 E30.9822
+G1  X102.86 Y85.68 E31.0063
+G1  X102.43 Y86.55 E31.0307
+G1  X101.95 Y87.39 E31.0552
+G1  X101.43 Y88.22 E31.0799
+G1  X100.87 Y89.01 E31.1044
+G1  X100.28 Y89.77 E31.1285
+G1  X99.64 Y90.50 E31.1529
+G1  X98.98 Y91.21 E31.1774
+G1  X98.27 Y91.88 E31.2018
+G1  X97.54 Y92.51 E31.2262
+G1  X96.77 Y93.11 E31.2507
+G1  X95.98 Y93.67 E31.2751
+G1  X95.16 Y94.19 E31.2995
+G1  X94.32 Y94.66 E31.3240
+G1  X93.45 Y95.10 E31.3484
+G1  X92.56 Y95.49 E31.3729
+G1  X91.66 Y95.84 E31.3973
+G1  X90.73 Y96.15 E31.4221
+G1  X89.79 Y96.41 E31.4465
+G1  X88.84 Y96.62 E31.4709
+G1  X87.89 Y96.79 E31.4954
+G1  X86.92 Y96.91 E31.5198
+G1  X85.97 Y96.98 E31.5439
+G1  X85.00 Y97.00 E31.5684
+G1  X84.03 Y96.98 E31.5928
+G1  X83.06 Y96.91 E31.6173
+G1  X82.10 Y96.79 E31.6418
+G1  X81.14 Y96.62 E31.6661
+G1  X80.20 Y96.41 E31.6906
+G1  X79.26 Y96.15 E31.7150
+G1  X78.34 Y95.85 E31.7395
+G1  X77.43 Y95.50 E31.7639
+G1  X76.55 Y95.11 E31.7883
+G1  X75.68 Y94.67 E31.8128
+G1  X74.84 Y94.19 E31.8372
+G1  X74.02 Y93.67 E31.8616
+G1  X73.22 Y93.11 E31.8861
+G1  X72.46 Y92.52 E31.9105
+G1  X71.72 Y91.88 E31.9350
+G1  X71.02 Y91.22 E31.9594
+G1  X70.35 Y90.51 E31.9838
+G1  X69.72 Y89.78 E32.0083
+G1  X69.12 Y89.01 E32.0327
+G1  X68.56 Y88.22 E32.0572
+G1  X68.04 Y87.40 E32.0816
+G1  X67.56 Y86.55 E32.1064
+G1  X67.12 Y85.68 E32.1308
+G1  X66.73 Y84.80 E32.1549
+G1  X66.38 Y83.90 E32.1794
+G1  X66.08 Y82.98 E32.2038
+G1  X65.82 Y82.04 E32.2282
+G1  X65.61 Y81.10 E32.2527
+G1  X65.44 Y80.14 E32.2771
+G1  X65.32 Y79.18 E32.3016
+G1  X65.25 Y78.21 E32.3260
+G1  X65.23 Y77.24 E32.3504
+G1  X65.25 Y76.27 E32.3749
+G1  X65.32 Y75.30 E32.3993
+G1  X65.44 Y74.34 E32.4237
+G1  X65.61 Y73.38 E32.4482
+G1  X65.82 Y72.44 E32.4726
+G1  X66.07 Y71.50 E32.4971
+G1  X66.38 Y70.58 E32.5215
+G1  X66.73 Y69.66 E32.5463
+G1  X67.12 Y68.79 E32.5704
+G1  X67.56 Y67.91 E32.5952
+G1  X68.04 Y67.06 E32.6196
+G1  X68.56 Y66.25 E32.6440
+G1  X69.11 Y65.46 E32.6682
+G1  X69.68 Y64.74 E32.6914
+G1  E31.1914 F1080.00
+G92  E0.0000
+G1  X96.18 Y86.94 F4200.00
+G1  E1.5000 F1080.00
+G1  F3000.00
+G1  X96.18 Y87.12 E1.5045
+G1  X96.27 Y87.42 E1.5124
+G1  X96.39 Y87.59 E1.5176
+G1  X96.51 Y87.70 E1.5218
+G1  X99.54 Y89.44 E1.6098
+G1  X99.07 Y89.99 E1.6280
+G1  X98.43 Y90.67 E1.6515
+G1  X97.75 Y91.31 E1.6749
+G1  X97.05 Y91.92 E1.6984
+G1  X96.31 Y92.50 E1.7219
+G1  X95.55 Y93.03 E1.7454
+G1  X94.76 Y93.53 E1.7689
+G1  X93.95 Y93.99 E1.7924
+G1  X93.12 Y94.41 E1.8159
+G1  X92.26 Y94.79 E1.8394
+G1  X91.39 Y95.12 E1.8629
+G1  X90.51 Y95.42 E1.8864
+G1  X89.61 Y95.66 E1.9098
+G1  X88.70 Y95.87 E1.9333
+G1  X88.29 Y95.94 E1.9437
+G1  X88.29 Y92.44 E2.0318
+G1  X88.27 Y92.28 E2.0360
+G1  X88.18 Y92.09 E2.0412
+G1  X87.96 Y91.87 E2.0490
+G1  X87.81 Y91.77 E2.0536
+G1  X87.62 Y91.72 E2.0585
+G1  X87.45 Y91.72 E2.0627
+G1  X86.91 Y91.81 E2.0765
+G1  X85.95 Y91.90 E2.1008
+G1  X84.99 Y91.93 E2.1250
+G1  X84.03 Y91.90 E2.1492
+G1  X83.07 Y91.81 E2.1735
+G1  X82.53 Y91.72 E2.1873
+G1  X82.36 Y91.72 E2.1915
+G1  X82.16 Y91.78 E2.1968
+G1  X81.91 Y91.96 E2.2047
+G1  X81.80 Y92.10 E2.2092
+G1  X81.72 Y92.28 E2.2140
+G1  X81.69 Y92.44 E2.2182
+G1  X81.69 Y95.94 E2.3063
+G1  X81.29 Y95.87 E2.3167
+G1  X80.38 Y95.66 E2.3401
+G1  X79.48 Y95.42 E2.3636
+G1  X78.59 Y95.12 E2.3871
+G1  X77.72 Y94.79 E2.4106
+G1  X76.87 Y94.41 E2.4341
+G1  X76.04 Y93.99 E2.4576
+G1  X75.23 Y93.53 E2.4811
+G1  X74.44 Y93.03 E2.5046
+G1  X73.68 Y92.50 E2.5281
+G1  X72.94 Y91.92 E2.5515
+G1  X72.23 Y91.31 E2.5750
+G1  X71.56 Y90.67 E2.5985
+G1  X70.92 Y89.99 E2.6220
+G1  X70.45 Y89.44 E2.6402
+G1  X73.47 Y87.70 E2.7283
+G1  X73.60 Y87.59 E2.7324
+G1  X73.72 Y87.42 E2.7376
+G1  X73.81 Y87.12 E2.7455
+G1  X73.81 Y86.94 E2.7500
+G1  X73.76 Y86.75 E2.7549
+G1  X73.68 Y86.61 E2.7591
+G1  X73.33 Y86.18 E2.7730
+G1  X72.77 Y85.40 E2.7972
+G1  X72.26 Y84.58 E2.8214
+G1  X71.81 Y83.73 E2.8457
+G1  X71.41 Y82.86 E2.8699
+G1  X71.22 Y82.34 E2.8837
+G1  X71.13 Y82.20 E2.8880
+G1  X70.99 Y82.06 E2.8928
+G1  X70.84 Y81.98 E2.8974
+G1  X70.53 Y81.90 E2.9053
+G1  X70.33 Y81.92 E2.9104
+G1  X70.17 Y81.98 E2.9146
+G1  X67.14 Y83.73 E3.0029
+G1  X66.81 Y82.75 E3.0290
+G1  X66.56 Y81.85 E3.0525
+G1  X66.36 Y80.94 E3.0760
+G1  X66.20 Y80.02 E3.0995
+G1  X66.08 Y79.10 E3.1230
+G1  X66.02 Y78.17 E3.1465
+G1  X65.99 Y77.23 E3.1700
+G1  X66.02 Y76.30 E3.1934
+G1  X66.08 Y75.37 E3.2169
+G1  X66.20 Y74.45 E3.2404
+G1  X66.36 Y73.53 E3.2639
+G1  X66.56 Y72.62 E3.2874
@@ -0,0 +1,252 @@
+M107 
+M190  S60
+M104 T0  S230
+M104 T1  S230
+M82 
+M185 
+M190  S0
+T0 
+M109 T0  S230
+T1 
+M109 T1  S230
+M201 
+M202 
+M82 
+T0 
+M109 T0  S210
+M104 T0  S225
+T1 
+M109 T1  S230
+M104 T0  S210
+M104 T1  S210
+M140  S55
+M104 T1  S205
+T0 
+M109 T0  S210
+M104 T0  S205
+T1 
+M109 T1  S210
+M106  S178
+M104 T1  S205
+T0 
+M109 T0  S210
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M106  S255
+M106  S178
+M104 T0  S205
+T1 
+M109 T1  S210
+M104 T1  S205
+T0 
+M109 T0  S210
+M104 T0  S205
+T1 
+M109 T1  S210
+M104 T1  S205
+T0 
+M109 T0  S210
+M104 T0  S205
+T1 
+M109 T1  S210
+M104 T1  S205
+T0 
+M109 T0  S210
+M104 T0  S205
+T1 
+M109 T1  S210
+M104 T1  S205
+T0 
+M109 T0  S210
+M106  S255
+M106  S178
+M104 T0  S205
+T1 
+M109 T1  S210
+M104 T1  S205
+T0 
+M109 T0  S210
+M104 T0  S205
+T1 
+M109 T1  S210
+M104 T1  S205
+T0 
+M109 T0  S210
+M107 
+M104 T0  S0
+M104 T1  S0
+M140  S0
+M144 
+M7 
+M144 
+M84 
+M201 
+M202 
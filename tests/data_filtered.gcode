@@ -0,0 +1,79 @@
+M104 T0  S230
+M104 T1  S230
+G1  Z5.00 F5000.00
+T0 
+M109 T0  S230
+G1  X0.00 Y25.00 Z0.35 F2000.00
+T1 
+M109 T1  S230
+T0 
+M109 T0  S210
+G1  Z0.30 F4200.00
+M104 T0  S225
+T1 
+M109 T1  S230
+G1  Z0.50 F4200.00
+M104 T0  S210
+M104 T1  S210
+M104 T1  S205
+T0 
+M109 T0  S210
+G1  Z0.70 F4200.00
+M104 T0  S205
+T1 
+M109 T1  S210
+G1  Z0.90 F4200.00
+M104 T1  S205
+T0 
+M109 T0  S210
+G1  Z1.10 F4200.00
+M104 T0  S205
+T1 
+M109 T1  S210
+G1  Z1.30 F4200.00
+M104 T1  S205
+T0 
+M109 T0  S210
+G1  Z1.50 F4200.00
+M104 T0  S205
+T1 
+M109 T1  S210
+G1  Z1.70 F4200.00
+M104 T1  S205
+T0 
+M109 T0  S210
+G1  Z1.90 F4200.00
+M104 T0  S205
+T1 
+M109 T1  S210
+G1  Z2.10 F4200.00
+M104 T1  S205
+T0 
+M109 T0  S210
+G1  Z2.30 F4200.00
+M104 T0  S205
+T1 
+M109 T1  S210
+G1  Z2.50 F4200.00
+M104 T1  S205
+T0 
+M109 T0  S210
+G1  Z2.70 F4200.00
+M104 T0  S205
+T1 
+M109 T1  S210
+G1  Z2.90 F4200.00
+M104 T1  S205
+T0 
+M109 T0  S210
+G1  Z3.10 F4200.00
+M104 T0  S205
+T1 
+M109 T1  S210
+G1  Z3.30 F4200.00
+M104 T1  S205
+T0 
+M109 T0  S210
+M104 T0  S0
+M104 T1  S0
+G1  X0.00 Y220.00 Z0.50 E-5.0000 F2500.00
@@ -0,0 +1,2459 @@
+G1  Z0.50 F4200.00
+M104 T0  S210
+M104 T1  S210
+M140  S55
+G1  E0.1103 F1080.00
+G92  E0.0000
+G1  X57.80 Y59.05 F4200.00
+G1  E1.5000 F1080.00
+G1  F2400.00
+G1  X59.71 Y56.47 E1.5560
+G1  X61.88 Y54.08 E1.6124
+G1  X64.24 Y51.95 E1.6680
+G1  X66.79 Y50.05 E1.7235
+G1  X69.53 Y48.41 E1.7792
+G1  X72.48 Y47.01 E1.8363
+G1  X75.50 Y45.93 E1.8924
+G1  X78.62 Y45.15 E1.9485
+G1  X81.79 Y44.68 E2.0045
+G1  X85.00 Y44.52 E2.0607
+G1  X88.20 Y44.68 E2.1166
+G1  X91.38 Y45.15 E2.1727
+G1  X94.45 Y45.92 E2.2279
+G1  X97.52 Y47.01 E2.2849
+G1  X100.42 Y48.39 E2.3410
+G1  X103.18 Y50.04 E2.3970
+G1  X105.75 Y51.95 E2.4531
+G1  X108.14 Y54.12 E2.5095
+G1  X110.29 Y56.49 E2.5652
+G1  X112.19 Y59.06 E2.6212
+G1  X113.82 Y61.77 E2.6763
+G1  X115.20 Y64.67 E2.7325
+G1  X116.28 Y67.69 E2.7885
+G1  X117.08 Y70.84 E2.8453
+G1  X117.55 Y74.05 E2.9020
+G1  X117.71 Y77.23 E2.9576
+G1  X117.55 Y80.44 E3.0136
+G1  X117.08 Y83.61 E3.0697
+G1  X116.31 Y86.70 E3.1252
+G1  X115.21 Y89.76 E3.1820
+G1  X113.84 Y92.66 E3.2380
+G1  X112.19 Y95.41 E3.2940
+G1  X110.26 Y98.01 E3.3506
+G1  X108.11 Y100.38 E3.4066
+G1  X105.74 Y102.53 E3.4623
+G1  X103.16 Y104.44 E3.5184
+G1  X100.45 Y106.06 E3.5736
+G1  X97.50 Y107.46 E3.6305
+G1  X94.53 Y108.52 E3.6857
+G1  X91.38 Y109.32 E3.7425
+G1  X88.19 Y109.79 E3.7987
+G1  X84.99 Y109.95 E3.8547
+G1  X81.83 Y109.79 E3.9100
+G1  X78.61 Y109.32 E3.9668
+G1  X75.50 Y108.54 E4.0229
+G1  X72.47 Y107.45 E4.0791
+G1  X69.57 Y106.08 E4.1350
+G1  X66.85 Y104.45 E4.1905
+G1  X64.24 Y102.52 E4.2471
+G1  X61.84 Y100.35 E4.3037
+G1  X59.70 Y97.98 E4.3594
+G1  X57.79 Y95.40 E4.4156
+G1  X56.16 Y92.69 E4.4708
+G1  X54.77 Y89.74 E4.5277
+G1  X53.69 Y86.72 E4.5837
+G1  X52.91 Y83.61 E4.6398
+G1  X52.44 Y80.41 E4.6962
+G1  X52.28 Y77.23 E4.7518
+G1  X52.44 Y74.03 E4.8078
+G1  X52.91 Y70.85 E4.8639
+G1  X53.69 Y67.74 E4.9200
+G1  X54.77 Y64.71 E4.9762
+G1  X56.15 Y61.81 E5.0322
+G1  X57.77 Y59.10 E5.0873
+G1  X58.23 Y59.38 F4200.00
+G1  F2400.00
+G1  X60.13 Y56.81 E5.1431
+G1  X62.26 Y54.46 E5.1985
+G1  X64.58 Y52.36 E5.2531
+G1  X67.09 Y50.50 E5.3077
+G1  X69.78 Y48.88 E5.3625
+G1  X72.68 Y47.50 E5.4187
+G1  X75.66 Y46.44 E5.4739
+G1  X78.72 Y45.67 E5.5290
+G1  X81.84 Y45.21 E5.5841
+G1  X85.00 Y45.06 E5.6393
+G1  X88.15 Y45.21 E5.6944
+G1  X91.27 Y45.67 E5.7496
+G1  X94.30 Y46.43 E5.8040
+G1  X97.31 Y47.51 E5.8599
+G1  X100.16 Y48.85 E5.9149
+G1  X102.88 Y50.48 E5.9702
+G1  X105.41 Y52.36 E6.0254
+G1  X107.77 Y54.50 E6.0809
+G1  X109.87 Y56.83 E6.1357
+G1  X111.75 Y59.36 E6.1907
+G1  X113.35 Y62.02 E6.2451
+G1  X114.71 Y64.88 E6.3004
+G1  X115.77 Y67.84 E6.3552
+G1  X116.55 Y70.94 E6.4111
+G1  X117.02 Y74.11 E6.4670
+G1  X117.17 Y77.23 E6.5216
+G1  X117.02 Y80.38 E6.5767
+G1  X116.55 Y83.52 E6.6320
+G1  X115.80 Y86.54 E6.6864
+G1  X114.72 Y89.55 E6.7423
+G1  X113.37 Y92.41 E6.7975
+G1  X111.74 Y95.12 E6.8527
+G1  X109.85 Y97.67 E6.9082
+G1  X107.73 Y100.01 E6.9633
+G1  X105.40 Y102.11 E7.0181
+G1  X102.87 Y103.99 E7.0732
+G1  X100.19 Y105.59 E7.1276
+G1  X97.30 Y106.96 E7.1835
+G1  X94.38 Y108.01 E7.2378
+G1  X91.27 Y108.79 E7.2937
+G1  X88.14 Y109.26 E7.3490
+G1  X84.99 Y109.41 E7.4040
+G1  X81.88 Y109.26 E7.4584
+G1  X78.71 Y108.79 E7.5144
+G1  X75.65 Y108.02 E7.5696
+G1  X72.68 Y106.96 E7.6247
+G1  X69.83 Y105.61 E7.6797
+G1  X67.15 Y104.01 E7.7343
+G1  X64.58 Y102.11 E7.7900
+G1  X62.22 Y99.97 E7.8457
+G1  X60.12 Y97.64 E7.9005
+G1  X58.23 Y95.10 E7.9557
+G1  X56.63 Y92.44 E8.0100
+G1  X55.26 Y89.54 E8.0660
+G1  X54.20 Y86.57 E8.1211
+G1  X53.43 Y83.51 E8.1763
+G1  X52.97 Y80.36 E8.2318
+G1  X52.82 Y77.24 E8.2864
+G1  X52.97 Y74.08 E8.3415
+G1  X53.43 Y70.96 E8.3967
+G1  X54.20 Y67.90 E8.4518
+G1  X55.27 Y64.91 E8.5071
+G1  X56.62 Y62.06 E8.5623
+G1  X58.20 Y59.43 E8.6159
+G1  X58.65 Y59.70 F4200.00
+G1  F2400.00
+G1  X60.54 Y57.15 E8.6713
+G1  X62.64 Y54.84 E8.7259
+G1  X64.92 Y52.77 E8.7797
+G1  X67.38 Y50.95 E8.8331
+G1  X70.04 Y49.35 E8.8872
+G1  X72.89 Y48.00 E8.9424
+G1  X75.81 Y46.95 E8.9966
+G1  X78.82 Y46.20 E9.0508
+G1  X81.89 Y45.74 E9.1050
+G1  X85.00 Y45.59 E9.1593
+G1  X88.09 Y45.74 E9.2134
+G1  X91.17 Y46.20 E9.2677
+G1  X94.14 Y46.94 E9.3212
+G1  X97.11 Y48.00 E9.3762
+G1  X99.91 Y49.33 E9.4305
+G1  X102.58 Y50.93 E9.4847
+G1  X105.07 Y52.78 E9.5389
+G1  X107.39 Y54.88 E9.5936
+G1  X109.46 Y57.16 E9.6474
+G1  X111.30 Y59.65 E9.7015
+G1  X112.88 Y62.27 E9.7549
+G1  X114.21 Y65.09 E9.8093
+G1  X115.26 Y67.99 E9.8632
+G1  X116.03 Y71.05 E9.9184
+G1  X116.49 Y74.16 E9.9732
+G1  X116.64 Y77.24 E10.0270
+G1  X116.48 Y80.34 E10.0812
+G1  X116.03 Y83.41 E10.1355
+G1  X115.28 Y86.38 E10.1889
+G1  X114.23 Y89.34 E10.2439
+G1  X112.90 Y92.15 E10.2981
+G1  X111.30 Y94.82 E10.3524
+G1  X109.43 Y97.33 E10.4072
+G1  X107.35 Y99.63 E10.4613
+G1  X105.06 Y101.70 E10.5151
+G1  X102.57 Y103.54 E10.5693
+G1  X99.94 Y105.12 E10.6228
+G1  X97.10 Y106.47 E10.6778
+G1  X94.22 Y107.50 E10.7313
+G1  X91.16 Y108.27 E10.7862
+G1  X88.09 Y108.72 E10.8405
+G1  X85.00 Y108.88 E10.8946
+G1  X81.94 Y108.73 E10.9481
+G1  X78.82 Y108.27 E11.0032
+G1  X75.80 Y107.51 E11.0574
+G1  X72.88 Y106.47 E11.1117
+G1  X70.08 Y105.14 E11.1657
+G1  X67.45 Y103.56 E11.2194
+G1  X64.92 Y101.70 E11.2742
+G1  X62.60 Y99.59 E11.3290
+G1  X60.53 Y97.30 E11.3828
+G1  X58.68 Y94.81 E11.4371
+G1  X57.11 Y92.19 E11.4905
+G1  X55.76 Y89.34 E11.5456
+G1  X54.71 Y86.42 E11.5997
+G1  X53.96 Y83.40 E11.6540
+G1  X53.50 Y80.31 E11.7087
+G1  X53.35 Y77.23 E11.7624
+G1  X53.50 Y74.13 E11.8167
+G1  X53.96 Y71.06 E11.8709
+G1  X54.71 Y68.05 E11.9250
+G1  X55.76 Y65.11 E11.9795
+G1  X57.09 Y62.31 E12.0337
+G1  X58.62 Y59.75 E12.0858
+G1  E10.5858 F1080.00
+G92  E0.0000
+G1  X86.95 Y95.59 F4200.00
+G1  E1.5000 F1080.00
+G1  F1200.00
+G1  X85.90 Y95.67 E1.5135
+G1  X84.99 Y95.69 E1.5251
+G1  X84.09 Y95.67 E1.5366
+G1  X83.03 Y95.59 E1.5501
+G1  X83.03 Y93.15 E1.5812
+G1  X83.94 Y93.24 E1.5929
+G1  X84.99 Y93.27 E1.6063
+G1  X86.04 Y93.24 E1.6197
+G1  X86.95 Y93.15 E1.6314
+G1  X86.95 Y95.53 E1.6617
+G1  X87.36 Y95.94 F4200.00
+G1  F1200.00
+G1  X86.84 Y96.01 E1.6684
+G1  X85.92 Y96.08 E1.6802
+G1  X84.99 Y96.10 E1.6920
+G1  X84.07 Y96.08 E1.7038
+G1  X83.14 Y96.01 E1.7156
+G1  X82.63 Y95.94 E1.7223
+G1  X82.63 Y92.68 E1.7640
+G1  X82.95 Y92.73 E1.7682
+G1  X83.97 Y92.83 E1.7813
+G1  X84.99 Y92.87 E1.7943
+G1  X86.02 Y92.83 E1.8074
+G1  X87.03 Y92.73 E1.8204
+G1  X87.36 Y92.68 E1.8246
+G1  X87.36 Y95.88 E1.8655
+G1  X87.77 Y96.30 F4200.00
+G1  F1200.00
+G1  X86.88 Y96.42 E1.8769
+G1  X85.94 Y96.48 E1.8890
+G1  X84.99 Y96.51 E1.9011
+G1  X84.05 Y96.48 E1.9131
+G1  X83.10 Y96.42 E1.9252
+G1  X82.22 Y96.30 E1.9366
+G1  X82.22 Y92.49 E1.9853
+G1  X82.25 Y92.39 E1.9865
+G1  X82.35 Y92.28 E1.9885
+G1  X82.44 Y92.25 E1.9897
+G1  X83.01 Y92.33 E1.9970
+G1  X84.00 Y92.43 E2.0097
+G1  X84.99 Y92.46 E2.0224
+G1  X85.99 Y92.43 E2.0352
+G1  X86.98 Y92.33 E2.0479
+G1  X87.51 Y92.24 E2.0547
+G1  X87.59 Y92.26 E2.0557
+G1  X87.73 Y92.38 E2.0582
+G1  X87.77 Y92.49 E2.0596
+G1  X87.77 Y96.24 E2.1075
+G1  X87.40 Y96.13 F4200.00
+G1  E0.6075 F1080.00
+G92  E0.0000
+G1  X72.19 Y86.89 F4200.00
+G1  E1.5000 F1080.00
+G1  F1200.00
+G1  X70.08 Y88.11 E1.5311
+G1  X69.64 Y87.49 E1.5408
+G1  X69.16 Y86.72 E1.5523
+G1  X68.71 Y85.94 E1.5639
+G1  X68.30 Y85.12 E1.5755
+G1  X68.12 Y84.71 E1.5813
+G1  X70.23 Y83.49 E1.6123
+G1  X70.61 Y84.33 E1.6240
+G1  X71.10 Y85.25 E1.6374
+G1  X71.66 Y86.14 E1.6508
+G1  X72.15 Y86.84 E1.6617
+G1  X72.80 Y87.01 F4200.00
+G1  F1200.00
+G1  X69.97 Y88.64 E1.7035
+G1  X69.30 Y87.71 E1.7180
+G1  X68.81 Y86.93 E1.7298
+G1  X68.35 Y86.13 E1.7416
+G1  X67.94 Y85.30 E1.7535
+G1  X67.60 Y84.54 E1.7641
+G1  X70.43 Y82.91 E1.8058
+G1  X70.55 Y83.22 E1.8101
+G1  X70.97 Y84.15 E1.8231
+G1  X71.46 Y85.05 E1.8362
+G1  X72.00 Y85.92 E1.8492
+G1  X72.59 Y86.75 E1.8623
+G1  X72.76 Y86.96 E1.8657
+G1  X73.28 Y87.00 F4200.00
+G1  F1200.00
+G1  X73.24 Y87.18 E1.8680
+G1  X73.16 Y87.27 E1.8696
+G1  X69.87 Y89.17 E1.9181
+G1  X69.51 Y88.72 E1.9255
+G1  X68.97 Y87.94 E1.9376
+G1  X68.46 Y87.14 E1.9497
+G1  X68.00 Y86.32 E1.9618
+G1  X67.57 Y85.47 E1.9738
+G1  X67.09 Y84.37 E1.9892
+G1  X70.40 Y82.46 E2.0380
+G1  X70.50 Y82.43 E2.0393
+G1  X70.64 Y82.47 E2.0412
+G1  X70.74 Y82.57 E2.0430
+G1  X70.93 Y83.06 E2.0497
+G1  X71.34 Y83.97 E2.0624
+G1  X71.81 Y84.85 E2.0751
+G1  X72.33 Y85.69 E2.0878
+G1  X72.91 Y86.50 E2.1005
+G1  X73.27 Y86.94 E2.1077
+G1  X73.13 Y87.10 F4200.00
+G1  E0.6077 F1080.00
+G92  E0.0000
+G1  X97.80 Y86.89 F4200.00
+G1  E1.5000 F1080.00
+G1  F1200.00
+G1  X98.33 Y86.14 E1.5117
+G1  X98.88 Y85.25 E1.5251
+G1  X99.38 Y84.33 E1.5385
+G1  X99.76 Y83.49 E1.5502
+G1  X101.86 Y84.71 E1.5812
+G1  X101.68 Y85.13 E1.5870
+G1  X101.27 Y85.94 E1.5986
+G1  X100.83 Y86.72 E1.6101
+G1  X100.34 Y87.49 E1.6217
+G1  X99.91 Y88.11 E1.6314
+G1  X97.85 Y86.92 E1.6617
+G1  X97.18 Y87.01 F4200.00
+G1  F1200.00
+G1  X97.40 Y86.75 E1.6659
+G1  X97.99 Y85.92 E1.6790
+G1  X98.53 Y85.05 E1.6920
+G1  X99.01 Y84.15 E1.7051
+G1  X99.44 Y83.22 E1.7182
+G1  X99.55 Y82.91 E1.7224
+G1  X102.39 Y84.54 E1.7641
+G1  X102.05 Y85.30 E1.7747
+G1  X101.63 Y86.13 E1.7866
+G1  X101.18 Y86.93 E1.7984
+G1  X100.68 Y87.71 E1.8102
+G1  X100.02 Y88.64 E1.8247
+G1  X97.24 Y87.04 E1.8657
+G1  X96.70 Y87.00 F4200.00
+G1  F1200.00
+G1  X96.74 Y86.90 E1.8670
+G1  X97.07 Y86.50 E1.8736
+G1  X97.65 Y85.69 E1.8864
+G1  X98.18 Y84.85 E1.8991
+G1  X98.65 Y83.97 E1.9118
+G1  X99.06 Y83.06 E1.9245
+G1  X99.24 Y82.57 E1.9311
+G1  X99.27 Y82.53 E1.9318
+G1  X99.34 Y82.47 E1.9330
+G1  X99.52 Y82.43 E1.9353
+G1  X99.59 Y82.46 E1.9362
+G1  X102.89 Y84.36 E1.9850
+G1  X102.42 Y85.47 E2.0004
+G1  X101.99 Y86.32 E2.0125
+G1  X101.52 Y87.14 E2.0245
+G1  X101.02 Y87.94 E2.0366
+G1  X100.47 Y88.72 E2.0487
+G1  X100.12 Y89.17 E2.0561
+G1  X96.82 Y87.26 E2.1047
+G1  X96.75 Y87.19 E2.1060
+G1  X96.71 Y87.06 E2.1078
+G1  X96.80 Y86.96 F4200.00
+G1  E0.6078 F1080.00
+G92  E0.0000
+G1  X99.76 Y70.97 F4200.00
+G1  E1.5000 F1080.00
+G1  F1200.00
+G1  X99.38 Y70.14 E1.5117
+G1  X98.88 Y69.21 E1.5251
+G1  X98.33 Y68.32 E1.5385
+G1  X97.80 Y67.58 E1.5502
+G1  X99.90 Y66.36 E1.5812
+G1  X100.34 Y66.98 E1.5909
+G1  X100.83 Y67.74 E1.6024
+G1  X101.27 Y68.53 E1.6140
+G1  X101.68 Y69.34 E1.6256
+G1  X101.86 Y69.76 E1.6314
+G1  X99.81 Y70.94 E1.6617
+G1  X99.55 Y71.56 F4200.00
+G1  F1200.00
+G1  X99.44 Y71.25 E1.6659
+G1  X99.01 Y70.32 E1.6790
+G1  X98.53 Y69.42 E1.6920
+G1  X97.99 Y68.55 E1.7050
+G1  X97.40 Y67.72 E1.7181
+G1  X97.18 Y67.46 E1.7223
+G1  X100.02 Y65.82 E1.7641
+G1  X100.68 Y66.75 E1.7786
+G1  X101.18 Y67.53 E1.7904
+G1  X101.63 Y68.34 E1.8022
+G1  X102.05 Y69.17 E1.8141
+G1  X102.39 Y69.93 E1.8247
+G1  X99.60 Y71.53 E1.8657
+G1  X99.30 Y71.97 F4200.00
+G1  F1200.00
+G1  X99.24 Y71.89 E1.8669
+G1  X99.06 Y71.41 E1.8735
+G1  X98.65 Y70.50 E1.8862
+G1  X98.18 Y69.62 E1.8989
+G1  X97.65 Y68.77 E1.9116
+G1  X97.07 Y67.96 E1.9244
+G1  X96.75 Y67.57 E1.9310
+G1  X96.71 Y67.51 E1.9318
+G1  X96.70 Y67.42 E1.9329
+G1  X96.75 Y67.28 E1.9348
+G1  X96.81 Y67.20 E1.9361
+G1  X100.12 Y65.29 E1.9848
+G1  X100.42 Y65.68 E1.9910
+G1  X101.02 Y66.52 E2.0043
+G1  X101.52 Y67.32 E2.0163
+G1  X101.99 Y68.15 E2.0284
+G1  X102.42 Y68.99 E2.0405
+G1  X102.89 Y70.10 E2.0559
+G1  X99.59 Y72.01 E2.1046
+G1  X99.48 Y72.04 E2.1060
+G1  X99.36 Y71.99 E2.1077
+G1  X99.31 Y71.87 F4200.00
+G1  E0.6077 F1080.00
+G92  E0.0000
+G1  X72.19 Y67.58 F4200.00
+G1  E1.5000 F1080.00
+G1  F1200.00
+G1  X71.66 Y68.32 E1.5117
+G1  X71.10 Y69.21 E1.5251
+G1  X70.61 Y70.14 E1.5385
+G1  X70.23 Y70.97 E1.5502
+G1  X68.12 Y69.75 E1.5812
+G1  X68.30 Y69.34 E1.5870
+G1  X68.71 Y68.53 E1.5986
+G1  X69.16 Y67.74 E1.6102
+G1  X69.64 Y66.98 E1.6217
+G1  X70.08 Y66.36 E1.6314
+G1  X72.14 Y67.55 E1.6617
+G1  X72.80 Y67.46 F4200.00
+G1  F1200.00
+G1  X72.59 Y67.72 E1.6660
+G1  X72.00 Y68.55 E1.6790
+G1  X71.45 Y69.42 E1.6921
+G1  X70.97 Y70.32 E1.7051
+G1  X70.55 Y71.25 E1.7182
+G1  X70.43 Y71.56 E1.7224
+G1  X67.60 Y69.92 E1.7642
+G1  X67.94 Y69.17 E1.7748
+G1  X68.35 Y68.34 E1.7866
+G1  X68.81 Y67.53 E1.7984
+G1  X69.30 Y66.75 E1.8102
+G1  X69.97 Y65.82 E1.8248
+G1  X72.75 Y67.43 E1.8658
+G1  X73.24 Y67.28 F4200.00
+G1  F1200.00
+G1  X73.28 Y67.42 E1.8677
+G1  X73.27 Y67.52 E1.8689
+G1  X72.91 Y67.96 E1.8762
+G1  X72.33 Y68.77 E1.8889
+G1  X71.81 Y69.62 E1.9016
+G1  X71.34 Y70.50 E1.9143
+G1  X70.93 Y71.41 E1.9270
+G1  X70.74 Y71.89 E1.9337
+G1  X70.64 Y72.00 E1.9355
+G1  X70.49 Y72.03 E1.9375
+G1  X70.40 Y72.01 E1.9387
+G1  X67.09 Y70.10 E1.9875
+G1  X67.57 Y68.99 E2.0029
+G1  X68.00 Y68.15 E2.0150
+G1  X68.46 Y67.32 E2.0270
+G1  X68.97 Y66.52 E2.0391
+G1  X69.51 Y65.75 E2.0512
+G1  X69.87 Y65.29 E2.0586
+G1  X73.20 Y67.23 E2.1078
+G1  X73.17 Y67.41 F4200.00
+G1  E0.6078 F1080.00
+G92  E0.0000
+G1  X83.03 Y61.32 F4200.00
+G1  E1.5000 F1080.00
+G1  F1200.00
+G1  X83.03 Y58.88 E1.5311
+G1  X84.09 Y58.79 E1.5446
+G1  X84.99 Y58.77 E1.5562
+G1  X85.79 Y58.79 E1.5663
+G1  X86.95 Y58.88 E1.5812
+G1  X86.95 Y61.32 E1.6123
+G1  X86.04 Y61.23 E1.6240
+G1  X84.99 Y61.19 E1.6374
+G1  X83.94 Y61.23 E1.6508
+G1  X83.09 Y61.31 E1.6617
+G1  X82.63 Y61.79 F4200.00
+G1  F1200.00
+G1  X82.62 Y58.52 E1.7034
+G1  X83.14 Y58.46 E1.7101
+G1  X84.07 Y58.39 E1.7219
+G1  X84.99 Y58.37 E1.7337
+G1  X85.80 Y58.38 E1.7441
+G1  X86.84 Y58.46 E1.7573
+G1  X87.36 Y58.52 E1.7640
+G1  X87.36 Y61.79 E1.8057
+G1  X87.03 Y61.74 E1.8099
+G1  X86.02 Y61.63 E1.8229
+G1  X84.99 Y61.60 E1.8360
+G1  X83.97 Y61.63 E1.8491
+G1  X82.95 Y61.74 E1.8621
+G1  X82.68 Y61.78 E1.8656
+G1  X82.25 Y62.08 F4200.00
+G1  F1200.00
+G1  X82.22 Y61.98 E1.8668
+G1  X82.22 Y58.17 E1.9155
+G1  X83.10 Y58.05 E1.9269
+G1  X84.05 Y57.98 E1.9390
+G1  X84.99 Y57.96 E1.9511
+G1  X85.82 Y57.98 E1.9617
+G1  X86.88 Y58.05 E1.9752
+G1  X87.77 Y58.17 E1.9866
+G1  X87.77 Y61.98 E2.0353
+G1  X87.74 Y62.08 E2.0366
+G1  X87.63 Y62.19 E2.0385
+G1  X87.55 Y62.22 E2.0397
+G1  X87.50 Y62.22 E2.0404
+G1  X86.98 Y62.14 E2.0470
+G1  X85.99 Y62.04 E2.0597
+G1  X84.99 Y62.01 E2.0725
+G1  X84.00 Y62.04 E2.0852
+G1  X83.00 Y62.14 E2.0979
+G1  X82.49 Y62.22 E2.1045
+G1  X82.39 Y62.21 E2.1058
+G1  X82.29 Y62.12 E2.1076
+G1  X82.29 Y61.99 F4200.00
+G1  X83.19 Y59.86
+G1  F1500.00
+G1  X83.90 Y59.16 E2.1203
+G1  X84.50 Y59.13 E2.1281
+G1  X83.38 Y60.26 E2.1485
+G1  X83.38 Y60.83 E2.1559
+G1  X85.09 Y59.12 E2.1869
+G1  X85.65 Y59.13 E2.1942
+G1  X83.91 Y60.88 E2.2259
+G1  X84.51 Y60.86 E2.2335
+G1  X86.20 Y59.17 E2.2642
+G1  X86.61 Y59.20 E2.2695
+G1  X86.61 Y59.34 E2.2712
+G1  X85.10 Y60.85 E2.2986
+G1  X85.66 Y60.87 E2.3058
+G1  X86.61 Y59.92 E2.3230
+G1  X86.61 Y60.50 E2.3304
+G1  X86.04 Y61.06 E2.3407
+G1  E0.8407 F1080.00
+G92  E0.0000
+G1  X99.92 Y66.66 F4200.00
+G1  E1.5000 F1080.00
+G1  F1500.00
+G1  X98.55 Y68.04 E1.5275
+G1  X98.80 Y68.42 E1.5340
+G1  X100.05 Y67.17 E1.5591
+G1  X100.30 Y67.56 E1.5657
+G1  X99.05 Y68.82 E1.5909
+G1  X99.28 Y69.22 E1.5975
+G1  X100.55 Y67.95 E1.6229
+G1  X100.78 Y68.36 E1.6296
+G1  X99.50 Y69.64 E1.6552
+G1  X99.72 Y70.06 E1.6619
+G1  X101.01 Y68.77 E1.6876
+G1  X101.22 Y69.20 E1.6944
+G1  X99.78 Y70.64 E1.7232
+G1  E0.2232 F1080.00
+G92  E0.0000
+G1  X100.39 Y84.04 F4200.00
+G1  E1.5000 F1080.00
+G1  F1500.00
+G1  X99.39 Y85.04 E1.5190
+G1  X99.18 Y85.43 E1.5249
+G1  X98.62 Y86.34 E1.5394
+G1  X98.40 Y86.64 E1.5445
+G1  X100.64 Y84.40 E1.5872
+G1  X101.03 Y84.62 E1.5932
+G1  X98.66 Y86.99 E1.6384
+G1  X99.05 Y87.21 E1.6444
+G1  X101.42 Y84.86 E1.6897
+G1  X100.97 Y85.77 E1.7035
+G1  X100.80 Y86.07 E1.7081
+G1  X99.30 Y87.57 E1.7368
+G1  E0.2368 F1080.00
+G92  E0.0000
+G1  X85.89 Y95.51 F4200.00
+G1  E1.5000 F1080.00
+G1  F1500.00
+G1  X86.61 Y94.79 E1.5130
+G1  X86.61 Y94.21 E1.5204
+G1  X85.48 Y95.34 E1.5408
+G1  X84.89 Y95.35 E1.5484
+G1  X86.61 Y93.63 E1.5794
+G1  X86.61 Y93.53 E1.5807
+G1  X86.08 Y93.58 E1.5875
+G1  X84.33 Y95.33 E1.6192
+G1  X83.79 Y95.30 E1.6262
+G1  X85.48 Y93.60 E1.6570
+G1  X84.89 Y93.62 E1.6646
+G1  X83.38 Y95.13 E1.6919
+G1  X83.38 Y94.55 E1.6994
+G1  X84.33 Y93.60 E1.7166
+G1  X83.78 Y93.57 E1.7237
+G1  X83.20 Y94.15 E1.7342
+G1  E0.2342 F1080.00
+G92  E0.0000
+G1  X70.06 Y87.80 F4200.00
+G1  E1.5000 F1080.00
+G1  F1500.00
+G1  X71.44 Y86.43 E1.5275
+G1  X71.19 Y86.04 E1.5341
+G1  X69.93 Y87.30 E1.5592
+G1  X69.68 Y86.91 E1.5658
+G1  X70.94 Y85.65 E1.5910
+G1  X70.71 Y85.25 E1.5976
+G1  X69.44 Y86.51 E1.6230
+G1  X69.21 Y86.11 E1.6297
+G1  X70.48 Y84.83 E1.6553
+G1  X70.26 Y84.41 E1.6620
+G1  X68.98 Y85.69 E1.6878
+G1  X68.76 Y85.27 E1.6945
+G1  X70.20 Y83.83 E1.7234
+G1  E0.2234 F1080.00
+G92  E0.0000
+G1  X69.60 Y70.42 F4200.00
+G1  E1.5000 F1080.00
+G1  F1500.00
+G1  X70.60 Y69.42 E1.5191
+G1  X70.80 Y69.04 E1.5249
+G1  X71.37 Y68.13 E1.5394
+G1  X71.59 Y67.82 E1.5446
+G1  X69.35 Y70.06 E1.5875
+G1  X68.96 Y69.84 E1.5935
+G1  X71.32 Y67.48 E1.6387
+G1  X70.94 Y67.25 E1.6447
+G1  X68.56 Y69.61 E1.6899
+G1  X69.02 Y68.69 E1.7038
+G1  X69.19 Y68.39 E1.7084
+G1  X70.68 Y66.90 E1.7371
+G1  E-8.2629 F1080.00
+G92  E0.0000
+G1  X57.87 Y54.04 F4200.00
+M104 T1  S205
+T0 
+G92  E0.0000
+M109 T0  S210
+G1  X59.13 Y59.94
+G1  E10.2000 F1080.00
+G1  F2400.00
+G1  X60.96 Y57.49 E10.2533
+G1  X63.02 Y55.22 E10.3069
+G1  X65.26 Y53.19 E10.3597
+G1  X67.68 Y51.39 E10.4124
+G1  X70.29 Y49.83 E10.4655
+G1  X73.10 Y48.49 E10.5198
+G1  X75.96 Y47.47 E10.5730
+G1  X78.93 Y46.72 E10.6263
+G1  X81.95 Y46.28 E10.6797
+G1  X85.00 Y46.13 E10.7331
+G1  X88.05 Y46.28 E10.7863
+G1  X91.07 Y46.73 E10.8396
+G1  X93.98 Y47.46 E10.8921
+G1  X96.91 Y48.50 E10.9464
+G1  X99.66 Y49.80 E10.9995
+G1  X102.28 Y51.38 E11.0530
+G1  X104.73 Y53.19 E11.1063
+G1  X107.01 Y55.26 E11.1600
+G1  X109.04 Y57.50 E11.2128
+G1  X110.85 Y59.95 E11.2660
+G1  X112.40 Y62.53 E11.3185
+G1  X113.71 Y65.29 E11.3720
+G1  X114.74 Y68.15 E11.4250
+G1  X115.50 Y71.16 E11.4792
+G1  X115.95 Y74.22 E11.5332
+G1  X116.10 Y77.23 E11.5860
+G1  X115.95 Y80.28 E11.6393
+G1  X115.50 Y83.30 E11.6926
+G1  X114.77 Y86.22 E11.7452
+G1  X113.73 Y89.14 E11.7994
+G1  X112.43 Y91.90 E11.8525
+G1  X110.86 Y94.52 E11.9059
+G1  X109.02 Y97.00 E11.9598
+G1  X106.97 Y99.25 E12.0130
+G1  X104.72 Y101.29 E12.0659
+G1  X102.27 Y103.10 E12.1193
+G1  X99.69 Y104.65 E12.1717
+G1  X96.89 Y105.98 E12.2259
+G1  X94.06 Y106.99 E12.2783
+G1  X91.06 Y107.74 E12.3324
+G1  X88.04 Y108.19 E12.3857
+G1  X84.99 Y108.34 E12.4391
+G1  X81.98 Y108.19 E12.4916
+G1  X78.92 Y107.74 E12.5456
+G1  X75.96 Y107.00 E12.5989
+G1  X73.08 Y105.97 E12.6524
+G1  X70.33 Y104.67 E12.7056
+G1  X67.74 Y103.12 E12.7583
+G1  X65.26 Y101.28 E12.8122
+G1  X62.98 Y99.21 E12.8660
+G1  X60.95 Y96.97 E12.9188
+G1  X59.13 Y94.51 E12.9722
+G1  X57.58 Y91.94 E13.0247
+G1  X56.25 Y89.13 E13.0788
+G1  X55.23 Y86.26 E13.1321
+G1  X54.48 Y83.30 E13.1854
+G1  X54.03 Y80.25 E13.2392
+G1  X53.89 Y77.23 E13.2920
+G1  X54.04 Y74.18 E13.3454
+G1  X54.49 Y71.16 E13.3987
+G1  X55.22 Y68.21 E13.4518
+G1  X56.26 Y65.32 E13.5054
+G1  X57.56 Y62.56 E13.5587
+G1  X59.10 Y59.99 E13.6111
+G1  X59.56 Y60.27 F4200.00
+G1  F2400.00
+G1  X61.37 Y57.83 E13.6640
+G1  X63.40 Y55.59 E13.7168
+G1  X65.60 Y53.60 E13.7686
+G1  X67.98 Y51.84 E13.8204
+G1  X70.54 Y50.30 E13.8725
+G1  X73.30 Y48.99 E13.9260
+G1  X76.12 Y47.98 E13.9782
+G1  X79.03 Y47.25 E14.0306
+G1  X82.00 Y46.81 E14.0831
+G1  X85.00 Y46.66 E14.1355
+G1  X87.99 Y46.81 E14.1878
+G1  X90.96 Y47.25 E14.2403
+G1  X93.83 Y47.97 E14.2918
+G1  X96.70 Y48.99 E14.3451
+G1  X99.40 Y50.27 E14.3974
+G1  X101.98 Y51.82 E14.4499
+G1  X104.39 Y53.61 E14.5023
+G1  X106.63 Y55.64 E14.5551
+G1  X108.63 Y57.85 E14.6071
+G1  X110.41 Y60.25 E14.6594
+G1  X111.93 Y62.78 E14.7109
+G1  X113.22 Y65.50 E14.7635
+G1  X114.23 Y68.31 E14.8157
+G1  X114.98 Y71.26 E14.8688
+G1  X115.42 Y74.26 E14.9218
+G1  X115.56 Y77.23 E14.9737
+G1  X115.42 Y80.23 E15.0261
+G1  X114.98 Y83.20 E15.0785
+G1  X114.26 Y86.07 E15.1302
+G1  X113.23 Y88.94 E15.1834
+G1  X111.95 Y91.64 E15.2357
+G1  X110.41 Y94.22 E15.2882
+G1  X108.61 Y96.65 E15.3410
+G1  X106.59 Y98.87 E15.3935
+G1  X104.38 Y100.87 E15.4455
+G1  X101.97 Y102.66 E15.4979
+G1  X99.44 Y104.17 E15.5493
+G1  X96.69 Y105.48 E15.6026
+G1  X93.91 Y106.47 E15.6541
+G1  X90.96 Y107.22 E15.7073
+G1  X87.99 Y107.66 E15.7597
+G1  X84.99 Y107.80 E15.8122
+G1  X82.04 Y107.66 E15.8638
+G1  X79.03 Y107.22 E15.9169
+G1  X76.12 Y106.49 E15.9693
+G1  X73.29 Y105.47 E16.0218
+G1  X70.58 Y104.20 E16.0741
+G1  X68.04 Y102.67 E16.1259
+G1  X65.60 Y100.87 E16.1789
+G1  X63.35 Y98.83 E16.2318
+G1  X61.36 Y96.62 E16.2838
+G1  X59.57 Y94.22 E16.3361
+G1  X58.06 Y91.69 E16.3876
+G1  X56.75 Y88.93 E16.4409
+G1  X55.74 Y86.11 E16.4932
+G1  X55.01 Y83.20 E16.5456
+G1  X54.57 Y80.20 E16.5986
+G1  X54.42 Y77.23 E16.6504
+G1  X54.57 Y74.24 E16.7028
+G1  X55.01 Y71.27 E16.7552
+G1  X55.74 Y68.36 E16.8076
+G1  X56.75 Y65.53 E16.8602
+G1  X58.03 Y62.82 E16.9125
+G1  X59.53 Y60.32 E16.9634
+G1  X59.99 Y60.59 F4200.00
+G1  F2400.00
+G1  X61.78 Y58.17 E17.0160
+G1  X63.77 Y55.98 E17.0678
+G1  X65.94 Y54.02 E17.1188
+G1  X68.28 Y52.28 E17.1696
+G1  X70.79 Y50.77 E17.2208
+G1  X73.50 Y49.48 E17.2733
+G1  X76.27 Y48.49 E17.3247
+G1  X79.14 Y47.77 E17.3763
+G1  X82.05 Y47.34 E17.4277
+G1  X85.00 Y47.20 E17.4792
+G1  X87.94 Y47.34 E17.5306
+G1  X90.86 Y47.78 E17.5821
+G1  X93.67 Y48.48 E17.6328
+G1  X96.49 Y49.49 E17.6852
+G1  X99.16 Y50.75 E17.7367
+G1  X101.69 Y52.26 E17.7881
+G1  X104.05 Y54.02 E17.8396
+G1  X106.25 Y56.01 E17.8914
+G1  X108.21 Y58.18 E17.9426
+G1  X109.97 Y60.55 E17.9939
+G1  X111.46 Y63.03 E18.0445
+G1  X112.72 Y65.70 E18.0961
+G1  X113.72 Y68.46 E18.1474
+G1  X114.45 Y71.36 E18.1997
+G1  X114.89 Y74.31 E18.2518
+G1  X115.03 Y77.23 E18.3028
+G1  X114.88 Y80.18 E18.3542
+G1  X114.45 Y83.10 E18.4059
+G1  X113.75 Y85.92 E18.4566
+G1  X112.74 Y88.73 E18.5088
+G1  X111.48 Y91.40 E18.5603
+G1  X109.97 Y93.92 E18.6117
+G1  X108.21 Y96.29 E18.6632
+G1  X106.21 Y98.49 E18.7151
+G1  X104.04 Y100.46 E18.7662
+G1  X101.68 Y102.21 E18.8177
+G1  X99.18 Y103.70 E18.8684
+G1  X96.48 Y104.98 E18.9207
+G1  X93.76 Y105.96 E18.9712
+G1  X90.86 Y106.69 E19.0235
+G1  X87.94 Y107.12 E19.0749
+G1  X84.99 Y107.27 E19.1265
+G1  X82.09 Y107.13 E19.1772
+G1  X79.13 Y106.69 E19.2295
+G1  X76.27 Y105.97 E19.2810
+G1  X73.49 Y104.98 E19.3325
+G1  X70.84 Y103.72 E19.3838
+G1  X68.34 Y102.23 E19.4347
+G1  X65.94 Y100.45 E19.4868
+G1  X63.74 Y98.45 E19.5387
+G1  X61.77 Y96.28 E19.5899
+G1  X60.02 Y93.92 E19.6413
+G1  X58.53 Y91.43 E19.6919
+G1  X57.24 Y88.73 E19.7442
+G1  X56.25 Y85.95 E19.7956
+G1  X55.54 Y83.09 E19.8471
+G1  X55.10 Y80.15 E19.8991
+G1  X54.96 Y77.24 E19.9501
+G1  X55.10 Y74.29 E20.0016
+G1  X55.54 Y71.38 E20.0530
+G1  X56.25 Y68.52 E20.1045
+G1  X57.25 Y65.73 E20.1562
+G1  X58.51 Y63.07 E20.2076
+G1  X59.96 Y60.65 E20.2570
+G1  E18.7570 F1080.00
+G92  E0.0000
+G1  X92.71 Y84.95 F4200.00
+G1  E1.5000 F1080.00
+G1  F2100.00
+G1  X92.19 Y85.44 E1.5091
+G1  X91.64 Y85.89 E1.5182
+G1  X91.05 Y86.30 E1.5273
+G1  X90.45 Y86.68 E1.5364
+G1  X89.82 Y87.02 E1.5456
+G1  X89.17 Y87.31 E1.5547
+G1  X88.50 Y87.56 E1.5638
+G1  X87.82 Y87.77 E1.5729
+G1  X87.12 Y87.93 E1.5820
+G1  X86.42 Y88.05 E1.5911
+G1  X85.71 Y88.12 E1.6002
+G1  X84.99 Y88.14 E1.6093
+G1  X84.28 Y88.12 E1.6184
+G1  X83.57 Y88.05 E1.6276
+G1  X82.86 Y87.93 E1.6367
+G1  X82.17 Y87.77 E1.6458
+G1  X81.49 Y87.56 E1.6549
+G1  X80.82 Y87.31 E1.6640
+G1  X80.17 Y87.02 E1.6731
+G1  X79.54 Y86.68 E1.6822
+G1  X78.93 Y86.30 E1.6913
+G1  X78.35 Y85.89 E1.7005
+G1  X77.80 Y85.44 E1.7096
+G1  X77.28 Y84.95 E1.7187
+G1  X76.79 Y84.43 E1.7278
+G1  X76.34 Y83.88 E1.7369
+G1  X75.92 Y83.29 E1.7460
+G1  X75.54 Y82.69 E1.7551
+G1  X75.21 Y82.06 E1.7642
+G1  X74.91 Y81.41 E1.7733
+G1  X74.66 Y80.74 E1.7825
+G1  X74.45 Y80.06 E1.7916
+G1  X74.29 Y79.36 E1.8007
+G1  X74.18 Y78.66 E1.8098
+G1  X74.11 Y77.95 E1.8189
+G1  X74.08 Y77.23 E1.8280
+G1  X74.11 Y76.52 E1.8371
+G1  X74.18 Y75.81 E1.8462
+G1  X74.29 Y75.11 E1.8553
+G1  X74.45 Y74.41 E1.8645
+G1  X74.66 Y73.73 E1.8736
+G1  X74.91 Y73.06 E1.8827
+G1  X75.21 Y72.41 E1.8918
+G1  X75.54 Y71.78 E1.9009
+G1  X75.92 Y71.17 E1.9100
+G1  X76.34 Y70.59 E1.9191
+G1  X76.79 Y70.04 E1.9282
+G1  X77.28 Y69.52 E1.9374
+G1  X77.80 Y69.03 E1.9465
+G1  X78.35 Y68.58 E1.9556
+G1  X78.93 Y68.16 E1.9647
+G1  X79.54 Y67.79 E1.9738
+G1  X80.17 Y67.45 E1.9829
+G1  X80.82 Y67.15 E1.9920
+G1  X81.49 Y66.90 E2.0011
+G1  X82.17 Y66.69 E2.0103
+G1  X82.86 Y66.53 E2.0194
+G1  X83.57 Y66.42 E2.0285
+G1  X84.28 Y66.35 E2.0376
+G1  X84.99 Y66.32 E2.0467
+G1  X85.71 Y66.35 E2.0558
+G1  X86.42 Y66.42 E2.0649
+G1  X87.12 Y66.53 E2.0740
+G1  X87.82 Y66.69 E2.0831
+G1  X88.50 Y66.90 E2.0923
+G1  X89.17 Y67.15 E2.1014
+G1  X89.82 Y67.45 E2.1105
+G1  X90.45 Y67.79 E2.1196
+G1  X91.05 Y68.16 E2.1287
+G1  X91.64 Y68.58 E2.1378
+G1  X92.19 Y69.03 E2.1469
+G1  X92.71 Y69.52 E2.1560
+G1  X93.20 Y70.04 E2.1651
+G1  X93.65 Y70.59 E2.1743
+G1  X94.06 Y71.17 E2.1834
+G1  X94.44 Y71.78 E2.1925
+G1  X94.78 Y72.41 E2.2016
+G1  X95.07 Y73.06 E2.2107
+G1  X95.32 Y73.73 E2.2198
+G1  X95.53 Y74.41 E2.2289
+G1  X95.69 Y75.11 E2.2380
+G1  X95.81 Y75.81 E2.2472
+G1  X95.88 Y76.52 E2.2563
+G1  X95.90 Y77.23 E2.2654
+G1  X95.88 Y77.95 E2.2745
+G1  X95.81 Y78.66 E2.2836
+G1  X95.69 Y79.36 E2.2927
+G1  X95.53 Y80.06 E2.3018
+G1  X95.32 Y80.74 E2.3109
+G1  X95.07 Y81.41 E2.3201
+G1  X94.78 Y82.06 E2.3292
+G1  X94.44 Y82.69 E2.3383
+G1  X94.06 Y83.29 E2.3474
+G1  X93.65 Y83.88 E2.3565
+G1  X93.20 Y84.43 E2.3656
+G1  X92.75 Y84.90 E2.3740
+G1  X93.00 Y85.24 F4200.00
+G1  F2100.00
+G1  X92.46 Y85.74 E2.3834
+G1  X91.88 Y86.21 E2.3929
+G1  X91.28 Y86.64 E2.4023
+G1  X90.65 Y87.04 E2.4118
+G1  X90.00 Y87.38 E2.4212
+G1  X89.32 Y87.69 E2.4307
+G1  X88.63 Y87.95 E2.4401
+G1  X87.92 Y88.17 E2.4496
+G1  X87.20 Y88.33 E2.4590
+G1  X86.47 Y88.45 E2.4685
+G1  X85.73 Y88.53 E2.4779
+G1  X84.99 Y88.55 E2.4874
+G1  X84.25 Y88.53 E2.4968
+G1  X83.52 Y88.45 E2.5063
+G1  X82.79 Y88.33 E2.5157
+G1  X82.06 Y88.17 E2.5252
+G1  X81.36 Y87.95 E2.5346
+G1  X80.66 Y87.69 E2.5441
+G1  X79.99 Y87.38 E2.5535
+G1  X79.33 Y87.04 E2.5630
+G1  X78.71 Y86.64 E2.5724
+G1  X78.10 Y86.21 E2.5819
+G1  X77.53 Y85.74 E2.5913
+G1  X76.99 Y85.24 E2.6008
+G1  X76.48 Y84.70 E2.6103
+G1  X76.01 Y84.12 E2.6197
+G1  X75.58 Y83.52 E2.6291
+G1  X75.19 Y82.89 E2.6386
+G1  X74.84 Y82.24 E2.6481
+G1  X74.54 Y81.56 E2.6575
+G1  X74.28 Y80.87 E2.6670
+G1  X74.06 Y80.16 E2.6764
+G1  X73.89 Y79.44 E2.6859
+G1  X73.77 Y78.71 E2.6953
+G1  X73.70 Y77.97 E2.7048
+G1  X73.68 Y77.23 E2.7142
+G1  X73.70 Y76.49 E2.7237
+G1  X73.77 Y75.76 E2.7331
+G1  X73.89 Y75.03 E2.7426
+G1  X74.06 Y74.30 E2.7520
+G1  X74.28 Y73.60 E2.7615
+G1  X74.54 Y72.90 E2.7709
+G1  X74.84 Y72.23 E2.7804
+G1  X75.19 Y71.57 E2.7898
+G1  X75.58 Y70.95 E2.7993
+G1  X76.01 Y70.34 E2.8087
+G1  X76.48 Y69.77 E2.8182
+G1  X76.99 Y69.23 E2.8276
+G1  X77.53 Y68.72 E2.8371
+G1  X78.10 Y68.25 E2.8465
+G1  X78.71 Y67.82 E2.8560
+G1  X79.33 Y67.43 E2.8654
+G1  X79.99 Y67.08 E2.8749
+G1  X80.66 Y66.78 E2.8844
+G1  X81.36 Y66.52 E2.8938
+G1  X82.06 Y66.30 E2.9033
+G1  X82.79 Y66.13 E2.9127
+G1  X83.52 Y66.01 E2.9222
+G1  X84.25 Y65.94 E2.9316
+G1  X84.99 Y65.92 E2.9411
+G1  X85.73 Y65.94 E2.9505
+G1  X86.47 Y66.01 E2.9600
+G1  X87.20 Y66.13 E2.9694
+G1  X87.92 Y66.30 E2.9789
+G1  X88.63 Y66.52 E2.9883
+G1  X89.32 Y66.78 E2.9978
+G1  X90.00 Y67.08 E3.0072
+G1  X90.65 Y67.43 E3.0167
+G1  X91.28 Y67.82 E3.0261
+G1  X91.88 Y68.25 E3.0356
+G1  X92.46 Y68.72 E3.0450
+G1  X93.00 Y69.23 E3.0545
+G1  X93.50 Y69.77 E3.0639
+G1  X93.97 Y70.34 E3.0734
+G1  X94.40 Y70.95 E3.0828
+G1  X94.79 Y71.57 E3.0923
+G1  X95.14 Y72.23 E3.1017
+G1  X95.45 Y72.90 E3.1112
+G1  X95.71 Y73.60 E3.1206
+G1  X95.93 Y74.30 E3.1301
+G1  X96.09 Y75.03 E3.1396
+G1  X96.21 Y75.76 E3.1490
+G1  X96.29 Y76.49 E3.1584
+G1  X96.31 Y77.23 E3.1679
+G1  X96.29 Y77.97 E3.1774
+G1  X96.21 Y78.71 E3.1868
+G1  X96.09 Y79.44 E3.1963
+G1  X95.93 Y80.16 E3.2057
+G1  X95.71 Y80.87 E3.2152
+G1  X95.45 Y81.56 E3.2246
+G1  X95.14 Y82.24 E3.2341
+G1  X94.79 Y82.89 E3.2435
+G1  X94.40 Y83.52 E3.2530
+G1  X93.97 Y84.12 E3.2624
+G1  X93.50 Y84.70 E3.2719
+G1  X93.04 Y85.19 E3.2806
+G1  X93.29 Y85.52 F4200.00
+G1  F1260.00
+G1  X92.72 Y86.05 E3.2904
+G1  X92.13 Y86.54 E3.3001
+G1  X91.51 Y86.98 E3.3099
+G1  X90.86 Y87.39 E3.3197
+G1  X90.18 Y87.75 E3.3295
+G1  X89.48 Y88.07 E3.3393
+G1  X88.76 Y88.34 E3.3491
+G1  X88.03 Y88.56 E3.3589
+G1  X87.28 Y88.73 E3.3687
+G1  X86.52 Y88.86 E3.3785
+G1  X85.76 Y88.93 E3.3883
+G1  X84.99 Y88.96 E3.3981
+G1  X84.23 Y88.93 E3.4079
+G1  X83.46 Y88.86 E3.4177
+G1  X82.71 Y88.73 E3.4274
+G1  X81.96 Y88.56 E3.4372
+G1  X81.22 Y88.34 E3.4470
+G1  X80.51 Y88.07 E3.4568
+G1  X79.81 Y87.75 E3.4666
+G1  X79.13 Y87.39 E3.4764
+G1  X78.48 Y86.98 E3.4862
+G1  X77.86 Y86.54 E3.4960
+G1  X77.26 Y86.05 E3.5058
+G1  X76.70 Y85.52 E3.5156
+G1  X76.18 Y84.96 E3.5254
+G1  X75.69 Y84.37 E3.5352
+G1  X75.25 Y83.75 E3.5449
+G1  X74.84 Y83.10 E3.5547
+G1  X74.48 Y82.42 E3.5645
+G1  X74.16 Y81.72 E3.5743
+G1  X73.89 Y81.00 E3.5841
+G1  X73.67 Y80.27 E3.5939
+G1  X73.49 Y79.52 E3.6037
+G1  X73.37 Y78.76 E3.6135
+G1  X73.29 Y78.00 E3.6233
+G1  X73.27 Y77.23 E3.6331
+G1  X73.29 Y76.47 E3.6429
+G1  X73.37 Y75.70 E3.6527
+G1  X73.49 Y74.95 E3.6625
+G1  X73.67 Y74.20 E3.6722
+G1  X73.89 Y73.46 E3.6820
+G1  X74.16 Y72.75 E3.6918
+G1  X74.48 Y72.05 E3.7016
+G1  X74.84 Y71.37 E3.7114
+G1  X75.25 Y70.72 E3.7212
+G1  X75.69 Y70.10 E3.7310
+G1  X76.18 Y69.50 E3.7408
+G1  X76.70 Y68.94 E3.7506
+G1  X77.26 Y68.42 E3.7604
+G1  X77.86 Y67.93 E3.7702
+G1  X78.48 Y67.48 E3.7799
+G1  X79.13 Y67.08 E3.7897
+G1  X79.81 Y66.72 E3.7995
+G1  X80.51 Y66.40 E3.8093
+G1  X81.22 Y66.13 E3.8191
+G1  X81.96 Y65.91 E3.8289
+G1  X82.71 Y65.73 E3.8387
+G1  X83.46 Y65.61 E3.8485
+G1  X84.23 Y65.53 E3.8583
+G1  X84.99 Y65.51 E3.8681
+G1  X85.76 Y65.53 E3.8779
+G1  X86.52 Y65.61 E3.8877
+G1  X87.28 Y65.73 E3.8975
+G1  X88.03 Y65.91 E3.9072
+G1  X88.76 Y66.13 E3.9170
+G1  X89.48 Y66.40 E3.9268
+G1  X90.18 Y66.72 E3.9366
+G1  X90.86 Y67.08 E3.9464
+G1  X91.51 Y67.48 E3.9562
+G1  X92.13 Y67.93 E3.9660
+G1  X92.72 Y68.42 E3.9758
+G1  X93.29 Y68.94 E3.9856
+G1  X93.81 Y69.50 E3.9954
+G1  X94.30 Y70.10 E4.0052
+G1  X94.74 Y70.72 E4.0150
+G1  X95.15 Y71.37 E4.0248
+G1  X95.51 Y72.05 E4.0345
+G1  X95.83 Y72.75 E4.0443
+G1  X96.10 Y73.46 E4.0541
+G1  X96.32 Y74.20 E4.0639
+G1  X96.49 Y74.95 E4.0737
+G1  X96.62 Y75.70 E4.0835
+G1  X96.69 Y76.47 E4.0933
+G1  X96.72 Y77.23 E4.1031
+G1  X96.69 Y78.00 E4.1129
+G1  X96.62 Y78.76 E4.1227
+G1  X96.49 Y79.52 E4.1325
+G1  X96.32 Y80.27 E4.1423
+G1  X96.10 Y81.00 E4.1520
+G1  X95.83 Y81.72 E4.1618
+G1  X95.51 Y82.42 E4.1716
+G1  X95.15 Y83.10 E4.1814
+G1  X94.74 Y83.75 E4.1912
+G1  X94.30 Y84.37 E4.2010
+G1  X93.81 Y84.96 E4.2108
+G1  X93.33 Y85.48 E4.2198
+G1  X92.90 Y85.42 F4200.00
+G1  X76.13 Y71.16
+G1  F1500.00
+G1  X77.60 Y69.69 E4.2468
+G1  X78.03 Y69.29 E4.2545
+G1  X78.56 Y68.85 E4.2634
+G1  X79.12 Y68.45 E4.2724
+G1  X79.89 Y67.99 E4.2840
+G1  X75.75 Y72.13 E4.3599
+G1  X75.52 Y72.56 E4.3663
+G1  X75.21 Y73.25 E4.3761
+G1  X81.01 Y67.45 E4.4827
+G1  X81.60 Y67.23 E4.4908
+G1  X81.91 Y67.13 E4.4951
+G1  X74.89 Y74.16 E4.6240
+G1  X74.79 Y74.50 E4.6287
+G1  X74.68 Y74.95 E4.6347
+G1  X82.71 Y66.93 E4.7821
+G1  X83.43 Y66.79 E4.7916
+G1  X74.55 Y75.67 E4.9546
+G1  X74.47 Y76.33 E4.9633
+G1  X84.09 Y66.71 E5.1400
+G1  X84.71 Y66.68 E5.1480
+G1  X74.44 Y76.95 E5.3367
+G1  X74.44 Y77.54 E5.3443
+G1  X85.30 Y66.68 E5.5437
+G1  X85.85 Y66.72 E5.5508
+G1  X74.47 Y78.09 E5.7597
+G1  X74.52 Y78.63 E5.7667
+G1  X86.39 Y66.76 E5.9845
+G1  X86.89 Y66.84 E5.9911
+G1  X74.61 Y79.13 E6.2167
+G1  X74.71 Y79.61 E6.2231
+G1  X87.37 Y66.95 E6.4557
+G1  X87.84 Y67.06 E6.4620
+G1  X74.82 Y80.08 E6.7010
+G1  X74.96 Y80.53 E6.7071
+G1  X88.29 Y67.20 E6.9519
+G1  X88.72 Y67.36 E6.9578
+G1  X75.12 Y80.96 E7.2077
+G1  X75.28 Y81.38 E7.2135
+G1  X89.14 Y67.52 E7.4680
+G1  X89.54 Y67.70 E7.4738
+G1  X75.46 Y81.79 E7.7323
+G1  X75.66 Y82.17 E7.7380
+G1  X89.93 Y67.90 E8.0000
+G1  X90.31 Y68.11 E8.0056
+G1  X75.87 Y82.55 E8.2709
+G1  X76.09 Y82.91 E8.2764
+G1  X90.67 Y68.33 E8.5441
+G1  X91.02 Y68.57 E8.5496
+G1  X76.33 Y83.26 E8.8195
+G1  X76.57 Y83.61 E8.8250
+G1  X91.37 Y68.81 E9.0966
+G1  X91.69 Y69.07 E9.1020
+G1  X76.83 Y83.93 E9.3749
+G1  X77.10 Y84.25 E9.3803
+G1  X92.01 Y69.34 E9.6541
+G1  X92.31 Y69.62 E9.6595
+G1  X77.38 Y84.55 E9.9336
+G1  X77.68 Y84.84 E9.9390
+G1  X92.61 Y69.91 E10.2131
+G1  X92.89 Y70.22 E10.2185
+G1  X77.98 Y85.13 E10.4923
+G1  X78.30 Y85.40 E10.4977
+G1  X93.16 Y70.54 E10.7706
+G1  X93.42 Y70.86 E10.7760
+G1  X78.62 Y85.66 E11.0477
+G1  X78.96 Y85.90 E11.0531
+G1  X93.66 Y71.20 E11.3230
+G1  X93.89 Y71.55 E11.3285
+G1  X79.31 Y86.13 E11.5962
+G1  X79.68 Y86.36 E11.6018
+G1  X94.12 Y71.91 E11.8670
+G1  X94.33 Y72.29 E11.8726
+G1  X80.05 Y86.57 E12.1346
+G1  X80.44 Y86.76 E12.1403
+G1  X94.52 Y72.68 E12.3989
+G1  X94.71 Y73.09 E12.4046
+G1  X80.85 Y86.95 E12.6591
+G1  X81.26 Y87.11 E12.6650
+G1  X94.87 Y73.50 E12.9148
+G1  X95.03 Y73.94 E12.9207
+G1  X81.70 Y87.27 E13.1655
+G1  X82.14 Y87.40 E13.1716
+G1  X95.16 Y74.38 E13.4107
+G1  X95.28 Y74.85 E13.4169
+G1  X82.61 Y87.52 E13.6495
+G1  X83.10 Y87.62 E13.6559
+G1  X95.38 Y75.34 E13.8815
+G1  X95.46 Y75.84 E13.8881
+G1  X83.60 Y87.70 E14.1060
+G1  X84.13 Y87.76 E14.1129
+G1  X95.52 Y76.37 E14.3220
+G1  X95.55 Y76.93 E14.3292
+G1  X84.69 Y87.79 E14.5286
+G1  X85.27 Y87.79 E14.5362
+G1  X95.55 Y77.51 E14.7249
+G1  X95.51 Y78.13 E14.7329
+G1  X85.89 Y87.75 E14.9096
+G1  X86.56 Y87.68 E14.9182
+G1  X95.44 Y78.80 E15.0813
+G1  X95.30 Y79.52 E15.0908
+G1  X87.28 Y87.54 E15.2382
+G1  X87.73 Y87.44 E15.2442
+G1  X88.07 Y87.33 E15.2489
+G1  X95.09 Y80.31 E15.3778
+G1  X95.00 Y80.63 E15.3821
+G1  X94.78 Y81.21 E15.3902
+G1  X88.97 Y87.02 E15.4968
+G1  X89.67 Y86.71 E15.5066
+G1  X90.10 Y86.48 E15.5130
+G1  X94.24 Y82.34 E15.5890
+G1  X93.78 Y83.10 E15.6005
+G1  X93.37 Y83.66 E15.6095
+G1  X92.94 Y84.20 E15.6185
+G1  X92.54 Y84.63 E15.6261
+G1  X91.06 Y86.10 E15.6531
+G1  E14.1531 F1080.00
+G92  E0.0000
+G1  X94.66 Y86.99 F4200.00
+G1  E1.5000 F1080.00
+G1  F2100.00
+G1  X94.05 Y87.56 E1.5106
+G1  X93.35 Y88.13 E1.5221
+G1  X92.62 Y88.65 E1.5336
+G1  X91.86 Y89.13 E1.5450
+G1  X91.07 Y89.55 E1.5565
+G1  X90.25 Y89.92 E1.5680
+G1  X89.41 Y90.24 E1.5794
+G1  X88.55 Y90.50 E1.5909
+G1  X87.67 Y90.70 E1.6024
+G1  X86.79 Y90.85 E1.6138
+G1  X85.89 Y90.94 E1.6253
+G1  X84.99 Y90.97 E1.6368
+G1  X84.10 Y90.94 E1.6482
+G1  X83.20 Y90.85 E1.6597
+G1  X82.31 Y90.70 E1.6712
+G1  X81.44 Y90.50 E1.6827
+G1  X80.58 Y90.24 E1.6941
+G1  X79.74 Y89.92 E1.7056
+G1  X78.92 Y89.55 E1.7171
+G1  X78.13 Y89.13 E1.7285
+G1  X77.36 Y88.65 E1.7400
+G1  X76.63 Y88.13 E1.7515
+G1  X75.94 Y87.56 E1.7629
+G1  X75.28 Y86.94 E1.7744
+G1  X74.67 Y86.29 E1.7859
+G1  X74.10 Y85.59 E1.7973
+G1  X73.58 Y84.86 E1.8088
+G1  X73.10 Y84.10 E1.8203
+G1  X72.68 Y83.31 E1.8317
+G1  X72.31 Y82.49 E1.8432
+G1  X71.99 Y81.65 E1.8547
+G1  X71.73 Y80.79 E1.8661
+G1  X71.52 Y79.91 E1.8776
+G1  X71.38 Y79.03 E1.8891
+G1  X71.29 Y78.13 E1.9006
+G1  X71.26 Y77.23 E1.9120
+G1  X71.29 Y76.34 E1.9235
+G1  X71.38 Y75.44 E1.9350
+G1  X71.52 Y74.55 E1.9464
+G1  X71.73 Y73.68 E1.9579
+G1  X71.99 Y72.82 E1.9694
+G1  X72.31 Y71.98 E1.9808
+G1  X72.68 Y71.16 E1.9923
+G1  X73.10 Y70.37 E2.0038
+G1  X73.58 Y69.61 E2.0152
+G1  X74.10 Y68.87 E2.0267
+G1  X74.67 Y68.18 E2.0382
+G1  X75.28 Y67.52 E2.0497
+G1  X75.94 Y66.91 E2.0611
+G1  X76.63 Y66.34 E2.0726
+G1  X77.36 Y65.82 E2.0841
+G1  X78.13 Y65.34 E2.0955
+G1  X78.92 Y64.92 E2.1070
+G1  X79.74 Y64.55 E2.1185
+G1  X80.58 Y64.23 E2.1299
+G1  X81.44 Y63.97 E2.1414
+G1  X82.31 Y63.77 E2.1529
+G1  X83.20 Y63.62 E2.1643
+G1  X84.10 Y63.53 E2.1758
+G1  X84.99 Y63.50 E2.1873
+G1  X85.89 Y63.53 E2.1987
+G1  X86.79 Y63.62 E2.2102
+G1  X87.67 Y63.77 E2.2217
+G1  X88.55 Y63.97 E2.2332
+G1  X89.41 Y64.23 E2.2446
+G1  X90.25 Y64.55 E2.2561
+G1  X91.07 Y64.92 E2.2676
+G1  X91.86 Y65.34 E2.2790
+G1  X92.62 Y65.82 E2.2905
+G1  X93.35 Y66.34 E2.3020
+G1  X94.05 Y66.91 E2.3134
+G1  X94.70 Y67.52 E2.3249
+G1  X95.32 Y68.18 E2.3364
+G1  X95.89 Y68.87 E2.3478
+G1  X96.41 Y69.61 E2.3593
+G1  X96.89 Y70.37 E2.3708
+G1  X97.31 Y71.16 E2.3822
+G1  X97.68 Y71.98 E2.3937
+G1  X98.00 Y72.82 E2.4052
+G1  X98.26 Y73.68 E2.4166
+G1  X98.46 Y74.55 E2.4281
+G1  X98.61 Y75.44 E2.4396
+G1  X98.70 Y76.34 E2.4511
+G1  X98.73 Y77.23 E2.4625
+G1  X98.70 Y78.13 E2.4740
+G1  X98.61 Y79.03 E2.4855
+G1  X98.46 Y79.91 E2.4969
+G1  X98.26 Y80.79 E2.5084
+G1  X98.00 Y81.65 E2.5199
+G1  X97.68 Y82.49 E2.5313
+G1  X97.31 Y83.31 E2.5428
+G1  X96.89 Y84.10 E2.5543
+G1  X96.41 Y84.86 E2.5657
+G1  X95.89 Y85.59 E2.5772
+G1  X95.32 Y86.29 E2.5887
+G1  X94.70 Y86.95 E2.6002
+G1  X94.38 Y86.69 F4200.00
+G1  F1260.00
+G1  X93.78 Y87.25 E2.6107
+G1  X93.11 Y87.80 E2.6218
+G1  X92.40 Y88.31 E2.6329
+G1  X91.66 Y88.77 E2.6441
+G1  X90.89 Y89.18 E2.6552
+G1  X90.09 Y89.54 E2.6663
+G1  X89.28 Y89.85 E2.6774
+G1  X88.44 Y90.11 E2.6886
+G1  X87.59 Y90.30 E2.6997
+G1  X86.73 Y90.44 E2.7108
+G1  X85.86 Y90.53 E2.7220
+G1  X84.99 Y90.56 E2.7331
+G1  X84.12 Y90.53 E2.7442
+G1  X83.25 Y90.44 E2.7553
+G1  X82.39 Y90.30 E2.7665
+G1  X81.54 Y90.11 E2.7776
+G1  X80.71 Y89.85 E2.7887
+G1  X79.89 Y89.54 E2.7999
+G1  X79.10 Y89.18 E2.8110
+G1  X78.33 Y88.77 E2.8221
+G1  X77.59 Y88.31 E2.8332
+G1  X76.88 Y87.80 E2.8444
+G1  X76.21 Y87.25 E2.8555
+G1  X75.57 Y86.66 E2.8666
+G1  X74.97 Y86.02 E2.8777
+G1  X74.42 Y85.35 E2.8889
+G1  X73.91 Y84.64 E2.9000
+G1  X73.45 Y83.90 E2.9111
+G1  X73.04 Y83.13 E2.9223
+G1  X72.68 Y82.33 E2.9334
+G1  X72.38 Y81.52 E2.9445
+G1  X72.12 Y80.68 E2.9557
+G1  X71.93 Y79.83 E2.9668
+G1  X71.78 Y78.97 E2.9779
+G1  X71.70 Y78.11 E2.9890
+G1  X71.67 Y77.23 E3.0002
+G1  X71.70 Y76.36 E3.0113
+G1  X71.78 Y75.50 E3.0224
+G1  X71.93 Y74.63 E3.0336
+G1  X72.12 Y73.79 E3.0447
+G1  X72.38 Y72.95 E3.0558
+G1  X72.68 Y72.13 E3.0669
+G1  X73.04 Y71.34 E3.0781
+G1  X73.45 Y70.57 E3.0892
+G1  X73.91 Y69.83 E3.1003
+G1  X74.42 Y69.12 E3.1115
+G1  X74.97 Y68.45 E3.1226
+G1  X75.57 Y67.81 E3.1337
+G1  X76.21 Y67.22 E3.1448
+G1  X76.88 Y66.66 E3.1560
+G1  X77.59 Y66.15 E3.1671
+G1  X78.33 Y65.69 E3.1782
+G1  X79.10 Y65.28 E3.1893
+G1  X79.89 Y64.92 E3.2005
+G1  X80.71 Y64.62 E3.2116
+G1  X81.54 Y64.36 E3.2227
+G1  X82.39 Y64.16 E3.2339
+G1  X83.25 Y64.02 E3.2450
+G1  X84.12 Y63.94 E3.2561
+G1  X84.99 Y63.91 E3.2673
+G1  X85.86 Y63.94 E3.2784
+G1  X86.73 Y64.02 E3.2895
+G1  X87.59 Y64.16 E3.3006
+G1  X88.44 Y64.36 E3.3118
+G1  X89.28 Y64.62 E3.3229
+G1  X90.09 Y64.92 E3.3340
+G1  X90.89 Y65.28 E3.3452
+G1  X91.66 Y65.69 E3.3563
+G1  X92.40 Y66.15 E3.3674
+G1  X93.11 Y66.66 E3.3785
+G1  X93.78 Y67.22 E3.3897
+G1  X94.42 Y67.81 E3.4008
+G1  X95.01 Y68.45 E3.4119
+G1  X95.56 Y69.12 E3.4230
+G1  X96.07 Y69.83 E3.4342
+G1  X96.53 Y70.57 E3.4453
+G1  X96.94 Y71.34 E3.4564
+G1  X97.30 Y72.13 E3.4676
+G1  X97.61 Y72.95 E3.4787
+G1  X97.86 Y73.79 E3.4898
+G1  X98.06 Y74.63 E3.5009
+G1  X98.20 Y75.50 E3.5121
+G1  X98.29 Y76.36 E3.5232
+G1  X98.32 Y77.23 E3.5343
+G1  X98.29 Y78.11 E3.5455
+G1  X98.20 Y78.97 E3.5566
+G1  X98.06 Y79.83 E3.5677
+G1  X97.86 Y80.68 E3.5788
+G1  X97.61 Y81.52 E3.5900
+G1  X97.30 Y82.33 E3.6011
+G1  X96.94 Y83.13 E3.6122
+G1  X96.53 Y83.90 E3.6234
+G1  X96.07 Y84.64 E3.6345
+G1  X95.56 Y85.35 E3.6456
+G1  X95.01 Y86.02 E3.6567
+G1  X94.42 Y86.65 E3.6678
+G1  X94.48 Y87.08 F4200.00
+G1  E2.1678 F1080.00
+G92  E0.0000
+G1  X81.96 Y63.43 F4200.00
+G1  E1.5000 F1080.00
+G1  F1200.00
+G1  X81.33 Y63.58 E1.5083
+G1  X80.45 Y63.85 E1.5201
+G1  X79.58 Y64.17 E1.5319
+G1  X78.74 Y64.55 E1.5437
+G1  X77.92 Y64.99 E1.5555
+G1  X77.14 Y65.48 E1.5673
+G1  X76.39 Y66.02 E1.5791
+G1  X75.67 Y66.60 E1.5909
+G1  X75.00 Y67.24 E1.6027
+G1  X74.55 Y67.71 E1.6110
+G1  X74.54 Y67.23 E1.6170
+G1  X74.40 Y66.72 E1.6239
+G1  X74.15 Y66.37 E1.6293
+G1  X73.90 Y66.16 E1.6335
+G1  X71.42 Y64.73 E1.6700
+G1  X71.94 Y64.18 E1.6797
+G1  X72.60 Y63.56 E1.6913
+G1  X73.28 Y62.96 E1.7029
+G1  X74.00 Y62.41 E1.7144
+G1  X74.74 Y61.88 E1.7260
+G1  X75.50 Y61.40 E1.7376
+G1  X76.29 Y60.95 E1.7491
+G1  X77.10 Y60.55 E1.7607
+G1  X77.93 Y60.18 E1.7723
+G1  X78.77 Y59.85 E1.7838
+G1  X79.63 Y59.57 E1.7954
+G1  X80.51 Y59.33 E1.8069
+G1  X80.95 Y59.23 E1.8128
+G1  X80.95 Y62.09 E1.8493
+G1  X81.01 Y62.41 E1.8535
+G1  X81.19 Y62.80 E1.8590
+G1  X81.56 Y63.18 E1.8658
+G1  X81.91 Y63.40 E1.8710
+G1  X88.06 Y63.44 F4200.00
+G1  F1200.00
+G1  X88.59 Y63.04 E1.8795
+G1  X88.82 Y62.76 E1.8842
+G1  X88.97 Y62.44 E1.8887
+G1  X89.03 Y62.11 E1.8930
+G1  X89.03 Y59.23 E1.9297
+G1  X89.48 Y59.33 E1.9356
+G1  X90.35 Y59.57 E1.9471
+G1  X91.21 Y59.85 E1.9587
+G1  X92.06 Y60.18 E1.9702
+G1  X92.89 Y60.55 E1.9818
+G1  X93.70 Y60.95 E1.9934
+G1  X94.48 Y61.40 E2.0049
+G1  X95.25 Y61.88 E2.0165
+G1  X95.99 Y62.41 E2.0280
+G1  X96.70 Y62.96 E2.0396
+G1  X97.39 Y63.56 E2.0512
+G1  X98.05 Y64.18 E2.0627
+G1  X98.57 Y64.73 E2.0724
+G1  X96.09 Y66.16 E2.1090
+G1  X95.84 Y66.37 E2.1131
+G1  X95.59 Y66.72 E2.1186
+G1  X95.44 Y67.23 E2.1255
+G1  X95.43 Y67.71 E2.1315
+G1  X94.99 Y67.24 E2.1398
+G1  X94.32 Y66.60 E2.1516
+G1  X93.60 Y66.02 E2.1634
+G1  X92.85 Y65.48 E2.1752
+G1  X92.06 Y64.99 E2.1870
+G1  X91.25 Y64.55 E2.1988
+G1  X90.40 Y64.17 E2.2106
+G1  X89.54 Y63.85 E2.2224
+G1  X88.65 Y63.58 E2.2342
+G1  X88.12 Y63.45 E2.2413
+G1  E0.7413 F1080.00
+G92  E0.0000
+G1  X98.46 Y72.95 F4200.00
+G1  E1.5000 F1080.00
+G1  F1200.00
+G1  X98.88 Y73.18 E1.5060
+G1  X99.40 Y73.31 E1.5129
+G1  X99.82 Y73.27 E1.5184
+G1  X100.13 Y73.16 E1.5225
+G1  X102.61 Y71.73 E1.5591
+G1  X102.90 Y72.75 E1.5726
+G1  X103.10 Y73.63 E1.5842
+G1  X103.25 Y74.52 E1.5957
+G1  X103.36 Y75.42 E1.6073
+G1  X103.43 Y76.33 E1.6189
+G1  X103.45 Y77.12 E1.6290
+G1  X103.43 Y78.14 E1.6420
+G1  X103.36 Y79.04 E1.6535
+G1  X103.25 Y79.94 E1.6651
+G1  X103.10 Y80.83 E1.6767
+G1  X102.90 Y81.72 E1.6882
+G1  X102.61 Y82.74 E1.7018
+G1  X100.13 Y81.31 E1.7384
+G1  X99.82 Y81.20 E1.7425
+G1  X99.48 Y81.16 E1.7470
+G1  X99.10 Y81.21 E1.7518
+G1  X98.47 Y81.48 E1.7605
+G1  X98.65 Y80.89 E1.7683
+G1  X98.86 Y79.99 E1.7801
+G1  X99.01 Y79.08 E1.7919
+G1  X99.10 Y78.16 E1.8038
+G1  X99.13 Y77.23 E1.8156
+G1  X99.10 Y76.31 E1.8274
+G1  X99.01 Y75.39 E1.8392
+G1  X98.86 Y74.47 E1.8510
+G1  X98.65 Y73.57 E1.8628
+G1  X98.48 Y73.01 E1.8703
+G1  E0.3703 F1080.00
+G92  E0.0000
+G1  X95.43 Y86.76 F4200.00
+G1  E1.5000 F1080.00
+G1  F1200.00
+G1  X95.44 Y87.23 E1.5060
+G1  X95.59 Y87.75 E1.5129
+G1  X95.84 Y88.10 E1.5184
+G1  X96.09 Y88.30 E1.5225
+G1  X98.57 Y89.74 E1.5591
+G1  X98.05 Y90.29 E1.5688
+G1  X97.39 Y90.91 E1.5803
+G1  X96.70 Y91.50 E1.5919
+G1  X95.99 Y92.06 E1.6034
+G1  X95.25 Y92.58 E1.6150
+G1  X94.48 Y93.07 E1.6266
+G1  X93.70 Y93.51 E1.6381
+G1  X92.89 Y93.92 E1.6497
+G1  X92.06 Y94.29 E1.6613
+G1  X91.21 Y94.61 E1.6728
+G1  X90.35 Y94.90 E1.6844
+G1  X89.48 Y95.14 E1.6960
+G1  X89.03 Y95.24 E1.7018
+G1  X89.03 Y92.38 E1.7383
+G1  X88.98 Y92.06 E1.7425
+G1  X88.80 Y91.67 E1.7479
+G1  X88.43 Y91.28 E1.7548
+G1  X88.02 Y91.04 E1.7608
+G1  X88.65 Y90.89 E1.7691
+G1  X89.54 Y90.62 E1.7809
+G1  X90.40 Y90.30 E1.7927
+G1  X91.25 Y89.91 E1.8045
+G1  X92.06 Y89.48 E1.8163
+G1  X92.85 Y88.99 E1.8281
+G1  X93.60 Y88.45 E1.8399
+G1  X94.32 Y87.86 E1.8517
+G1  X94.99 Y87.23 E1.8636
+G1  X95.39 Y86.80 E1.8710
+G1  E0.3710 F1080.00
+G92  E0.0000
+G1  X81.93 Y91.03 F4200.00
+G1  E1.5000 F1080.00
+G1  F1200.00
+G1  X81.40 Y91.43 E1.5085
+G1  X81.17 Y91.71 E1.5131
+G1  X81.01 Y92.06 E1.5180
+G1  X80.95 Y92.38 E1.5222
+G1  X80.95 Y95.24 E1.5587
+G1  X80.51 Y95.14 E1.5645
+G1  X79.63 Y94.90 E1.5761
+G1  X78.77 Y94.61 E1.5876
+G1  X78.04 Y94.33 E1.5978
+G1  X77.10 Y93.92 E1.6108
+G1  X76.29 Y93.51 E1.6223
+G1  X75.50 Y93.07 E1.6339
+G1  X74.74 Y92.58 E1.6455
+G1  X74.00 Y92.06 E1.6570
+G1  X73.28 Y91.50 E1.6686
+G1  X72.60 Y90.91 E1.6802
+G1  X71.94 Y90.29 E1.6917
+G1  X71.42 Y89.74 E1.7014
+G1  X73.90 Y88.30 E1.7380
+G1  X74.15 Y88.10 E1.7421
+G1  X74.40 Y87.75 E1.7476
+G1  X74.54 Y87.23 E1.7544
+G1  X74.55 Y86.76 E1.7605
+G1  X75.00 Y87.23 E1.7687
+G1  X75.67 Y87.86 E1.7805
+G1  X76.39 Y88.45 E1.7924
+G1  X77.14 Y88.99 E1.8042
+G1  X77.92 Y89.48 E1.8160
+G1  X78.74 Y89.91 E1.8278
+G1  X79.58 Y90.30 E1.8396
+G1  X80.45 Y90.62 E1.8514
+G1  X81.33 Y90.89 E1.8632
+G1  X81.87 Y91.02 E1.8703
+G1  E0.3703 F1080.00
+G92  E0.0000
+G1  X71.53 Y81.53 F4200.00
+G1  E1.5000 F1080.00
+G1  F1200.00
+G1  X71.12 Y81.29 E1.5060
+G1  X70.59 Y81.15 E1.5130
+G1  X70.16 Y81.20 E1.5185
+G1  X69.86 Y81.31 E1.5226
+G1  X67.38 Y82.74 E1.5592
+G1  X67.09 Y81.72 E1.5728
+G1  X66.89 Y80.83 E1.5843
+G1  X66.73 Y79.94 E1.5959
+G1  X66.62 Y79.04 E1.6074
+G1  X66.55 Y78.14 E1.6190
+G1  X66.53 Y77.23 E1.6306
+G1  X66.55 Y76.33 E1.6421
+G1  X66.62 Y75.42 E1.6537
+G1  X66.73 Y74.52 E1.6653
+G1  X66.89 Y73.63 E1.6768
+G1  X67.09 Y72.75 E1.6884
+G1  X67.38 Y71.73 E1.7019
+G1  X69.86 Y73.16 E1.7385
+G1  X70.16 Y73.27 E1.7427
+G1  X70.54 Y73.31 E1.7475
+G1  X70.90 Y73.25 E1.7522
+G1  X71.51 Y72.99 E1.7607
+G1  X71.34 Y73.57 E1.7685
+G1  X71.13 Y74.47 E1.7803
+G1  X70.97 Y75.39 E1.7921
+G1  X70.88 Y76.31 E1.8039
+G1  X70.85 Y77.23 E1.8157
+G1  X70.88 Y78.16 E1.8275
+G1  X70.97 Y79.08 E1.8393
+G1  X71.13 Y79.99 E1.8511
+G1  X71.34 Y80.89 E1.8629
+G1  X71.51 Y81.47 E1.8706
+G1  X67.15 Y83.34 F4200.00
+G1  F2100.00
+G1  X66.94 Y82.71 E1.8791
+G1  X66.69 Y81.82 E1.8909
+G1  X66.49 Y80.91 E1.9028
+G1  X66.33 Y80.00 E1.9146
+G1  X66.22 Y79.08 E1.9264
+G1  X66.15 Y78.16 E1.9382
+G1  X66.13 Y77.23 E1.9500
+G1  X66.15 Y76.31 E1.9619
+G1  X66.22 Y75.38 E1.9737
+G1  X66.33 Y74.46 E1.9855
+G1  X66.49 Y73.55 E1.9973
+G1  X66.69 Y72.65 E2.0091
+G1  X66.94 Y71.76 E2.0210
+G1  X67.15 Y71.12 E2.0295
+G1  X70.03 Y72.79 E2.0720
+G1  X70.25 Y72.87 E2.0750
+G1  X70.53 Y72.90 E2.0785
+G1  X70.79 Y72.86 E2.0819
+G1  X71.17 Y72.69 E2.0872
+G1  X71.40 Y72.47 E2.0912
+G1  X71.52 Y72.27 E2.0943
+G1  X71.72 Y71.74 E2.1015
+G1  X72.11 Y70.88 E2.1135
+G1  X72.55 Y70.05 E2.1255
+G1  X73.05 Y69.25 E2.1375
+G1  X73.59 Y68.49 E2.1495
+G1  X73.95 Y68.05 E2.1568
+G1  X74.07 Y67.84 E2.1599
+G1  X74.14 Y67.56 E2.1635
+G1  X74.14 Y67.30 E2.1669
+G1  X74.02 Y66.90 E2.1721
+G1  X73.85 Y66.65 E2.1761
+G1  X73.66 Y66.50 E2.1791
+G1  X70.78 Y64.83 E2.2215
+G1  X71.01 Y64.56 E2.2261
+G1  X71.65 Y63.89 E2.2379
+G1  X72.32 Y63.25 E2.2497
+G1  X73.02 Y62.65 E2.2615
+G1  X73.75 Y62.08 E2.2734
+G1  X74.51 Y61.55 E2.2852
+G1  X75.29 Y61.05 E2.2970
+G1  X76.10 Y60.59 E2.3088
+G1  X76.93 Y60.18 E2.3206
+G1  X77.77 Y59.80 E2.3325
+G1  X78.64 Y59.47 E2.3443
+G1  X79.52 Y59.18 E2.3561
+G1  X80.41 Y58.93 E2.3679
+G1  X81.36 Y58.72 E2.3804
+G1  X81.36 Y62.05 E2.4230
+G1  X81.40 Y62.29 E2.4260
+G1  X81.53 Y62.57 E2.4299
+G1  X81.82 Y62.86 E2.4351
+G1  X82.04 Y63.00 E2.4386
+G1  X82.29 Y63.07 E2.4419
+G1  X82.55 Y63.08 E2.4451
+G1  X83.12 Y62.99 E2.4525
+G1  X84.05 Y62.90 E2.4645
+G1  X84.99 Y62.87 E2.4765
+G1  X85.93 Y62.90 E2.4885
+G1  X86.87 Y62.99 E2.5005
+G1  X87.43 Y63.08 E2.5077
+G1  X87.67 Y63.08 E2.5108
+G1  X87.97 Y62.99 E2.5148
+G1  X88.31 Y62.75 E2.5201
+G1  X88.47 Y62.54 E2.5235
+G1  X88.58 Y62.31 E2.5267
+G1  X88.63 Y62.06 E2.5299
+G1  X88.63 Y58.72 E2.5726
+G1  X89.58 Y58.93 E2.5850
+G1  X90.47 Y59.18 E2.5968
+G1  X91.35 Y59.47 E2.6087
+G1  X92.21 Y59.80 E2.6205
+G1  X93.06 Y60.18 E2.6323
+G1  X93.89 Y60.59 E2.6441
+G1  X94.69 Y61.05 E2.6559
+G1  X95.48 Y61.55 E2.6677
+G1  X96.23 Y62.08 E2.6796
+G1  X96.96 Y62.65 E2.6914
+G1  X97.66 Y63.25 E2.7032
+G1  X98.33 Y63.89 E2.7150
+G1  X98.97 Y64.56 E2.7268
+G1  X99.20 Y64.83 E2.7314
+G1  X96.32 Y66.50 E2.7739
+G1  X96.14 Y66.65 E2.7769
+G1  X95.96 Y66.90 E2.7808
+G1  X95.85 Y67.30 E2.7861
+G1  X95.84 Y67.56 E2.7895
+G1  X95.91 Y67.84 E2.7931
+G1  X96.03 Y68.05 E2.7962
+G1  X96.39 Y68.49 E2.8034
+G1  X96.94 Y69.25 E2.8154
+G1  X97.44 Y70.05 E2.8274
+G1  X97.88 Y70.88 E2.8394
+G1  X98.27 Y71.74 E2.8514
+G1  X98.47 Y72.27 E2.8586
+G1  X98.59 Y72.47 E2.8617
+G1  X98.79 Y72.67 E2.8654
+G1  X99.03 Y72.80 E2.8688
+G1  X99.43 Y72.90 E2.8740
+G1  X99.73 Y72.87 E2.8779
+G1  X99.96 Y72.79 E2.8810
+G1  X102.84 Y71.12 E2.9235
+G1  X103.05 Y71.76 E2.9320
+G1  X103.30 Y72.65 E2.9438
+G1  X103.50 Y73.55 E2.9556
+G1  X103.66 Y74.46 E2.9674
+G1  X103.77 Y75.38 E2.9792
+G1  X103.84 Y76.31 E2.9911
+G1  X103.86 Y77.12 E3.0014
+G1  X103.84 Y78.16 E3.0147
+G1  X103.77 Y79.08 E3.0265
+G1  X103.66 Y80.00 E3.0383
+G1  X103.50 Y80.91 E3.0501
+G1  X103.30 Y81.82 E3.0620
+G1  X103.05 Y82.71 E3.0738
+G1  X102.84 Y83.34 E3.0823
+G1  X99.96 Y81.68 E3.1248
+G1  X99.73 Y81.60 E3.1278
+G1  X99.48 Y81.57 E3.1311
+G1  X99.21 Y81.61 E3.1346
+G1  X98.82 Y81.77 E3.1400
+G1  X98.59 Y81.99 E3.1440
+G1  X98.47 Y82.20 E3.1471
+G1  X98.27 Y82.73 E3.1544
+G1  X97.88 Y83.59 E3.1663
+G1  X97.44 Y84.42 E3.1784
+G1  X96.94 Y85.22 E3.1904
+G1  X96.39 Y85.98 E3.2023
+G1  X96.03 Y86.42 E3.2096
+G1  X95.91 Y86.63 E3.2127
+G1  X95.84 Y86.90 E3.2163
+G1  X95.85 Y87.17 E3.2197
+G1  X95.96 Y87.57 E3.2250
+G1  X96.14 Y87.82 E3.2289
+G1  X96.32 Y87.97 E3.2319
+G1  X99.20 Y89.63 E3.2744
+G1  X98.97 Y89.91 E3.2790
+G1  X98.33 Y90.57 E3.2907
+G1  X97.66 Y91.21 E3.3026
+G1  X96.96 Y91.82 E3.3144
+G1  X96.23 Y92.39 E3.3262
+G1  X95.48 Y92.92 E3.3380
+G1  X94.69 Y93.42 E3.3498
+G1  X93.89 Y93.87 E3.3617
+G1  X93.06 Y94.29 E3.3735
+G1  X92.21 Y94.66 E3.3853
+G1  X91.35 Y95.00 E3.3971
+G1  X90.47 Y95.29 E3.4089
+G1  X89.58 Y95.54 E3.4207
+G1  X88.63 Y95.75 E3.4332
+G1  X88.63 Y92.41 E3.4758
+G1  X88.59 Y92.18 E3.4788
+G1  X88.46 Y91.90 E3.4827
+G1  X88.17 Y91.61 E3.4880
+G1  X87.94 Y91.47 E3.4914
+G1  X87.67 Y91.39 E3.4950
+G1  X87.43 Y91.39 E3.4981
+G1  X86.87 Y91.48 E3.5053
+G1  X85.93 Y91.57 E3.5173
+G1  X84.99 Y91.60 E3.5293
+G1  X84.05 Y91.57 E3.5413
+G1  X83.12 Y91.48 E3.5533
+G1  X82.56 Y91.39 E3.5606
+G1  X82.32 Y91.39 E3.5637
+G1  X82.01 Y91.47 E3.5677
+G1  X81.68 Y91.72 E3.5730
+G1  X81.52 Y91.93 E3.5763
+G1  X81.40 Y92.18 E3.5799
+G1  X81.36 Y92.41 E3.5829
+G1  X81.36 Y95.75 E3.6255
+G1  X80.41 Y95.54 E3.6379
+G1  X79.52 Y95.29 E3.6498
+G1  X78.64 Y95.00 E3.6616
+G1  X77.88 Y94.71 E3.6719
+G1  X76.93 Y94.29 E3.6852
+G1  X76.10 Y93.87 E3.6970
+G1  X75.29 Y93.42 E3.7088
+G1  X74.51 Y92.92 E3.7207
+G1  X73.75 Y92.39 E3.7325
+G1  X73.02 Y91.82 E3.7443
+G1  X72.32 Y91.21 E3.7561
+G1  X71.65 Y90.57 E3.7679
+G1  X71.01 Y89.91 E3.7797
+G1  X70.78 Y89.63 E3.7843
+G1  X73.66 Y87.97 E3.8268
+G1  X73.85 Y87.82 E3.8298
+G1  X74.02 Y87.57 E3.8337
+G1  X74.14 Y87.17 E3.8390
+G1  X74.14 Y86.90 E3.8424
+G1  X74.07 Y86.63 E3.8460
+G1  X73.95 Y86.42 E3.8491
+G1  X73.59 Y85.98 E3.8563
+G1  X73.05 Y85.22 E3.8683
+G1  X72.55 Y84.42 E3.8803
+G1  X72.11 Y83.59 E3.8923
+G1  X71.72 Y82.73 E3.9043
+G1  X71.52 Y82.20 E3.9116
+G1  X71.40 Y81.99 E3.9147
+G1  X71.21 Y81.81 E3.9180
+G1  X70.97 Y81.67 E3.9215
+G1  X70.56 Y81.57 E3.9269
+G1  X70.25 Y81.60 E3.9308
+G1  X70.03 Y81.68 E3.9339
+G1  X67.20 Y83.31 E3.9756
+G1  E2.4756 F1080.00
+G92  E0.0000
+G1  X73.55 Y87.54 F4200.00
+G1  E1.5000 F1080.00
+G1  F1260.00
+G1  X73.65 Y87.39 E1.5023
+G1  X73.73 Y87.11 E1.5060
+G1  X73.73 Y86.95 E1.5081
+G1  X73.69 Y86.78 E1.5103
+G1  X73.62 Y86.65 E1.5122
+G1  X73.27 Y86.23 E1.5192
+G1  X72.71 Y85.44 E1.5315
+G1  X72.20 Y84.62 E1.5439
+G1  X71.74 Y83.77 E1.5562
+G1  X71.34 Y82.89 E1.5685
+G1  X71.15 Y82.38 E1.5755
+G1  X71.07 Y82.25 E1.5774
+G1  X70.96 Y82.14 E1.5794
+G1  X70.81 Y82.05 E1.5816
+G1  X70.53 Y81.98 E1.5854
+G1  X70.35 Y82.00 E1.5877
+G1  X70.20 Y82.05 E1.5896
+G1  X66.93 Y83.94 E1.6379
+G1  X66.55 Y82.83 E1.6529
+G1  X66.30 Y81.92 E1.6650
+G1  X66.09 Y80.99 E1.6771
+G1  X65.93 Y80.06 E1.6891
+G1  X65.81 Y79.12 E1.7012
+G1  X65.74 Y78.18 E1.7133
+G1  X65.72 Y77.23 E1.7254
+G1  X65.74 Y76.29 E1.7374
+G1  X65.81 Y75.34 E1.7495
+G1  X65.93 Y74.41 E1.7616
+G1  X66.09 Y73.47 E1.7737
+G1  X66.30 Y72.55 E1.7857
+G1  X66.55 Y71.64 E1.7978
+G1  X66.93 Y70.53 E1.8128
+G1  X70.20 Y72.42 E1.8611
+G1  X70.35 Y72.47 E1.8630
+G1  X70.52 Y72.49 E1.8652
+G1  X70.68 Y72.46 E1.8672
+G1  X70.94 Y72.35 E1.8709
+G1  X71.07 Y72.22 E1.8733
+G1  X71.15 Y72.09 E1.8752
+G1  X71.34 Y71.58 E1.8822
+G1  X71.74 Y70.70 E1.8945
+G1  X72.20 Y69.85 E1.9069
+G1  X72.71 Y69.02 E1.9192
+G1  X73.27 Y68.24 E1.9316
+G1  X73.62 Y67.82 E1.9385
+G1  X73.69 Y67.69 E1.9404
+G1  X73.73 Y67.52 E1.9427
+G1  X73.73 Y67.36 E1.9447
+G1  X73.65 Y67.08 E1.9484
+G1  X73.55 Y66.93 E1.9507
+G1  X73.43 Y66.83 E1.9527
+G1  X70.16 Y64.94 E2.0009
+G1  X70.71 Y64.29 E2.0119
+G1  X71.36 Y63.60 E2.0239
+G1  X72.05 Y62.95 E2.0360
+G1  X72.77 Y62.33 E2.0481
+G1  X73.51 Y61.75 E2.0601
+G1  X74.29 Y61.21 E2.0722
+G1  X75.08 Y60.70 E2.0843
+G1  X75.91 Y60.24 E2.0964
+G1  X76.75 Y59.81 E2.1085
+G1  X77.62 Y59.43 E2.1205
+G1  X78.50 Y59.09 E2.1326
+G1  X79.40 Y58.79 E2.1447
+G1  X80.31 Y58.54 E2.1567
+G1  X81.23 Y58.33 E2.1688
+G1  X81.77 Y58.24 E2.1758
+G1  X81.77 Y62.02 E2.2240
+G1  X81.79 Y62.17 E2.2260
+G1  X81.87 Y62.33 E2.2283
+G1  X82.07 Y62.54 E2.2320
+G1  X82.21 Y62.63 E2.2340
+G1  X82.36 Y62.67 E2.2360
+G1  X82.52 Y62.68 E2.2381
+G1  X83.06 Y62.59 E2.2451
+G1  X84.03 Y62.49 E2.2575
+G1  X84.99 Y62.46 E2.2698
+G1  X85.96 Y62.49 E2.2822
+G1  X86.92 Y62.59 E2.2945
+G1  X87.46 Y62.67 E2.3014
+G1  X87.61 Y62.67 E2.3034
+G1  X87.79 Y62.62 E2.3057
+G1  X88.02 Y62.45 E2.3094
+G1  X88.12 Y62.33 E2.3115
+G1  X88.19 Y62.18 E2.3135
+G1  X88.22 Y62.02 E2.3155
+G1  X88.22 Y58.24 E2.3639
+G1  X88.66 Y58.31 E2.3695
+G1  X89.68 Y58.54 E2.3829
+G1  X90.59 Y58.79 E2.3949
+G1  X91.49 Y59.09 E2.4070
+G1  X92.37 Y59.43 E2.4191
+G1  X93.23 Y59.81 E2.4312
+G1  X94.08 Y60.24 E2.4432
+G1  X94.90 Y60.70 E2.4553
+G1  X95.70 Y61.21 E2.4674
+G1  X96.48 Y61.75 E2.4795
+G1  X97.22 Y62.33 E2.4915
+G1  X97.94 Y62.95 E2.5036
+G1  X98.62 Y63.60 E2.5157
+G1  X99.27 Y64.29 E2.5278
+G1  X99.83 Y64.94 E2.5387
+G1  X96.56 Y66.83 E2.5870
+G1  X96.44 Y66.93 E2.5889
+G1  X96.33 Y67.08 E2.5912
+G1  X96.26 Y67.36 E2.5949
+G1  X96.25 Y67.52 E2.5969
+G1  X96.29 Y67.69 E2.5992
+G1  X96.37 Y67.82 E2.6011
+G1  X96.71 Y68.24 E2.6081
+G1  X97.28 Y69.02 E2.6204
+G1  X97.79 Y69.85 E2.6327
+G1  X98.25 Y70.70 E2.6451
+G1  X98.64 Y71.58 E2.6574
+G1  X98.84 Y72.09 E2.6644
+G1  X98.91 Y72.22 E2.6663
+G1  X99.04 Y72.34 E2.6685
+G1  X99.18 Y72.42 E2.6706
+G1  X99.46 Y72.49 E2.6743
+G1  X99.64 Y72.47 E2.6766
+G1  X99.78 Y72.42 E2.6785
+G1  X103.06 Y70.53 E2.7268
+G1  X103.44 Y71.64 E2.7418
+G1  X103.69 Y72.55 E2.7539
+G1  X103.90 Y73.47 E2.7660
+G1  X104.06 Y74.41 E2.7780
+G1  X104.18 Y75.34 E2.7901
+G1  X104.25 Y76.29 E2.8022
+G1  X104.27 Y77.12 E2.8128
+G1  X104.25 Y78.18 E2.8263
+G1  X104.18 Y79.12 E2.8384
+G1  X104.06 Y80.06 E2.8505
+G1  X103.90 Y80.99 E2.8625
+G1  X103.69 Y81.92 E2.8746
+G1  X103.44 Y82.83 E2.8867
+G1  X103.06 Y83.94 E2.9017
+G1  X99.78 Y82.05 E2.9500
+G1  X99.64 Y82.00 E2.9519
+G1  X99.49 Y81.98 E2.9539
+G1  X99.31 Y82.00 E2.9561
+G1  X99.05 Y82.12 E2.9598
+G1  X98.91 Y82.25 E2.9622
+G1  X98.84 Y82.38 E2.9641
+G1  X98.64 Y82.89 E2.9711
+G1  X98.25 Y83.77 E2.9834
+G1  X97.79 Y84.62 E2.9958
+G1  X97.28 Y85.44 E3.0081
+G1  X96.71 Y86.23 E3.0204
+G1  X96.37 Y86.65 E3.0274
+G1  X96.29 Y86.78 E3.0293
+G1  X96.25 Y86.95 E3.0315
+G1  X96.26 Y87.11 E3.0336
+G1  X96.33 Y87.39 E3.0373
+G1  X96.44 Y87.54 E3.0396
+G1  X96.56 Y87.63 E3.0415
+G1  X99.83 Y89.52 E3.0898
+G1  X99.27 Y90.18 E3.1007
+G1  X98.62 Y90.86 E3.1128
+G1  X97.94 Y91.52 E3.1249
+G1  X97.22 Y92.13 E3.1370
+G1  X96.48 Y92.72 E3.1490
+G1  X95.70 Y93.26 E3.1611
+G1  X94.90 Y93.77 E3.1732
+G1  X94.08 Y94.23 E3.1853
+G1  X93.23 Y94.66 E3.1973
+G1  X92.37 Y95.04 E3.2094
+G1  X91.49 Y95.38 E3.2215
+G1  X90.59 Y95.68 E3.2335
+G1  X89.68 Y95.93 E3.2456
+G1  X88.75 Y96.14 E3.2577
+G1  X88.22 Y96.23 E3.2646
+G1  X88.22 Y92.45 E3.3129
+G1  X88.19 Y92.30 E3.3148
+G1  X88.12 Y92.13 E3.3172
+G1  X87.92 Y91.93 E3.3208
+G1  X87.78 Y91.84 E3.3229
+G1  X87.61 Y91.79 E3.3251
+G1  X87.46 Y91.79 E3.3271
+G1  X86.92 Y91.88 E3.3340
+G1  X85.96 Y91.98 E3.3464
+G1  X84.99 Y92.01 E3.3587
+G1  X84.03 Y91.98 E3.3710
+G1  X83.06 Y91.88 E3.3834
+G1  X82.53 Y91.79 E3.3903
+G1  X82.38 Y91.79 E3.3923
+G1  X82.20 Y91.85 E3.3946
+G1  X81.97 Y92.02 E3.3983
+G1  X81.86 Y92.14 E3.4004
+G1  X81.79 Y92.30 E3.4026
+G1  X81.77 Y92.45 E3.4045
+G1  X81.77 Y96.23 E3.4528
+G1  X81.23 Y96.14 E3.4597
+G1  X80.31 Y95.93 E3.4718
+G1  X79.40 Y95.68 E3.4838
+G1  X78.50 Y95.38 E3.4959
+G1  X77.72 Y95.08 E3.5065
+G1  X76.75 Y94.66 E3.5201
+G1  X75.91 Y94.23 E3.5321
+G1  X75.08 Y93.77 E3.5442
+G1  X74.29 Y93.26 E3.5563
+G1  X73.51 Y92.72 E3.5684
+G1  X72.77 Y92.13 E3.5804
+G1  X72.05 Y91.52 E3.5925
+G1  X71.36 Y90.86 E3.6046
+G1  X70.71 Y90.18 E3.6166
+G1  X70.16 Y89.52 E3.6276
+G1  X73.43 Y87.63 E3.6758
+G1  X73.50 Y87.58 E3.6770
+G1  X73.72 Y87.58 F4200.00
+G1  X73.64 Y88.64
+G1  F1500.00
+G1  X72.21 Y90.07 E3.7029
+G1  X72.51 Y90.35 E3.7081
+G1  X75.08 Y87.78 E3.7547
+G1  X75.38 Y88.06 E3.7600
+G1  X72.80 Y90.63 E3.8066
+G1  X73.11 Y90.90 E3.8119
+G1  X75.69 Y88.33 E3.8586
+G1  X76.01 Y88.59 E3.8638
+G1  X73.43 Y91.17 E3.9107
+G1  X73.75 Y91.43 E3.9159
+G1  X76.33 Y88.84 E3.9629
+G1  X76.67 Y89.08 E3.9682
+G1  X74.07 Y91.68 E4.0153
+G1  X74.40 Y91.93 E4.0206
+G1  X77.01 Y89.32 E4.0679
+G1  X77.37 Y89.54 E4.0733
+G1  X74.74 Y92.16 E4.1209
+G1  X75.09 Y92.40 E4.1262
+G1  X77.72 Y89.76 E4.1740
+G1  X78.10 Y89.97 E4.1794
+G1  X75.44 Y92.62 E4.2276
+G1  X75.80 Y92.84 E4.2330
+G1  X78.48 Y90.17 E4.2815
+G1  X78.87 Y90.35 E4.2870
+G1  X76.17 Y93.05 E4.3359
+G1  X76.55 Y93.25 E4.3414
+G1  X79.27 Y90.53 E4.3907
+G1  X79.68 Y90.70 E4.3964
+G1  X76.93 Y93.45 E4.4463
+G1  X77.32 Y93.64 E4.4518
+G1  X80.10 Y90.86 E4.5022
+G1  X80.53 Y91.01 E4.5080
+G1  X77.72 Y93.81 E4.5589
+G1  X78.12 Y93.99 E4.5645
+G1  X80.97 Y91.14 E4.6162
+G1  X81.14 Y91.19 E4.6185
+G1  X80.87 Y91.53 E4.6240
+G1  X80.68 Y91.96 E4.6300
+G1  X80.66 Y92.03 E4.6310
+G1  X78.54 Y94.15 E4.6695
+G1  X78.96 Y94.31 E4.6752
+G1  X80.61 Y92.66 E4.7051
+G1  X80.61 Y93.24 E4.7125
+G1  X79.39 Y94.46 E4.7345
+G1  X79.83 Y94.60 E4.7404
+G1  X80.61 Y93.82 E4.7545
+G1  X80.61 Y94.40 E4.7619
+G1  X80.14 Y94.87 E4.7705
+G1  X82.64 Y90.96 F4200.00
+G1  F1200.00
+G1  X82.27 Y91.12 E4.7723
+G1  X82.15 Y91.18 E4.7729
+G1  X82.03 Y91.23 E4.7733
+G1  X82.25 Y91.04 F4200.00
+G1  F1200.00
+G1  X82.59 Y91.07 E4.7757
+G1  X83.16 Y91.16 E4.7798
+G1  X84.07 Y91.25 E4.7864
+G1  X84.99 Y91.28 E4.7930
+G1  X85.91 Y91.25 E4.7995
+G1  X86.83 Y91.16 E4.8061
+G1  X87.39 Y91.07 E4.8102
+G1  X87.65 Y91.05 E4.8121
+G1  X87.86 Y91.21 F4200.00
+G1  F1200.00
+G1  X87.25 Y90.98 E4.8139
+G1  X89.72 Y90.73 F4200.00
+G1  F1500.00
+G1  X89.04 Y91.41 E4.8271
+G1  X89.09 Y91.47 E4.8282
+G1  X89.25 Y91.81 E4.8333
+G1  X90.39 Y90.67 E4.8554
+G1  X91.51 Y90.17 E4.8721
+G1  X89.37 Y92.31 E4.9133
+G1  X89.38 Y92.91 E4.9216
+G1  X92.97 Y89.32 E4.9907
+G1  X93.81 Y88.73 E5.0049
+G1  X94.54 Y88.12 E5.0178
+G1  X95.17 Y87.54 E5.0295
+G1  X95.21 Y87.69 E5.0317
+G1  X89.38 Y93.53 E5.1442
+G1  X89.38 Y94.14 E5.1525
+G1  X95.42 Y88.10 E5.2690
+G1  X95.59 Y88.33 E5.2729
+G1  X95.70 Y88.43 E5.2750
+G1  X89.38 Y94.76 E5.3969
+G1  X89.38 Y94.81 E5.3976
+G1  X90.16 Y94.59 E5.4086
+G1  X96.06 Y88.69 E5.5224
+G1  X96.45 Y88.91 E5.5286
+G1  X91.07 Y94.30 E5.6324
+G1  X92.08 Y93.90 E5.6472
+G1  X96.84 Y89.14 E5.7390
+G1  X97.23 Y89.36 E5.7452
+G1  X93.24 Y93.36 E5.8222
+G1  X94.31 Y92.77 E5.8388
+G1  X94.67 Y92.54 E5.8446
+G1  X97.62 Y89.59 E5.9016
+G1  X98.01 Y89.81 E5.9077
+G1  X95.90 Y91.93 E5.9484
+G1  X95.77 Y86.06 F4200.00
+G1  F1200.00
+G1  X95.66 Y86.71 E5.9504
+G1  X95.63 Y86.44 F4200.00
+G1  F1200.00
+G1  X95.77 Y86.23 E5.9522
+G1  X96.14 Y85.79 E5.9563
+G1  X96.68 Y85.04 E5.9630
+G1  X97.16 Y84.26 E5.9696
+G1  X97.59 Y83.45 E5.9762
+G1  X97.97 Y82.61 E5.9828
+G1  X98.18 Y82.05 E5.9871
+G1  X98.32 Y81.77 E5.9896
+G1  X98.60 Y81.67 F4200.00
+G1  F1200.00
+G1  X98.06 Y82.06 E5.9916
+G1  X101.97 Y82.19 F4200.00
+G1  F1500.00
+G1  X102.58 Y81.58 E6.0028
+G1  X102.75 Y80.82 E6.0132
+G1  X101.73 Y81.83 E6.0321
+G1  X101.36 Y81.62 E6.0378
+G1  X102.88 Y80.10 E6.0660
+G1  X102.97 Y79.41 E6.0752
+G1  X100.98 Y81.40 E6.1122
+G1  X100.60 Y81.18 E6.1179
+G1  X103.04 Y78.75 E6.1632
+G1  X103.09 Y78.11 E6.1716
+G1  X100.22 Y80.97 E6.2249
+G1  X99.90 Y80.86 E6.2294
+G1  X99.76 Y80.84 E6.2313
+G1  X103.10 Y77.50 E6.2933
+G1  X103.10 Y76.91 E6.3012
+G1  X99.15 Y80.85 E6.3745
+G1  X99.01 Y80.87 E6.3764
+G1  X99.15 Y80.26 E6.3847
+G1  X103.08 Y76.33 E6.4578
+G1  X103.04 Y75.78 E6.4651
+G1  X99.29 Y79.53 E6.5349
+G1  X99.38 Y78.85 E6.5440
+G1  X102.99 Y75.23 E6.6112
+G1  X102.93 Y74.71 E6.6182
+G1  X99.45 Y78.19 E6.6829
+G1  X99.47 Y77.57 E6.6909
+G1  X102.85 Y74.20 E6.7537
+G1  X102.76 Y73.69 E6.7605
+G1  X99.47 Y76.98 E6.8216
+G1  X99.45 Y76.40 E6.8292
+G1  X102.65 Y73.21 E6.8886
+G1  X102.54 Y72.73 E6.8951
+G1  X99.41 Y75.86 E6.9533
+G1  X99.35 Y75.32 E6.9604
+G1  X102.41 Y72.26 E7.0172
+G1  X102.40 Y72.25 E7.0174
+G1  X101.05 Y73.03 E7.0380
+G1  X99.27 Y74.81 E7.0711
+G1  X99.18 Y74.31 E7.0778
+G1  X99.87 Y73.61 E7.0907
+G1  X99.37 Y73.66 E7.0973
+G1  X99.26 Y73.63 E7.0988
+G1  X98.91 Y73.98 E7.1052
+G1  X98.03 Y72.32 F4200.00
+G1  F1200.00
+G1  X98.53 Y72.73 E7.1071
+G1  X98.29 Y72.62 F4200.00
+G1  F1200.00
+G1  X98.18 Y72.40 E7.1089
+G1  X97.97 Y71.86 E7.1131
+G1  X97.59 Y71.02 E7.1196
+G1  X97.16 Y70.21 E7.1262
+G1  X96.68 Y69.43 E7.1327
+G1  X96.14 Y68.68 E7.1393
+G1  X95.77 Y68.24 E7.1434
+G1  X95.63 Y68.03 E7.1452
+G1  X95.66 Y67.76 F4200.00
+G1  F1200.00
+G1  X95.77 Y68.40 E7.1472
+G1  X96.35 Y65.83 F4200.00
+G1  F1500.00
+G1  X97.77 Y64.40 E7.1731
+G1  X97.48 Y64.12 E7.1783
+G1  X94.91 Y66.68 E7.2249
+G1  X94.61 Y66.40 E7.2302
+G1  X97.18 Y63.84 E7.2768
+G1  X96.87 Y63.57 E7.2820
+G1  X94.30 Y66.14 E7.3287
+G1  X93.98 Y65.88 E7.3340
+G1  X96.56 Y63.30 E7.3808
+G1  X96.24 Y63.04 E7.3861
+G1  X93.65 Y65.63 E7.4330
+G1  X93.32 Y65.39 E7.4383
+G1  X95.92 Y62.79 E7.4855
+G1  X95.58 Y62.54 E7.4908
+G1  X92.98 Y65.15 E7.5380
+G1  X92.62 Y64.93 E7.5434
+G1  X95.24 Y62.30 E7.5910
+G1  X94.90 Y62.07 E7.5963
+G1  X92.26 Y64.70 E7.6441
+G1  X91.89 Y64.50 E7.6496
+G1  X94.54 Y61.85 E7.6977
+G1  X94.18 Y61.63 E7.7031
+G1  X91.51 Y64.30 E7.7516
+G1  X91.12 Y64.11 E7.7572
+G1  X93.81 Y61.42 E7.8061
+G1  X93.44 Y61.21 E7.8115
+G1  X90.72 Y63.93 E7.8609
+G1  X90.31 Y63.77 E7.8666
+G1  X93.06 Y61.02 E7.9163
+G1  X92.67 Y60.83 E7.9219
+G1  X89.89 Y63.61 E7.9723
+G1  X89.46 Y63.46 E7.9781
+G1  X92.27 Y60.65 E8.0291
+G1  X91.87 Y60.47 E8.0347
+G1  X89.02 Y63.32 E8.0864
+G1  X88.85 Y63.27 E8.0886
+G1  X89.12 Y62.94 E8.0941
+G1  X89.30 Y62.54 E8.0997
+G1  X89.32 Y62.45 E8.1010
+G1  X91.45 Y60.31 E8.1396
+G1  X91.03 Y60.16 E8.1454
+G1  X89.38 Y61.81 E8.1753
+G1  X89.38 Y61.23 E8.1827
+G1  X90.59 Y60.01 E8.2047
+G1  X90.15 Y59.87 E8.2107
+G1  X89.38 Y60.65 E8.2247
+G1  X89.38 Y60.07 E8.2321
+G1  X89.85 Y59.60 E8.2407
+G1  X87.34 Y63.50 F4200.00
+G1  F1200.00
+G1  X87.95 Y63.23 E8.2427
+G1  X87.73 Y63.42 F4200.00
+G1  F1200.00
+G1  X87.41 Y63.40 E8.2452
+G1  X86.83 Y63.30 E8.2495
+G1  X85.91 Y63.21 E8.2561
+G1  X84.99 Y63.18 E8.2627
+G1  X84.07 Y63.21 E8.2693
+G1  X83.16 Y63.30 E8.2760
+G1  X82.58 Y63.40 E8.2802
+G1  X82.33 Y63.42 E8.2820
+G1  X82.12 Y63.26 F4200.00
+G1  F1200.00
+G1  X82.73 Y63.49 E8.2837
+G1  X80.27 Y63.74 F4200.00
+G1  F1500.00
+G1  X80.95 Y63.06 E8.2969
+G1  X80.90 Y63.00 E8.2980
+G1  X80.74 Y62.65 E8.3031
+G1  X79.60 Y63.79 E8.3252
+G1  X78.48 Y64.30 E8.3419
+G1  X80.62 Y62.16 E8.3831
+G1  X80.61 Y61.56 E8.3914
+G1  X77.02 Y65.14 E8.4605
+G1  X76.18 Y65.74 E8.4747
+G1  X75.44 Y66.34 E8.4876
+G1  X74.82 Y66.93 E8.4993
+G1  X74.77 Y66.78 E8.5015
+G1  X80.61 Y60.94 E8.6140
+G1  X80.61 Y60.33 E8.6224
+G1  X74.57 Y66.36 E8.7388
+G1  X74.40 Y66.13 E8.7427
+G1  X74.28 Y66.04 E8.7448
+G1  X80.61 Y59.71 E8.8667
+G1  X80.61 Y59.66 E8.8674
+G1  X79.83 Y59.87 E8.8784
+G1  X73.92 Y65.78 E8.9923
+G1  X73.54 Y65.55 E8.9984
+G1  X78.92 Y60.17 E9.1022
+G1  X77.91 Y60.57 E9.1170
+G1  X73.14 Y65.33 E9.2089
+G1  X72.75 Y65.10 E9.2150
+G1  X76.75 Y61.11 E9.2920
+G1  X75.68 Y61.70 E9.3086
+G1  X75.32 Y61.93 E9.3145
+G1  X72.36 Y64.88 E9.3714
+G1  X71.97 Y64.65 E9.3775
+G1  X74.09 Y62.54 E9.4182
+G1  X74.22 Y68.40 F4200.00
+G1  F1200.00
+G1  X74.33 Y67.76 E9.4202
+G1  X74.36 Y68.03 F4200.00
+G1  F1200.00
+G1  X74.21 Y68.24 E9.4221
+G1  X73.85 Y68.68 E9.4261
+G1  X73.31 Y69.43 E9.4327
+G1  X72.83 Y70.21 E9.4393
+G1  X72.39 Y71.02 E9.4458
+G1  X72.01 Y71.86 E9.4524
+G1  X71.81 Y72.39 E9.4565
+G1  X71.66 Y72.70 E9.4589
+G1  X71.39 Y72.80 F4200.00
+G1  F1200.00
+G1  X71.50 Y72.72 E9.4593
+G1  X71.61 Y72.65 E9.4599
+G1  X71.93 Y72.40 E9.4618
+G1  X67.17 Y73.13 F4200.00
+G1  F1500.00
+G1  X67.88 Y72.42 E9.4750
+G1  X68.25 Y72.63 E9.4807
+G1  X67.24 Y73.65 E9.4996
+G1  X67.11 Y74.37 E9.5092
+G1  X68.63 Y72.85 E9.5375
+G1  X69.01 Y73.07 E9.5432
+G1  X67.02 Y75.06 E9.5802
+G1  X66.95 Y75.72 E9.5890
+G1  X69.38 Y73.29 E9.6343
+G1  X69.77 Y73.49 E9.6400
+G1  X66.90 Y76.36 E9.6933
+G1  X66.89 Y76.97 E9.7013
+G1  X70.23 Y73.63 E9.7635
+G1  X70.55 Y73.66 E9.7677
+G1  X70.83 Y73.61 E9.7715
+G1  X66.89 Y77.56 E9.8449
+G1  X66.90 Y78.14 E9.8525
+G1  X70.83 Y74.21 E9.9256
+G1  X70.70 Y74.93 E9.9353
+G1  X66.94 Y78.69 E10.0051
+G1  X66.99 Y79.23 E10.0123
+G1  X70.60 Y75.62 E10.0794
+G1  X70.54 Y76.28 E10.0881
+G1  X67.06 Y79.76 E10.1528
+G1  X67.14 Y80.27 E10.1596
+G1  X70.52 Y76.89 E10.2224
+G1  X70.52 Y77.49 E10.2303
+G1  X67.23 Y80.78 E10.2914
+G1  X67.34 Y81.26 E10.2979
+G1  X70.54 Y78.06 E10.3574
+G1  X70.58 Y78.61 E10.3646
+G1  X67.45 Y81.74 E10.4228
+G1  X67.58 Y82.20 E10.4291
+G1  X70.64 Y79.15 E10.4858
+G1  X70.72 Y79.66 E10.4926
+G1  X68.94 Y81.44 E10.5258
+G1  X69.71 Y80.99 E10.5375
+G1  X70.12 Y80.85 E10.5432
+G1  X70.81 Y80.16 E10.5560
+G1  X70.92 Y80.64 E10.5625
+G1  X70.57 Y80.99 E10.5690
+G1  X71.97 Y82.18 F4200.00
+G1  F1200.00
+G1  X71.50 Y81.77 E10.5705
+G1  X71.51 Y81.75 F4200.00
+G1  F1200.00
+G1  X71.81 Y82.06 E10.5736
+G1  X72.01 Y82.61 E10.5778
+G1  X72.39 Y83.45 E10.5843
+G1  X72.83 Y84.26 E10.5909
+G1  X73.31 Y85.04 E10.5975
+G1  X73.85 Y85.79 E10.6040
+G1  X74.21 Y86.23 E10.6081
+G1  X74.36 Y86.44 E10.6100
+G1  X74.33 Y86.71 F4200.00
+G1  F1200.00
+G1  X74.22 Y86.06 E10.6120
@@ -0,0 +1,16 @@
+M107 
+M190  S60
+M104 T0  S230
+M104 T1  S230
+G28 
+G1  Z5.00 F5000.00
+G90 
+M82 
+M185 
+M190  S0
+T0 
+M109 T0  S230
+G92  E0.0000
+G1  E-0.5000 F300.00
+G1  X0.00 Y25.00 Z0.35 F2000.00
+G1  E8.0000 F800.00
@@ -0,0 +1,9 @@
+G28 
+G1  Z0.30 F1200.00
+G1  X10.00 Y10.00 E1.0000 F1800.00
+G1  Z0.70
+G1  X50.00 Y50.00
+G1  Z0.30
+G1  X60.00 Y50.00 E2.0000
+G1  Z0.90
+G1  X0.00 Y0.00